@@ -578,7 +578,9 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "75fd4e6f-ee2f-4e28-a2d8-8a0f01dbd91c");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -598,7 +600,9 @@ TEST_F(iox_listener_test, AttachingServiceDiscoveryWithContextDataWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2d7cbe60-bda1-4191-b2d5-d67c47312a48");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -626,7 +630,9 @@ void notifyServiceDiscovery(SubscriberPortData& portData)
 TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWorks, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "538a50bc-60c8-4485-b70e-59d0c53f618b");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
 
@@ -646,7 +652,9 @@ TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWorks, Repeat(5),
 TIMING_TEST_F(iox_listener_test, NotifyingServiceDiscoveryEventWithContextDataWorks, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "257c27a5-95c6-489d-919f-125471b399e8");
     iox_service_discovery_storage_t serviceDiscoveryStorage;
-    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&m_subscriberPortData[0]));
+    EXPECT_CALL(*runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&m_subscriberPortData[1]))
+        .WillOnce(Return(&m_subscriberPortData[0]));
 
     iox_service_discovery_t serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
     uint64_t someContextData = 0U;
@@ -31,6 +31,14 @@ namespace iox
 {
 namespace posix
 {
+namespace
+{
+/// @brief buffer for the strings of a passwd or group entry; every lookup passes its own buffer to the reentrant
+/// getpwnam_r, getpwuid_r, getgrnam_r and getgrgid_r which makes the lookups safe to use from multiple threads
+constexpr uint64_t USER_DATABASE_BUFFER_SIZE{16384U};
+using UserDatabaseBuffer_t = UninitializedArray<char, USER_DATABASE_BUFFER_SIZE>;
+} // namespace
+
 PosixGroup::PosixGroup(gid_t id) noexcept
     : m_id(id)
     , m_doesExist(getGroupName(id).has_value())
@@ -63,28 +71,39 @@ PosixGroup PosixGroup::getGroupOfCurrentProcess() noexcept
 
 optional<gid_t> PosixGroup::getGroupID(const PosixGroup::groupName_t& name) noexcept
 {
-    auto getgrnamCall = posixCall(getgrnam)(name.c_str()).failureReturnValue(nullptr).evaluate();
-
-    if (getgrnamCall.has_error())
+    group groupEntry{};
+    group* result{nullptr};
+    UserDatabaseBuffer_t buffer;
+    auto getgrnamCall =
+        posixCall(getgrnam_r)(name.c_str(), &groupEntry, &buffer[0], USER_DATABASE_BUFFER_SIZE, &result)
+            .returnValueMatchesErrno()
+            .evaluate();
+
+    if (getgrnamCall.has_error() || result == nullptr)
     {
         IOX_LOG(ERROR) << "Error: Could not find group '" << name << "'.";
         return nullopt_t();
     }
 
-    return make_optional<gid_t>(getgrnamCall->value->gr_gid);
+    return make_optional<gid_t>(groupEntry.gr_gid);
 }
 
 optional<PosixGroup::groupName_t> PosixGroup::getGroupName(gid_t id) noexcept
 {
-    auto getgrgidCall = posixCall(getgrgid)(id).failureReturnValue(nullptr).evaluate();
-
-    if (getgrgidCall.has_error())
+    group groupEntry{};
+    group* result{nullptr};
+    UserDatabaseBuffer_t buffer;
+    auto getgrgidCall = posixCall(getgrgid_r)(id, &groupEntry, &buffer[0], USER_DATABASE_BUFFER_SIZE, &result)
+                            .returnValueMatchesErrno()
+                            .evaluate();
+
+    if (getgrgidCall.has_error() || result == nullptr)
     {
         IOX_LOG(ERROR) << "Error: Could not find group with id '" << id << "'.";
         return nullopt_t();
     }
 
-    return make_optional<groupName_t>(groupName_t(iox::TruncateToCapacity, getgrgidCall->value->gr_name));
+    return make_optional<groupName_t>(groupName_t(iox::TruncateToCapacity, groupEntry.gr_name));
 }
 
 PosixGroup::groupName_t PosixGroup::getName() const noexcept
@@ -110,26 +129,37 @@ bool PosixGroup::doesExist() const noexcept
 
 optional<uid_t> PosixUser::getUserID(const userName_t& name) noexcept
 {
-    auto getpwnamCall = posixCall(getpwnam)(name.c_str()).failureReturnValue(nullptr).evaluate();
-
-    if (getpwnamCall.has_error())
+    passwd passwdEntry{};
+    passwd* result{nullptr};
+    UserDatabaseBuffer_t buffer;
+    auto getpwnamCall =
+        posixCall(getpwnam_r)(name.c_str(), &passwdEntry, &buffer[0], USER_DATABASE_BUFFER_SIZE, &result)
+            .returnValueMatchesErrno()
+            .evaluate();
+
+    if (getpwnamCall.has_error() || result == nullptr)
     {
         IOX_LOG(ERROR) << "Error: Could not find user '" << name << "'.";
         return nullopt_t();
     }
-    return make_optional<uid_t>(getpwnamCall->value->pw_uid);
+    return make_optional<uid_t>(passwdEntry.pw_uid);
 }
 
 optional<PosixUser::userName_t> PosixUser::getUserName(uid_t id) noexcept
 {
-    auto getpwuidCall = posixCall(getpwuid)(id).failureReturnValue(nullptr).evaluate();
-
-    if (getpwuidCall.has_error())
+    passwd passwdEntry{};
+    passwd* result{nullptr};
+    UserDatabaseBuffer_t buffer;
+    auto getpwuidCall = posixCall(getpwuid_r)(id, &passwdEntry, &buffer[0], USER_DATABASE_BUFFER_SIZE, &result)
+                            .returnValueMatchesErrno()
+                            .evaluate();
+
+    if (getpwuidCall.has_error() || result == nullptr)
     {
         IOX_LOG(ERROR) << "Error: Could not find user with id'" << id << "'.";
         return nullopt_t();
     }
-    return make_optional<userName_t>(userName_t(iox::TruncateToCapacity, getpwuidCall->value->pw_name));
+    return make_optional<userName_t>(userName_t(iox::TruncateToCapacity, passwdEntry.pw_name));
 }
 
 PosixUser::groupVector_t PosixUser::getGroups() const noexcept
@@ -140,14 +170,20 @@ PosixUser::groupVector_t PosixUser::getGroups() const noexcept
         return groupVector_t();
     }
 
-    auto getpwnamCall = posixCall(getpwnam)(userName->c_str()).failureReturnValue(nullptr).evaluate();
-    if (getpwnamCall.has_error())
+    passwd passwdEntry{};
+    passwd* result{nullptr};
+    UserDatabaseBuffer_t buffer;
+    auto getpwnamCall =
+        posixCall(getpwnam_r)(userName->c_str(), &passwdEntry, &buffer[0], USER_DATABASE_BUFFER_SIZE, &result)
+            .returnValueMatchesErrno()
+            .evaluate();
+    if (getpwnamCall.has_error() || result == nullptr)
     {
-        IOX_LOG(ERROR) << "Error: getpwnam call failed";
+        IOX_LOG(ERROR) << "Error: getpwnam_r call failed";
         return groupVector_t();
     }
 
-    gid_t userDefaultGroup = getpwnamCall->value->pw_gid;
+    gid_t userDefaultGroup = passwdEntry.pw_gid;
     UninitializedArray<gid_t, MaxNumberOfGroups> groups{}; // groups is initialized in iox_getgrouplist
     int32_t numGroups = MaxNumberOfGroups;
 
@@ -0,0 +1,52 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/string_hash.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+TEST(StringHash_test, HashIsTheFnv1aHashOfTheCharacters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "081fdc43-9dee-431f-a076-8f5092086f95");
+    StringHash sut;
+
+    EXPECT_THAT(sut(string<10>("")), Eq(0xcbf29ce484222325ULL));
+    EXPECT_THAT(sut(string<10>("a")), Eq(0xaf63dc4c8601ec8cULL));
+    EXPECT_THAT(sut(string<10>("foobar")), Eq(0x85944171f73967e8ULL));
+}
+
+TEST(StringHash_test, HashDoesNotDependOnTheCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5379625d-47b6-41e7-8737-7bdaccba69b7");
+    StringHash sut;
+
+    EXPECT_THAT(sut(string<6>("foobar")), Eq(sut(string<100>("foobar"))));
+}
+
+TEST(StringHash_test, DifferentStringsHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e34bf366-cbe6-437c-a9fb-8b5f883a1814");
+    StringHash sut;
+
+    EXPECT_THAT(sut(string<10>("ab")), Ne(sut(string<10>("ba"))));
+}
+
+} // namespace
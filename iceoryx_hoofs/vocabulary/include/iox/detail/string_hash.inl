@@ -0,0 +1,40 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_VOCABULARY_STRING_HASH_INL
+#define IOX_HOOFS_VOCABULARY_STRING_HASH_INL
+
+#include "iox/string_hash.hpp"
+
+namespace iox
+{
+template <uint64_t Capacity>
+inline uint64_t StringHash::operator()(const string<Capacity>& value) const noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    const char* const characters = value.c_str();
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(characters[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+} // namespace iox
+
+#endif // IOX_HOOFS_VOCABULARY_STRING_HASH_INL
@@ -0,0 +1,36 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_VOCABULARY_STRING_HASH_HPP
+#define IOX_HOOFS_VOCABULARY_STRING_HASH_HPP
+
+#include "iox/string.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+/// @brief Hash functor for iox::string which computes the 64 bit FNV-1a hash of the characters. In contrast to
+/// std::hash the value is the same in every process, which makes it usable for hashed containers in shared memory.
+struct StringHash
+{
+    template <uint64_t Capacity>
+    uint64_t operator()(const string<Capacity>& value) const noexcept;
+};
+} // namespace iox
+
+#include "iox/detail/string_hash.inl"
+
+#endif // IOX_HOOFS_VOCABULARY_STRING_HASH_HPP
@@ -29,6 +29,7 @@ option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module"
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
+option(PUBLISH_TIMESTAMPS "Adds support for publish timestamps in the ChunkHeader and latency histograms of subscribers" ON)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
 option(ADDRESS_SANITIZER "Build with address sanitizer" OFF)
@@ -85,6 +86,7 @@ function(show_config_options)
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
+  message("          PUBLISH_TIMESTAMPS...................: " ${PUBLISH_TIMESTAMPS})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          ADDRESS_SANITIZER....................: " ${ADDRESS_SANITIZER})
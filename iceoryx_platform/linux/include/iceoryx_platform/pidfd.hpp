@@ -0,0 +1,43 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
+#define IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
+
+#include <cstdint>
+#include <sys/types.h>
+
+/// @brief Opens a file descriptor which refers to the process with the given pid and which becomes readable when the
+///        process terminates. The file descriptor is closed with iox_close.
+/// @note The pid is interpreted in the PID namespace of the caller.
+/// @return the file descriptor or -1 with errno set; errno is ENOSYS when pidfds are not supported
+int iox_pidfd_open(pid_t pid, unsigned int flags);
+
+/// @brief Creates a monitor which waits for multiple pidfds. The file descriptor is closed with iox_close, which also
+///        closes the monitor.
+/// @return the file descriptor of the monitor or -1 with errno set
+int iox_pidfd_monitor_create();
+
+/// @brief Adds a pidfd to the monitor; the id is reported by iox_pidfd_monitor_wait when the process terminated.
+///        Closing the pidfd removes it from the monitor.
+/// @return 0 on success or -1 with errno set
+int iox_pidfd_monitor_add(int monitorFd, int pidFd, uint32_t id);
+
+/// @brief Waits until at least one of the monitored processes terminated or the timeout passed. A terminated process
+///        is reported by every call until its pidfd is closed.
+/// @return the number of ids which were written to ids, at most maxIds, or -1 with errno set
+int iox_pidfd_monitor_wait(int monitorFd, uint32_t* ids, int maxIds, int timeoutInMs);
+
+#endif // IOX_HOOFS_LINUX_PLATFORM_PIDFD_HPP
@@ -0,0 +1,68 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/pidfd.hpp"
+
+#include <array>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_open(pid_t pid, unsigned int flags)
+{
+#if defined(SYS_pidfd_open)
+    // glibc provides a pidfd_open wrapper only since version 2.36, therefore the system call is used directly
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, flags));
+#else
+    static_cast<void>(pid);
+    static_cast<void>(flags);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_monitor_create()
+{
+    return epoll_create1(EPOLL_CLOEXEC);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_monitor_add(int monitorFd, int pidFd, uint32_t id)
+{
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u32 = id;
+    return epoll_ctl(monitorFd, EPOLL_CTL_ADD, pidFd, &event);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_pidfd_monitor_wait(int monitorFd, uint32_t* ids, int maxIds, int timeoutInMs)
+{
+    // the pidfds are level triggered, therefore the processes which do not fit are reported by the next call
+    constexpr int MAX_EVENTS_PER_WAIT{128};
+    std::array<epoll_event, MAX_EVENTS_PER_WAIT> events{};
+    const int maxEvents = (maxIds < MAX_EVENTS_PER_WAIT) ? maxIds : MAX_EVENTS_PER_WAIT;
+    const int numberOfEvents = epoll_wait(monitorFd, events.data(), maxEvents, timeoutInMs);
+    for (int i = 0; i < numberOfEvents; ++i)
+    {
+        // epoll_event is packed, therefore the id must be copied
+        ids[i] = events[static_cast<uint64_t>(i)].data.u32;
+    }
+    return numberOfEvents;
+}
@@ -56,6 +56,20 @@ inline struct group* getgrgid(gid_t gid)
     return &dummy;
 }
 
+inline int getgrnam_r(const char* name, struct group* grp, char* buf, size_t buflen, struct group** result)
+{
+    *grp = *getgrnam(name);
+    *result = grp;
+    return 0;
+}
+
+inline int getgrgid_r(gid_t gid, struct group* grp, char* buf, size_t buflen, struct group** result)
+{
+    *grp = *getgrgid(gid);
+    *result = grp;
+    return 0;
+}
+
 inline int iox_getgrouplist(const char* user, gid_t group, gid_t* groups, int* ngroups)
 {
     groups[0] = 0;
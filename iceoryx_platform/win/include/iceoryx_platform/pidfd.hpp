@@ -0,0 +1,51 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_WIN_PLATFORM_PIDFD_HPP
+#define IOX_HOOFS_WIN_PLATFORM_PIDFD_HPP
+
+#include "iceoryx_platform/types.hpp"
+
+#include <cerrno>
+#include <cstdint>
+
+// pidfds are a Linux feature; all functions fail with ENOSYS and terminated processes are only detected by the
+// heartbeat
+
+inline int iox_pidfd_open(pid_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_monitor_create()
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_monitor_add(int, int, uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_pidfd_monitor_wait(int, uint32_t*, int, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif // IOX_HOOFS_WIN_PLATFORM_PIDFD_HPP
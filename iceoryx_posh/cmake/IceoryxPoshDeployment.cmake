@@ -39,6 +39,13 @@ if(NOT IOX_COMMUNICATION_POLICY)
     set(IOX_COMMUNICATION_POLICY ManyToManyPolicy)
 endif()
 
+if(PUBLISH_TIMESTAMPS)
+    message(STATUS "[i] Publish timestamps are supported!")
+    set(IOX_PUBLISH_TIMESTAMPS true)
+else()
+    set(IOX_PUBLISH_TIMESTAMPS false)
+endif()
+
 # Refer to iceoryx_hoofs/include/iceoryx_hoofs/internal/posix_wrapper/ipc_channel.hpp
 # for info why this is needed.
 if(APPLE)
@@ -111,6 +118,10 @@ configure_option(
     NAME IOX_MAX_RUNTIME_NAME_LENGTH
     DEFAULT_VALUE ${IOX_MAX_RUNTIME_NAME_LENGTH_DEFAULT}
 )
+configure_option(
+    NAME IOX_MAX_PORT_HISTOGRAMS
+    DEFAULT_VALUE 0
+)
 configure_option(
     NAME IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY
     DEFAULT_VALUE 16
@@ -180,6 +180,20 @@ class ServiceDescription
 /// @return                                 Bool if comparison match or not
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept;
 
+/// @brief Hash functor for the strings of the ServiceDescription
+struct IdStringHash
+{
+    uint64_t operator()(const IdString_t& value) const noexcept;
+};
+
+/// @brief Hash functor which is consistent with ServiceDescription::operator==, i.e. only the service, instance and
+///         event strings are considered. This is needed to use ServiceDescription in hashed containers like
+///         unordered_map.
+struct ServiceDescriptionHash
+{
+    uint64_t operator()(const ServiceDescription& service) const noexcept;
+};
+
 /// @brief Convenience stream operator to easily use the 'ServiceDescription' with std::ostream
 /// @param[in] stream output stream to write the message to
 /// @param[in] service ServiceDescription that shall be converted
@@ -127,6 +127,7 @@ namespace iox
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
     error(PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW) \
+    error(PORT_POOL__HEARTBEAT_LIST_OVERFLOW) \
     error(PORT_MANAGER__PORT_POOL_UNAVAILABLE) \
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
@@ -70,9 +70,12 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
-// 3x publisherPort port introspection
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 4x publisherPort port introspection
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 6;
+// The service registry is using the following publisherPorts
+// 1x publisherPort service registry snapshot
+// 1x publisherPort service registry delta
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -108,6 +111,8 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 16U;
+constexpr uint32_t MAX_NUMBER_OF_TIMERS_PER_TIMER_SCHEDULER = 128U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -126,10 +131,20 @@ constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
 constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+/// @brief The number of ports handed over with one CLAIM_MANIFEST_PORTS_ACK; each port takes up to 21 characters of the
+///        message for its offset and the separator, the remainder is reserved for the header
+constexpr uint32_t MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE = (APP_MESSAGE_SIZE - 64U) / 21U;
+/// @brief The number of ports created with one CREATE_PORTS request; the result of each port takes up to 23 characters
+///        of the CREATE_PORTS_ACK, the remainder is reserved for the header
+constexpr uint32_t MAX_CREATED_PORTS_PER_MESSAGE = (APP_MESSAGE_SIZE - 64U) / 23U;
 
 
 // Processes
 constexpr uint32_t MAX_PROCESS_NUMBER = build::IOX_MAX_PROCESS_NUMBER;
+/// @brief The max number of publishers and subscribers in the deployment manifest
+constexpr uint32_t MAX_NUMBER_OF_MANIFEST_PORTS = 256U;
+/// @brief The max number of ports and condition variables which can be collected in a runtime::PortBatch
+constexpr uint32_t MAX_PORTS_PER_BATCH = 128U;
 
 // Service Discovery
 constexpr uint32_t SERVICE_REGISTRY_CAPACITY = MAX_PUBLISHERS + MAX_SERVERS;
@@ -138,6 +153,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_DELTA_EVENT_NAME[] = "ServiceRegistryDelta";
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
@@ -224,11 +240,22 @@ constexpr const char SHM_NAME[] = "iceoryx_mgmt";
 // this is used by the UniquePortId
 constexpr uint16_t DEFAULT_UNIQUE_ROUDI_ID{0U};
 
+/// @brief The number of threads which receive and answer the messages of the runtimes concurrently; the PortManager is
+/// still accessed by only one of them at a time
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_THREADS{1U};
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS{16U};
+
 // Timeout
 using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief The discovery is triggered by the ports on a state change and processes only the ports which marked
+/// themselves as dirty; this interval defines how often a full discovery of all ports runs, e.g. to recover from a
+/// lost notification and to clean up nodes and condition variables which are not marked
+constexpr units::Duration DISCOVERY_FALLBACK_INTERVAL = 1_s;
+/// @brief The index which is used by the ports to notify RouDi's discovery condition variable
+constexpr uint64_t DISCOVERY_NOTIFICATION_INDEX{0U};
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
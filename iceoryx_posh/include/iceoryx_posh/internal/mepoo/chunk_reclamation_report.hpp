@@ -0,0 +1,66 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_RECLAMATION_REPORT_HPP
+#define IOX_POSH_MEPOO_CHUNK_RECLAMATION_REPORT_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Counts the chunks which are released on behalf of the ports of a terminated runtime, separately for each
+/// mempool. A chunk which is still used by another port is counted as well, since the reference of the terminated
+/// runtime is reclaimed; it returns to its mempool when the last reference is released.
+/// @note The mempools are identified by their chunk size, i.e. mempools with the same chunk size in different
+/// segments share an entry
+class ChunkReclamationReport
+{
+  public:
+    struct MemPoolEntry
+    {
+        uint32_t chunkSize{0U};
+        uint64_t numberOfChunks{0U};
+    };
+
+    using MemPoolEntries_t = vector<MemPoolEntry, MAX_NUMBER_OF_MEMPOOLS * MAX_SHM_SEGMENTS>;
+
+    /// @brief Counts a released chunk in the entry of its mempool; an invalid chunk is ignored
+    /// @param[in] chunk which is released
+    void count(const SharedChunk& chunk) noexcept;
+
+    /// @brief Returns the number of counted chunks of all mempools
+    uint64_t numberOfChunks() const noexcept;
+
+    /// @brief Returns the counted chunks per mempool in the order the mempools were encountered
+    const MemPoolEntries_t& memPools() const noexcept;
+
+    /// @brief Removes all counted chunks
+    void clear() noexcept;
+
+  private:
+    MemPoolEntries_t m_memPools;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_RECLAMATION_REPORT_HPP
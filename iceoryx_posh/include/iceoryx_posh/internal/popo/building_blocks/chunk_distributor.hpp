@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -24,6 +25,7 @@
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
 
+#include <chrono>
 #include <thread>
 
 namespace iox
@@ -97,7 +99,8 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. Queues whose user-header filter rejects the chunk or which are throttled by decimation or a minimum
+    /// delivery interval are skipped
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
@@ -132,10 +135,12 @@ class ChunkDistributor
     uint64_t getHistoryCapacity() const noexcept;
 
     /// @brief Clears the chunk history
-    void clearHistory() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void clearHistory(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
     /// @brief cleanup the used shrared memory chunks
-    void cleanup() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void cleanup(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   protected:
     const MemberType_t* getMembers() const noexcept;
@@ -143,6 +148,23 @@ class ChunkDistributor
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Evaluates the user-header filter of the queue on the chunk
+    /// @param[in] queue is the queue the chunk shall be delivered to
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @return true if the queue has no filter or the chunk matches the filter, false otherwise
+    bool isAcceptedByQueue(not_null<ChunkQueueData_t* const> queue, const mepoo::SharedChunk& chunk) const noexcept;
+
+    /// @brief Applies the decimation and the minimum delivery interval of the queue and updates the corresponding
+    /// state of the queue if the chunk is due; the decimation is only advanced by advanceDecimation
+    /// @param[in] queue is the queue the chunk shall be delivered to
+    /// @return true if a chunk is due for the queue, false if it shall be skipped
+    bool isDueForQueue(not_null<ChunkQueueData_t* const> queue) noexcept;
+
+    /// @brief Starts the next decimation period of the queue after a due chunk was pushed successfully, a due chunk
+    /// which is lost due to a full queue is therefore followed by the next offered one
+    /// @param[in] queue is the queue the chunk was delivered to
+    void advanceDecimation(not_null<ChunkQueueData_t* const> queue) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
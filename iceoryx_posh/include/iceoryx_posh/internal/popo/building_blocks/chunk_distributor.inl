@@ -79,7 +79,11 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                auto chunk = getMembers()->m_history[i].cloneToSharedChunk();
+                if (isAcceptedByQueue(queueToAdd, chunk))
+                {
+                    pushToQueue(queueToAdd, chunk);
+                }
             }
 
             return success<void>();
@@ -147,10 +151,18 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
+            // chunks rejected by the filter or the rate limit of the subscriber are neither enqueued nor do they cause
+            // a wakeup
+            if (!isAcceptedByQueue(queue.get(), chunk) || !isDueForQueue(queue.get()))
+            {
+                continue;
+            }
+
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
             if (pushToQueue(queue.get(), chunk))
             {
+                advanceDecimation(queue.get());
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
             else
@@ -199,6 +211,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
             {
                 if (pushToQueue(remainingQueues[i].get(), chunk))
                 {
+                    advanceDecimation(remainingQueues[i].get());
                     remainingQueues.erase(remainingQueues.begin() + i);
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
@@ -224,6 +237,64 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<Chu
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::isAcceptedByQueue(not_null<ChunkQueueData_t* const> queue,
+                                                              const mepoo::SharedChunk& chunk) const noexcept
+{
+    const ChunkQueueData_t* const queueData = queue;
+    return !queueData->m_userHeaderFilter.hasConditions()
+           || queueData->m_userHeaderFilter.matches(*chunk.getChunkHeader());
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isDueForQueue(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+
+    if (queueData->m_decimationFactor > 1U)
+    {
+        // the counter of a due chunk is advanced only after the chunk was pushed, see advanceDecimation
+        const auto counter = queueData->m_decimationCounter.load(std::memory_order_relaxed);
+        if (counter % queueData->m_decimationFactor != 0U)
+        {
+            queueData->m_decimationCounter.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    const auto minimumInterval = queueData->m_minimumDeliveryIntervalInNanoseconds;
+    if (minimumInterval > 0U)
+    {
+        const auto now = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch())
+                .count());
+        auto lastDelivery = queueData->m_lastDeliveryTimestampInNanoseconds.load(std::memory_order_relaxed);
+        do
+        {
+            if (lastDelivery != 0U && now - lastDelivery < minimumInterval)
+            {
+                return false;
+            }
+            // the compare exchange ensures that only one of multiple concurrent producers delivers in an interval
+        } while (!queueData->m_lastDeliveryTimestampInNanoseconds.compare_exchange_weak(
+            lastDelivery, now, std::memory_order_relaxed, std::memory_order_relaxed));
+    }
+
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::advanceDecimation(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    if (queueData->m_decimationFactor > 1U)
+    {
+        queueData->m_decimationCounter.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
@@ -326,24 +397,29 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistoryCapacity()
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
+inline void
+ChunkDistributor<ChunkDistributorDataType>::clearHistory(mepoo::ChunkReclamationReport* const report) noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
     for (auto& unmanagedChunk : getMembers()->m_history)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        auto chunk = unmanagedChunk.releaseToSharedChunk();
+        if (report != nullptr)
+        {
+            report->count(chunk);
+        }
     }
 
     getMembers()->m_history.clear();
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
+inline void ChunkDistributor<ChunkDistributorDataType>::cleanup(mepoo::ChunkReclamationReport* const report) noexcept
 {
     if (getMembers()->tryLock())
     {
-        clearHistory();
+        clearHistory(report);
         getMembers()->unlock();
     }
     else
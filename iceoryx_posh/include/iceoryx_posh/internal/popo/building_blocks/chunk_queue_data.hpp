@@ -19,12 +19,15 @@
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/concurrent_histogram.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -45,10 +48,30 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    /// @brief monotonic counters for the dimensioning of the queue capacity; in contrast to m_queueHasLostChunks they
+    ///        are never reset
+    std::atomic<uint64_t> m_lostChunksCount{0U};
+    std::atomic<uint64_t> m_maxFillLevel{0U};
+    std::atomic<uint64_t> m_receivedChunksCount{0U};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+    UserHeaderFilter m_userHeaderFilter;
+
+    /// @brief only every n-th chunk is delivered to the queue; 0 and 1 deliver every chunk
+    uint64_t m_decimationFactor{1U};
+    /// @note this is an atomic since multiple producers can deliver to the same queue concurrently; it counts the
+    /// offered chunks but is advanced for a due chunk only when it was pushed successfully
+    std::atomic<uint64_t> m_decimationCounter{0U};
+    /// @brief the minimum time between two delivered chunks; 0 disables the rate limit
+    uint64_t m_minimumDeliveryIntervalInNanoseconds{0U};
+    std::atomic<uint64_t> m_lastDeliveryTimestampInNanoseconds{0U};
+
+    /// @brief the number of chunks in the queue right after a chunk was pushed; only recorded while enabled, i.e. while
+    /// the port histograms of the introspection have subscribers
+    ConcurrentHistogram m_queueDepthHistogram;
+    std::atomic<bool> m_queueDepthHistogramEnabled{false};
 };
 
 } // namespace popo
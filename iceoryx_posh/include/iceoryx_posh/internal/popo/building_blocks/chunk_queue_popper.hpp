@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_HPP
 
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
@@ -54,6 +55,18 @@ class ChunkQueuePopper
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
 
+    /// @brief get the number of chunks which were lost due to an overflow since the creation of the queue
+    /// @return number of lost chunks
+    uint64_t getLostChunksCount() const noexcept;
+
+    /// @brief get the highest number of chunks which were in the queue at the same time
+    /// @return maximum fill level of the queue
+    uint64_t getMaximumFillLevel() const noexcept;
+
+    /// @brief get the number of chunks which were pushed into the queue since its creation
+    /// @return number of received chunks
+    uint64_t getReceivedChunksCount() const noexcept;
+
     /// @brief pop a chunk from the chunk queue
     /// @return if the queue is empty return true, otherwise false
     bool empty() const noexcept;
@@ -78,7 +91,8 @@ class ChunkQueuePopper
     uint64_t getMaximumCapacity() const noexcept;
 
     /// @brief clear the queue
-    void clear() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void clear(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
     /// @brief Attaches a condition variable
     /// @param[in] ConditionVariableDataPtr, pointer to an condition variable data object
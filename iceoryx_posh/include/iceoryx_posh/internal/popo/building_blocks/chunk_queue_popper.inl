@@ -82,6 +82,24 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
     return false;
 }
 
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getLostChunksCount() const noexcept
+{
+    return getMembers()->m_lostChunksCount.load(std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumFillLevel() const noexcept
+{
+    return getMembers()->m_maxFillLevel.load(std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getReceivedChunksCount() const noexcept
+{
+    return getMembers()->m_receivedChunksCount.load(std::memory_order_relaxed);
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
@@ -113,13 +131,16 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 }
 
 template <typename ChunkQueueDataType>
-inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
+inline void ChunkQueuePopper<ChunkQueueDataType>::clear(mepoo::ChunkReclamationReport* const report) noexcept
 {
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
-        // side effect here and return value does not need to be evaluated
-        maybeUnmanagedChunk.value().releaseToSharedChunk();
+        // d'tor of SharedChunk will release the memory, so RAII has the side effect here
+        auto chunk = maybeUnmanagedChunk.value().releaseToSharedChunk();
+        if (report != nullptr)
+        {
+            report->count(chunk);
+        }
     }
 }
 
@@ -47,15 +47,37 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
+    bool wasChunkEnqueued = true;
 
     // drop the chunk if one is returned by an overflow
     if (pushRet.has_value())
     {
+        // a FiFo rejects the new chunk while a SoFi enqueues it and returns the oldest one
+        wasChunkEnqueued = (pushRet.value().getChunkHeader() != chunk.getChunkHeader());
         pushRet.value().releaseToSharedChunk();
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
     }
 
+    // a rejected chunk is pushed again by a blocking producer and must not be counted on every retry
+    if (wasChunkEnqueued)
+    {
+        getMembers()->m_receivedChunksCount.fetch_add(1U, std::memory_order_relaxed);
+
+        const auto fillLevel = getMembers()->m_queue.size();
+        if (build::IOX_MAX_PORT_HISTOGRAMS > 0U
+            && getMembers()->m_queueDepthHistogramEnabled.load(std::memory_order_relaxed))
+        {
+            getMembers()->m_queueDepthHistogram.record(fillLevel);
+        }
+        auto maxFillLevel = getMembers()->m_maxFillLevel.load(std::memory_order_relaxed);
+        while (fillLevel > maxFillLevel
+               && !getMembers()->m_maxFillLevel.compare_exchange_weak(
+                   maxFillLevel, fillLevel, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+        }
+    }
+
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
         if (getMembers()->m_conditionVariableDataPtr)
@@ -73,6 +95,7 @@ template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    getMembers()->m_lostChunksCount.fetch_add(1U, std::memory_order_relaxed);
 }
 
 } // namespace popo
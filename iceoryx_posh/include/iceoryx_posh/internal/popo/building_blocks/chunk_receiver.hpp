@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/histogram.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
@@ -85,11 +86,27 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
-    void releaseAll() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void releaseAll(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
+
+    /// @brief Provides the histogram of the time between sending and taking of the chunks which carry a publish
+    /// timestamp
+    /// @return snapshot of the latency histogram in nanoseconds
+    Histogram getLatencyHistogram() const noexcept;
+
+    /// @brief Provides the histogram of the number of chunks in the queue right after a chunk was pushed
+    /// @return snapshot of the queue depth histogram
+    Histogram getQueueDepthHistogram() const noexcept;
+
+    /// @brief Enables or disables the recording of the queue depth histogram
+    /// @param[in] enable true to record the queue depth on every push, false to skip it
+    void setQueueDepthHistogramEnabled(const bool enable) noexcept;
 
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    void recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept;
 };
 
 } // namespace popo
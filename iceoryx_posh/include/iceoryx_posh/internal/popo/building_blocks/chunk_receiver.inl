@@ -81,6 +81,10 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
+            if (build::IOX_PUBLISH_TIMESTAMPS)
+            {
+                recordLatency(*sharedChunk.getChunkHeader());
+            }
             return success<const mepoo::ChunkHeader*>(
                 const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -106,10 +110,43 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
 }
 
 template <typename ChunkReceiverDataType>
-inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
+inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    getMembers()->m_chunksInUse.cleanup();
-    this->clear();
+    getMembers()->m_chunksInUse.cleanup(report);
+    this->clear(report);
+}
+
+template <typename ChunkReceiverDataType>
+inline Histogram ChunkReceiver<ChunkReceiverDataType>::getLatencyHistogram() const noexcept
+{
+    return getMembers()->m_latencyHistogram.snapshot();
+}
+
+template <typename ChunkReceiverDataType>
+inline Histogram ChunkReceiver<ChunkReceiverDataType>::getQueueDepthHistogram() const noexcept
+{
+    return getMembers()->m_queueDepthHistogram.snapshot();
+}
+
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::setQueueDepthHistogramEnabled(const bool enable) noexcept
+{
+    getMembers()->m_queueDepthHistogramEnabled.store(enable, std::memory_order_relaxed);
+}
+
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    const uint64_t publishTimestamp{chunkHeader.publishTimestamp()};
+    if (publishTimestamp == 0U)
+    {
+        return;
+    }
+
+    const auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+    // the clock is monotonic and system wide, the check only guards against corrupted timestamps
+    getMembers()->m_latencyHistogram.record((now > publishTimestamp) ? now - publishTimestamp : 0U);
 }
 
 } // namespace popo
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/concurrent_histogram.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
@@ -43,6 +44,9 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
     UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// histogram of the time in nanoseconds between sending and taking of the chunks with a publish timestamp
+    ConcurrentHistogram m_latencyHistogram;
 };
 
 } // namespace popo
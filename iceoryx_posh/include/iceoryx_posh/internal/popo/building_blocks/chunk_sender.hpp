@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/histogram.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/expected.hpp"
 #include "iox/into.hpp"
@@ -133,10 +134,19 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
+    /// @brief Returns the histogram of the time between two consecutive sends
+    /// @return snapshot of the send interval histogram in nanoseconds; empty if publish timestamps are disabled
+    Histogram getSendIntervalHistogram() const noexcept;
+
+    /// @brief Enables or disables the recording of the send interval histogram
+    /// @param[in] enable true to record the send intervals, false to skip them
+    void setSendIntervalHistogramEnabled(const bool enable) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
-    void releaseAll() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void releaseAll(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   private:
     /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
@@ -246,11 +246,27 @@ inline optional<const mepoo::ChunkHeader*> ChunkSender<ChunkSenderDataType>::try
 }
 
 template <typename ChunkSenderDataType>
-inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
+inline void ChunkSender<ChunkSenderDataType>::releaseAll(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    getMembers()->m_chunksInUse.cleanup();
-    this->cleanup();
-    getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunksInUse.cleanup(report);
+    this->cleanup(report);
+    auto lastChunk = getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    if (report != nullptr)
+    {
+        report->count(lastChunk);
+    }
+}
+
+template <typename ChunkSenderDataType>
+inline Histogram ChunkSender<ChunkSenderDataType>::getSendIntervalHistogram() const noexcept
+{
+    return getMembers()->m_sendIntervalHistogram.snapshot();
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::setSendIntervalHistogramEnabled(const bool enable) noexcept
+{
+    getMembers()->m_sendIntervalHistogramEnabled.store(enable, std::memory_order_relaxed);
 }
 
 template <typename ChunkSenderDataType>
@@ -260,6 +276,23 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        if (build::IOX_PUBLISH_TIMESTAMPS && getMembers()->m_publishTimestampEnabled)
+        {
+            const auto now = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(mepoo::BaseClock_t::now().time_since_epoch())
+                    .count());
+            chunk.getChunkHeader()->setPublishTimestamp(now);
+
+            // the send interval reuses the publish timestamp in order to not read the clock twice per send
+            auto& lastPublishTimestamp = getMembers()->m_lastPublishTimestamp;
+            if (build::IOX_MAX_PORT_HISTOGRAMS > 0U && lastPublishTimestamp != 0U
+                && getMembers()->m_sendIntervalHistogramEnabled.load(std::memory_order_relaxed))
+            {
+                getMembers()->m_sendIntervalHistogram.record((now > lastPublishTimestamp) ? now - lastPublishTimestamp
+                                                                                          : 0U);
+            }
+            lastPublishTimestamp = now;
+        }
         return true;
     }
     else
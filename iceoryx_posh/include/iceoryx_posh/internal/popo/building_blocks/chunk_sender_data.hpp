@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/concurrent_histogram.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/not_null.hpp"
@@ -44,6 +45,12 @@ struct ChunkSenderData : public ChunkDistributorDataType
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
+    bool m_publishTimestampEnabled{false};
+    uint64_t m_lastPublishTimestamp{0U};
+    /// @brief the time between two consecutive sends; only recorded when publish timestamps are enabled and the
+    /// recording is enabled, i.e. while the port histograms of the introspection have subscribers
+    ConcurrentHistogram m_sendIntervalHistogram;
+    std::atomic<bool> m_sendIntervalHistogramEnabled{false};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
 };
 
@@ -0,0 +1,58 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONCURRENT_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CONCURRENT_HISTOGRAM_HPP
+
+#include "iceoryx_posh/popo/histogram.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lock-free variant of the Histogram which is placed in the shared memory. Values are recorded by the
+/// application and the histogram is read by RouDi, e.g. by the port introspection, via a snapshot.
+/// @note the snapshot is not atomic as a whole, values recorded concurrently may or may not be contained in it
+class ConcurrentHistogram
+{
+  public:
+    ConcurrentHistogram() noexcept;
+
+    ConcurrentHistogram(const ConcurrentHistogram&) = delete;
+    ConcurrentHistogram(ConcurrentHistogram&&) = delete;
+    ConcurrentHistogram& operator=(const ConcurrentHistogram&) = delete;
+    ConcurrentHistogram& operator=(ConcurrentHistogram&&) = delete;
+    ~ConcurrentHistogram() noexcept = default;
+
+    /// @brief Adds a value to the histogram
+    /// @param[in] value to add
+    void record(const uint64_t value) noexcept;
+
+    /// @brief Creates a copy of the current bucket counts
+    /// @return the Histogram with the bucket counts
+    Histogram snapshot() const noexcept;
+
+  private:
+    std::atomic<uint64_t> m_counts[Histogram::BUCKET_COUNT];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CONCURRENT_HISTOGRAM_HPP
@@ -18,8 +18,13 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_LISTENER_HPP
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/duration.hpp"
+#include "iox/optional.hpp"
+
+#include <atomic>
 
 namespace iox
 {
@@ -64,6 +69,29 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief Sets how long wait() and timedWait() busy poll for notifications before they block on the semaphore.
+    /// Spinning avoids the latency of the wakeup by the operating system but fully utilizes a CPU core while
+    /// spinning, therefore it is only reasonable for threads on isolated cores. Spinning is disabled by default.
+    /// @param[in] spinDuration how long a wait call busy polls at most, zero disables spinning
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns how long wait() and timedWait() busy poll for notifications before they block
+    /// @return the spin duration, zero when spinning is disabled
+    units::Duration getSpinDuration() const noexcept;
+
+    /// @brief Returns a file descriptor which becomes readable when the ConditionListener is notified, so that the
+    /// notifications can be multiplexed with other file descriptors in an existing event loop. The notifications are
+    /// collected with a call to timedWait() with a zero duration after the file descriptor became readable. The
+    /// file descriptor is created with the first call and stays valid as long as the ConditionListener exists.
+    /// @return the file descriptor or the error why it could not be created
+    expected<int32_t, NotificationSocketError> getFileDescriptor() noexcept;
+
+    /// @brief Keeps the file descriptor readable while already collected notifications are pending, e.g. due to a
+    /// limit of the caller, and otherwise removes the readability which was only kept for them; does nothing when
+    /// there is no file descriptor
+    /// @param[in] hasPendingNotifications true when collected notifications were not yet processed
+    void updateFileDescriptor(const bool hasPendingNotifications) noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
@@ -72,11 +100,14 @@ class ConditionListener
     void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const function_ref<bool()>& waitCall, const units::Duration spinDuration) noexcept;
+    bool spinUntilNotified(const units::Duration spinDuration) const noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    std::atomic<uint64_t> m_spinDurationInNanoseconds{0U};
+    optional<NotificationSocket> m_notificationSocket;
 };
 
 } // namespace popo
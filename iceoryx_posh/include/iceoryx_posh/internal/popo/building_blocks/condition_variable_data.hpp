@@ -29,6 +29,8 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    static constexpr uint64_t INVALID_NOTIFICATION_SOCKET_ID{0U};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -43,6 +45,9 @@ struct ConditionVariableData
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief id of the NotificationSocket which is notified in addition to the semaphore to make the notifications
+    /// pollable; INVALID_NOTIFICATION_SOCKET_ID when no socket is registered
+    std::atomic<uint64_t> m_notificationSocketId{INVALID_NOTIFICATION_SOCKET_ID};
 };
 
 } // namespace popo
@@ -0,0 +1,67 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/function_ref.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lock-free list of the ports which requested a discovery run, e.g. by offer or subscribe. It is placed in the
+/// shared memory; the ports mark themselves by their position in the PortPool and RouDi collects the marked positions,
+/// which makes the discovery proportional to the number of changed ports instead of the number of all ports.
+/// @note marking is wait-free and can be done concurrently by multiple processes, collecting is restricted to a
+/// single consumer; a port which is marked multiple times before the next collection is collected only once
+class DirtyPortList
+{
+  public:
+    static constexpr uint64_t CAPACITY{algorithm::maxVal(MAX_PUBLISHERS, MAX_SUBSCRIBERS, MAX_CLIENTS, MAX_SERVERS)};
+
+    DirtyPortList() noexcept;
+
+    DirtyPortList(const DirtyPortList&) = delete;
+    DirtyPortList(DirtyPortList&&) = delete;
+    DirtyPortList& operator=(const DirtyPortList&) = delete;
+    DirtyPortList& operator=(DirtyPortList&&) = delete;
+    ~DirtyPortList() noexcept = default;
+
+    /// @brief Marks the port at the provided position as dirty
+    /// @param[in] index of the port; indices greater or equal to CAPACITY are ignored
+    void mark(const uint64_t index) noexcept;
+
+    /// @brief Calls the callback in ascending order with the index of every marked port and removes the marks
+    /// @param[in] callback which is called with the index of a marked port
+    void collect(const function_ref<void(const uint64_t)> callback) noexcept;
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(CAPACITY + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    std::atomic<uint64_t> m_words[NUMBER_OF_WORDS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DIRTY_PORT_LIST_HPP
@@ -0,0 +1,97 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class NotificationSocketError : uint8_t
+{
+    NOT_SUPPORTED,
+    UNABLE_TO_CREATE_SOCKET,
+};
+
+/// @brief Makes the notifications of a ConditionVariableData pollable with epoll, poll or select. The listening side
+/// owns a datagram socket in the abstract socket namespace of Linux and registers it in the ConditionVariableData.
+/// Every ConditionNotifier sends an empty datagram to the registered socket after the notification is set, therefore
+/// the file descriptor becomes readable without a thread which waits on the semaphore.
+/// @note An eventfd cannot be used since the notifiers live in other processes and only have access to the shared
+/// memory; a socket in the abstract namespace can be addressed by its name from any process and is removed by the
+/// kernel when the owning process terminates.
+/// @note The abstract socket namespace is separate for every network namespace. A notifier in another network
+/// namespace than the listener, e.g. in a container with its own network, only posts the semaphore and the file
+/// descriptor does not become readable; the first notification which cannot be delivered is logged.
+class NotificationSocket
+{
+  public:
+    /// @brief Creates the socket and registers it in the ConditionVariableData
+    /// @param[in] condVarData whose notifications shall become pollable
+    /// @return the NotificationSocket or NOT_SUPPORTED on platforms without an abstract socket namespace
+    static expected<NotificationSocket, NotificationSocketError> create(ConditionVariableData& condVarData) noexcept;
+
+    NotificationSocket(const NotificationSocket&) = delete;
+    NotificationSocket(NotificationSocket&& rhs) noexcept;
+    NotificationSocket& operator=(const NotificationSocket&) = delete;
+    NotificationSocket& operator=(NotificationSocket&& rhs) noexcept;
+
+    /// @brief Unregisters the socket from the ConditionVariableData and closes it
+    ~NotificationSocket() noexcept;
+
+    /// @brief Returns the file descriptor which becomes readable when the ConditionVariableData is notified
+    int32_t getFileDescriptor() const noexcept;
+
+    /// @brief Removes all pending datagrams, i.e. the file descriptor is no longer readable until the next
+    /// notification. Must be called before the notifications are collected so that no notification is lost.
+    void drain() noexcept;
+
+    /// @brief Makes the file descriptor readable again until the next drain without a notification, e.g. since
+    /// collected notifications are still pending
+    void rearm() noexcept;
+
+    /// @brief Drains the file descriptor when it was rearmed, i.e. removes the readability of rearm(); datagrams of
+    /// notifications which arrived meanwhile are drained as well
+    void disarm() noexcept;
+
+    /// @brief Sends a datagram to the socket which is registered in the ConditionVariableData; does nothing when no
+    /// socket is registered
+    /// @param[in] condVarData which was notified
+    static void sendNotification(const ConditionVariableData& condVarData) noexcept;
+
+  private:
+    NotificationSocket(ConditionVariableData& condVarData, const uint64_t socketId, const int32_t fd) noexcept;
+
+    void destroy() noexcept;
+
+    static constexpr int32_t INVALID_FD{-1};
+
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    uint64_t m_socketId{ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID};
+    int32_t m_fd{INVALID_FD};
+    bool m_isRearmed{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_NOTIFICATION_SOCKET_HPP
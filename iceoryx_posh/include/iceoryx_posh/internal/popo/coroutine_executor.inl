@@ -0,0 +1,321 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_COROUTINE_EXECUTOR_INL
+#define IOX_POSH_POPO_COROUTINE_EXECUTOR_INL
+
+#include "iceoryx_posh/popo/coroutine_executor.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+inline CoroutineTask CoroutineTask::promise_type::get_return_object() noexcept
+{
+    return CoroutineTask(Handle_t::from_promise(*this));
+}
+
+inline std::suspend_always CoroutineTask::promise_type::initial_suspend() const noexcept
+{
+    return {};
+}
+
+inline std::suspend_always CoroutineTask::promise_type::final_suspend() const noexcept
+{
+    return {};
+}
+
+inline void CoroutineTask::promise_type::return_void() const noexcept
+{
+}
+
+inline void CoroutineTask::promise_type::unhandled_exception() const noexcept
+{
+    std::terminate();
+}
+
+inline CoroutineTask::CoroutineTask(const Handle_t handle) noexcept
+    : m_handle(handle)
+{
+}
+
+inline CoroutineTask::CoroutineTask(CoroutineTask&& rhs) noexcept
+    : m_handle(std::exchange(rhs.m_handle, nullptr))
+{
+}
+
+inline CoroutineTask& CoroutineTask::operator=(CoroutineTask&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+        m_handle = std::exchange(rhs.m_handle, nullptr);
+    }
+    return *this;
+}
+
+inline CoroutineTask::~CoroutineTask() noexcept
+{
+    if (m_handle)
+    {
+        m_handle.destroy();
+    }
+}
+
+inline CoroutineTask::Handle_t CoroutineTask::release() noexcept
+{
+    return std::exchange(m_handle, nullptr);
+}
+
+namespace internal
+{
+template <typename PortT>
+constexpr SubscriberState dataAvailableState(const BaseSubscriber<PortT>&) noexcept
+{
+    return SubscriberState::HAS_DATA;
+}
+
+template <typename PortT, typename TriggerHandleT>
+constexpr ClientState dataAvailableState(const BaseClient<PortT, TriggerHandleT>&) noexcept
+{
+    return ClientState::HAS_RESPONSE;
+}
+
+template <typename PortT, typename TriggerHandleT>
+constexpr ServerState dataAvailableState(const BaseServer<PortT, TriggerHandleT>&) noexcept
+{
+    return ServerState::HAS_REQUEST;
+}
+
+constexpr bool isNoDataAvailable(const ChunkReceiveResult result) noexcept
+{
+    return result == ChunkReceiveResult::NO_CHUNK_AVAILABLE;
+}
+
+constexpr bool isNoDataAvailable(const ServerRequestResult result) noexcept
+{
+    return result == ServerRequestResult::NO_PENDING_REQUESTS;
+}
+} // namespace internal
+
+template <typename Port, typename State, uint64_t Capacity>
+inline TakeAwaitable<Port, State, Capacity>::TakeAwaitable(CoroutineExecutor<Capacity>& executor,
+                                                           Port& port,
+                                                           const State dataAvailableState) noexcept
+    : m_executor(executor)
+    , m_port(port)
+    , m_dataAvailableState(dataAvailableState)
+{
+}
+
+template <typename Port, typename State, uint64_t Capacity>
+inline bool TakeAwaitable<Port, State, Capacity>::await_ready() noexcept
+{
+    return tryComplete();
+}
+
+template <typename Port, typename State, uint64_t Capacity>
+inline bool TakeAwaitable<Port, State, Capacity>::await_suspend(std::coroutine_handle<> continuation) noexcept
+{
+    m_continuation = continuation;
+    // when the port cannot be awaited the coroutine is resumed immediately with the failed 'take' result
+    return m_executor.suspend(*this, m_port, m_dataAvailableState);
+}
+
+template <typename Port, typename State, uint64_t Capacity>
+inline typename TakeAwaitable<Port, State, Capacity>::Result_t
+TakeAwaitable<Port, State, Capacity>::await_resume() noexcept
+{
+    return std::move(m_result.value());
+}
+
+template <typename Port, typename State, uint64_t Capacity>
+inline bool TakeAwaitable<Port, State, Capacity>::tryComplete() noexcept
+{
+    m_result.emplace(m_port.take());
+    return !m_result->has_error() || !internal::isNoDataAvailable(m_result->get_error());
+}
+
+template <typename Port, typename State, uint64_t Capacity>
+inline void TakeAwaitable<Port, State, Capacity>::detach() noexcept
+{
+    m_executor.m_waitSet.detachState(m_port, m_dataAvailableState);
+}
+
+template <uint64_t Capacity>
+inline CoroutineExecutor<Capacity>::ExecutorWaitSet::ExecutorWaitSet(ConditionVariableData& condVarData) noexcept
+    : WaitSet<Capacity>(condVarData)
+{
+}
+
+template <uint64_t Capacity>
+inline CoroutineExecutor<Capacity>::CoroutineExecutor(ConditionVariableData& condVarData) noexcept
+    : m_waitSet(condVarData)
+{
+}
+
+template <uint64_t Capacity>
+inline CoroutineExecutor<Capacity>::~CoroutineExecutor() noexcept
+{
+    for (auto* awaiter : m_awaiters)
+    {
+        if (awaiter != nullptr)
+        {
+            awaiter->detach();
+        }
+    }
+
+    for (auto& task : m_tasks)
+    {
+        task.destroy();
+    }
+}
+
+template <uint64_t Capacity>
+inline expected<CoroutineExecutorError> CoroutineExecutor<Capacity>::spawn(CoroutineTask&& task) noexcept
+{
+    if (m_tasks.size() == m_tasks.capacity())
+    {
+        return error<CoroutineExecutorError>(CoroutineExecutorError::TASK_CAPACITY_EXCEEDED);
+    }
+
+    auto handle = task.release();
+    m_tasks.emplace_back(handle);
+    m_readyCoroutines.emplace_back(handle);
+    return success<>();
+}
+
+template <uint64_t Capacity>
+template <typename Port>
+inline TakeAwaitable<Port, decltype(internal::dataAvailableState(std::declval<Port&>())), Capacity>
+CoroutineExecutor<Capacity>::take(Port& port) noexcept
+{
+    return {*this, port, internal::dataAvailableState(port)};
+}
+
+template <uint64_t Capacity>
+template <typename Port, typename State>
+inline TakeAwaitable<Port, State, Capacity> CoroutineExecutor<Capacity>::take(Port& port,
+                                                                             const State dataAvailableState) noexcept
+{
+    return {*this, port, dataAvailableState};
+}
+
+template <uint64_t Capacity>
+template <typename Port, typename State>
+inline bool CoroutineExecutor<Capacity>::suspend(internal::CoroutineAwaiter& awaiter,
+                                                 Port& port,
+                                                 const State dataAvailableState) noexcept
+{
+    for (uint64_t id = 0U; id < Capacity; ++id)
+    {
+        if (m_awaiters[id] != nullptr)
+        {
+            continue;
+        }
+
+        // the WaitSet notifies immediately when the state is already set, therefore no data is missed between the
+        // failed 'take' and the attachment
+        auto result = m_waitSet.attachState(port, dataAvailableState, id);
+        if (result.has_error())
+        {
+            IOX_LOG(ERROR) << "Unable to await the port since it could not be attached to the WaitSet";
+            return false;
+        }
+        m_awaiters[id] = &awaiter;
+        return true;
+    }
+
+    IOX_LOG(ERROR) << "Unable to await the port since " << Capacity << " ports are already awaited";
+    return false;
+}
+
+template <uint64_t Capacity>
+inline void CoroutineExecutor<Capacity>::run() noexcept
+{
+    while (!m_stopRequested)
+    {
+        resumeReadyCoroutines();
+        destroyFinishedTasks();
+        if (m_tasks.empty() || m_stopRequested)
+        {
+            return;
+        }
+
+        // the WaitSet returns without notifications after stop() was called, the loop condition ends the run then
+        IOX_DISCARD_RESULT(m_waitSet.wait([this](const NotificationInfo& notificationInfo) {
+            const auto id = notificationInfo.getNotificationId();
+            auto* awaiter = m_awaiters[id];
+            // the state is still set when another consumer took the data meanwhile, the coroutine keeps waiting then
+            if (awaiter != nullptr && awaiter->tryComplete())
+            {
+                awaiter->detach();
+                m_awaiters[id] = nullptr;
+                m_readyCoroutines.emplace_back(awaiter->m_continuation);
+            }
+        }));
+    }
+}
+
+template <uint64_t Capacity>
+inline void CoroutineExecutor<Capacity>::stop() noexcept
+{
+    m_stopRequested = true;
+    m_waitSet.markForDestruction();
+}
+
+template <uint64_t Capacity>
+inline uint64_t CoroutineExecutor<Capacity>::numberOfTasks() const noexcept
+{
+    return m_tasks.size();
+}
+
+template <uint64_t Capacity>
+inline void CoroutineExecutor<Capacity>::resumeReadyCoroutines() noexcept
+{
+    // a resumed task can spawn further tasks which are appended and resumed in the same run
+    for (uint64_t i = 0U; i < m_readyCoroutines.size(); ++i)
+    {
+        m_readyCoroutines[i].resume();
+    }
+    m_readyCoroutines.clear();
+}
+
+template <uint64_t Capacity>
+inline void CoroutineExecutor<Capacity>::destroyFinishedTasks() noexcept
+{
+    for (uint64_t i = 0U; i < m_tasks.size();)
+    {
+        if (m_tasks[i].done())
+        {
+            m_tasks[i].destroy();
+            m_tasks.erase(m_tasks.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_COROUTINE_EXECUTOR_INL
@@ -26,7 +26,8 @@ template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline expected<ListenerError>
 ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
-                                    const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const NotificationPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -39,7 +40,8 @@ ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
                     typeid(NoEnumUsed).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
@@ -49,8 +51,11 @@ ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
 
 template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline expected<ListenerError> ListenerImpl<Capacity>::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<ListenerError>
+ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
+                                    const EventType eventType,
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const NotificationPriority priority) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -63,7 +68,8 @@ inline expected<ListenerError> ListenerImpl<Capacity>::attachEvent(
                     typeid(EventType).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    priority)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
@@ -101,10 +107,28 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+inline ListenerImpl<Capacity>::ListenerImpl(const uint64_t numberOfWorkerThreads) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), numberOfWorkerThreads)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const uint64_t numberOfWorkerThreads) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    if (numberOfWorkerThreads > m_workerThreads.capacity())
+    {
+        IOX_LOG(WARN) << "The Listener supports at most " << m_workerThreads.capacity() << " worker threads but "
+                      << numberOfWorkerThreads << " were requested; only " << m_workerThreads.capacity()
+                      << " worker threads are started";
+    }
+
+    for (uint64_t i = 0U; i < numberOfWorkerThreads && i < m_workerThreads.capacity(); ++i)
+    {
+        m_workerThreads.emplace_back(&ListenerImpl<Capacity>::workerLoop, this);
+    }
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
 
@@ -115,6 +139,17 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    {
+        std::lock_guard<std::mutex> lock(m_workerMutex);
+        m_stopWorkers = true;
+    }
+    m_workerWakeup.notify_all();
+    for (auto& workerThread : m_workerThreads)
+    {
+        workerThread.join();
+    }
+
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -126,7 +161,8 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
                                  const uint64_t eventTypeHash,
                                  internal::GenericCallbackRef_t callback,
                                  internal::TranslationCallbackRef_t translationCallback,
-                                 const function<void(uint64_t)> invalidationCallback) noexcept
+                                 const function<void(uint64_t)> invalidationCallback,
+                                 const NotificationPriority priority) noexcept
 {
     std::lock_guard<std::mutex> lock(m_addEventMutex);
 
@@ -146,6 +182,12 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
 
     m_events[index]->init(
         index, origin, userType, eventType, eventTypeHash, callback, translationCallback, invalidationCallback);
+    // the priority is set before the event is enabled, therefore it is known when the event is notified
+    m_eventPriorities[index].store(priority, std::memory_order_relaxed);
+    if (priority != DEFAULT_NOTIFICATION_PRIORITY)
+    {
+        m_numberOfPrioritizedEvents.fetch_add(1U, std::memory_order_relaxed);
+    }
     return success<uint32_t>(index);
 }
 
@@ -155,6 +197,18 @@ inline uint64_t ListenerImpl<Capacity>::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_conditionListener.setSpinDuration(spinDuration);
+}
+
+template <uint64_t Capacity>
+inline units::Duration ListenerImpl<Capacity>::getSpinDuration() const noexcept
+{
+    return m_conditionListener.getSpinDuration();
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::threadLoop() noexcept
 {
@@ -162,6 +216,19 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
     {
         auto activateNotificationIds = m_conditionListener.wait();
 
+        if (m_numberOfPrioritizedEvents.load(std::memory_order_relaxed) != 0U)
+        {
+            internal::sortByDescendingPriority(activateNotificationIds, [this](const uint64_t id) {
+                return m_eventPriorities[id].load(std::memory_order_relaxed);
+            });
+        }
+
+        if (!m_workerThreads.empty())
+        {
+            scheduleCallbacks(activateNotificationIds);
+            continue;
+        }
+
         for (auto& id : activateNotificationIds)
         {
             m_events[id]->executeCallback();
@@ -169,6 +236,112 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
     }
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::scheduleCallbacks(const ConditionListener::NotificationVector_t& eventIds) noexcept
+{
+    bool hasScheduledEvents{false};
+    {
+        std::lock_guard<std::mutex> lock(m_workerMutex);
+        for (const auto id : eventIds)
+        {
+            auto& dispatchState = m_dispatchStates[id];
+            if (dispatchState == DispatchState::IDLE)
+            {
+                dispatchState = DispatchState::SCHEDULED;
+                pushScheduledEvent(id);
+                hasScheduledEvents = true;
+            }
+            else if (dispatchState == DispatchState::RUNNING)
+            {
+                // the worker which executes the callback schedules it again when it is finished
+                dispatchState = DispatchState::RUNNING_AND_NOTIFIED;
+            }
+        }
+    }
+
+    if (hasScheduledEvents)
+    {
+        m_workerWakeup.notify_all();
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::workerLoop() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_workerMutex);
+    while (true)
+    {
+        m_workerWakeup.wait(lock, [this] { return m_stopWorkers || m_numberOfScheduledEvents > 0U; });
+        if (m_stopWorkers)
+        {
+            return;
+        }
+
+        const auto id = popScheduledEvent();
+        m_dispatchStates[id] = DispatchState::RUNNING;
+
+        lock.unlock();
+        m_events[id]->executeCallback();
+        lock.lock();
+
+        if (m_dispatchStates[id] == DispatchState::RUNNING_AND_NOTIFIED)
+        {
+            // the event is scheduled behind all other pending events to not starve them
+            m_dispatchStates[id] = DispatchState::SCHEDULED;
+            pushScheduledEvent(id);
+        }
+        else
+        {
+            m_dispatchStates[id] = DispatchState::IDLE;
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::pushScheduledEvent(const uint64_t eventId) noexcept
+{
+    m_scheduledEvents[(m_scheduledEventsBegin + m_numberOfScheduledEvents) % Capacity] = eventId;
+    ++m_numberOfScheduledEvents;
+}
+
+template <uint64_t Capacity>
+inline uint64_t ListenerImpl<Capacity>::popScheduledEvent() noexcept
+{
+    const auto eventId = m_scheduledEvents[m_scheduledEventsBegin];
+    m_scheduledEventsBegin = (m_scheduledEventsBegin + 1U) % Capacity;
+    --m_numberOfScheduledEvents;
+    return eventId;
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::resetDispatchState(const uint64_t eventId) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_workerMutex);
+    auto& dispatchState = m_dispatchStates[eventId];
+    if (dispatchState == DispatchState::SCHEDULED)
+    {
+        // the scheduled event is removed from the ring buffer, otherwise an event which is attached to the same index
+        // would be executed without being notified
+        uint64_t numberOfRemainingEvents{0U};
+        for (uint64_t i = 0U; i < m_numberOfScheduledEvents; ++i)
+        {
+            const auto id = m_scheduledEvents[(m_scheduledEventsBegin + i) % Capacity];
+            if (id != eventId)
+            {
+                m_scheduledEvents[(m_scheduledEventsBegin + numberOfRemainingEvents) % Capacity] = id;
+                ++numberOfRemainingEvents;
+            }
+        }
+        m_numberOfScheduledEvents = numberOfRemainingEvents;
+        dispatchState = DispatchState::IDLE;
+    }
+    else if (dispatchState == DispatchState::RUNNING_AND_NOTIFIED)
+    {
+        // the worker which executes the callback sets the state to IDLE when it is finished
+        dispatchState = DispatchState::RUNNING;
+    }
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
 {
@@ -179,6 +352,12 @@ inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
 
     if (m_events[index]->reset())
     {
+        if (m_eventPriorities[index].exchange(DEFAULT_NOTIFICATION_PRIORITY, std::memory_order_relaxed)
+            != DEFAULT_NOTIFICATION_PRIORITY)
+        {
+            m_numberOfPrioritizedEvents.fetch_sub(1U, std::memory_order_relaxed);
+        }
+        resetDispatchState(index);
         m_indexManager.push(static_cast<uint32_t>(index));
     }
 }
@@ -83,6 +83,10 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Wakes up the RouDi discovery loop in order to process a changed port state without waiting for the
+    ///        periodic discovery run; does nothing when the port is not attached to a discovery condition variable
+    void notifyDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
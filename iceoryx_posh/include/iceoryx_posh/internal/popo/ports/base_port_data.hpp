@@ -20,6 +20,8 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -54,6 +56,19 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief Set by RouDi when the port is disconnected since its runtime terminated and only its chunks are left to
+    ///        be released; it is only accessed by RouDi
+    bool m_toBeReclaimed{false};
+
+    /// @brief RouDi is notified via this condition variable whenever the port requests a discovery run, e.g. on
+    ///        offer or subscribe; it is set by the PortPool when the port is added
+    RelativePointer<ConditionVariableData> m_discoveryConditionVariableDataPtr;
+
+    /// @brief The port marks itself in this list with m_dirtyPortListIndex before notifying the discovery, so that
+    ///        RouDi only has to process the changed ports; both are set by the PortPool when the port is added
+    RelativePointer<DirtyPortList> m_dirtyPortListPtr;
+    uint64_t m_dirtyPortListIndex{0U};
 };
 
 } // namespace popo
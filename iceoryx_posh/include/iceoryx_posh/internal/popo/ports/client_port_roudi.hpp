@@ -68,7 +68,8 @@ class ClientPortRouDi : public BasePort
 
     /// @brief cleanup the client and release all the chunks it currently holds
     /// @attention Contract is that user process is no more running when cleanup is called
-    void releaseAllChunks() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void releaseAllChunks(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   private:
     const MemberType_t* getMembers() const noexcept;
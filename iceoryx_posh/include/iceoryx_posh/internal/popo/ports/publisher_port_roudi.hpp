@@ -62,7 +62,8 @@ class PublisherPortRouDi : public BasePort
 
     /// @brief cleanup the publisher and release all the chunks it currently holds
     /// Caution: Contract is that user process is no more running when cleanup is called
-    void releaseAllChunks() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void releaseAllChunks(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   private:
     const MemberType_t* getMembers() const noexcept;
@@ -73,6 +73,14 @@ class PublisherPortUser : public BasePort
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
+    /// @brief get the histogram of the time between two consecutive sends
+    /// @return snapshot of the send interval histogram in nanoseconds; empty if publish timestamps are disabled
+    Histogram getSendIntervalHistogram() const noexcept;
+
+    /// @brief enable or disable the recording of the send interval histogram
+    /// @param[in] enable true to record the send intervals, false to skip them
+    void setSendIntervalHistogramEnabled(const bool enable) noexcept;
+
     /// @brief offer this publiher port in the system
     void offer() noexcept;
 
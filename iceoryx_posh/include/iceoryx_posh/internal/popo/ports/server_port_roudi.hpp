@@ -65,7 +65,8 @@ class ServerPortRouDi : public BasePort
 
     /// @brief cleanup the server and release all the chunks it currently holds
     /// Caution: Contract is that user process is no more running when cleanup is called
-    void releaseAllChunks() noexcept;
+    /// @param[in] report optionally counts the released chunks per mempool
+    void releaseAllChunks(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   private:
     const MemberType_t* getMembers() const noexcept;
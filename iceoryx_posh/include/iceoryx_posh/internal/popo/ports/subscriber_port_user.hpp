@@ -82,6 +82,18 @@ class SubscriberPortUser : public BasePort
     /// @return true if the underlying queue overflowed since last call of this method, otherwise false
     bool hasLostChunksSinceLastCall() noexcept;
 
+    /// @brief get the number of chunks which were lost due to a queue overflow since the creation of the port
+    /// @return number of lost chunks
+    uint64_t getLostChunksCount() const noexcept;
+
+    /// @brief get the highest number of chunks which were in the queue at the same time
+    /// @return maximum fill level of the queue
+    uint64_t getMaximumQueueFillLevel() const noexcept;
+
+    /// @brief get the number of chunks which were delivered to the queue since the creation of the port
+    /// @return number of received chunks
+    uint64_t getReceivedChunksCount() const noexcept;
+
     /// @brief attach a condition variable (via its pointer) to subscriber
     void setConditionVariable(ConditionVariableData& conditionVariableData, const uint64_t notificationIndex) noexcept;
 
@@ -92,6 +104,18 @@ class SubscriberPortUser : public BasePort
     /// @return true if a condition variable attached, otherwise false
     bool isConditionVariableSet() noexcept;
 
+    /// @brief get the histogram of the time between sending and taking of the chunks with a publish timestamp
+    /// @return snapshot of the latency histogram in nanoseconds
+    Histogram getLatencyHistogram() const noexcept;
+
+    /// @brief get the histogram of the number of chunks in the queue right after a chunk was pushed
+    /// @return snapshot of the queue depth histogram
+    Histogram getQueueDepthHistogram() const noexcept;
+
+    /// @brief enable or disable the recording of the queue depth histogram
+    /// @param[in] enable true to record the queue depth on every push, false to skip it
+    void setQueueDepthHistogramEnabled(const bool enable) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -61,9 +62,10 @@ class UsedChunkList
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
     /// @brief Cleans up all the remaining chunks from the list.
+    /// @param[in] report optionally counts the released chunks per mempool
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
-    void cleanup() noexcept;
+    void cleanup(mepoo::ChunkReclamationReport* const report = nullptr) noexcept;
 
   private:
     void init() noexcept;
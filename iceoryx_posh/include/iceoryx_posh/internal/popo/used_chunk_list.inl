@@ -103,7 +103,7 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
 }
 
 template <uint32_t Capacity>
-void UsedChunkList<Capacity>::cleanup() noexcept
+void UsedChunkList<Capacity>::cleanup(mepoo::ChunkReclamationReport* const report) noexcept
 {
     m_synchronizer.test_and_set(std::memory_order_acquire);
 
@@ -112,7 +112,11 @@ void UsedChunkList<Capacity>::cleanup() noexcept
         if (!data.isLogicalNullptr())
         {
             // release ownership by creating a SharedChunk
-            data.releaseToSharedChunk();
+            auto chunk = data.releaseToSharedChunk();
+            if (report != nullptr)
+            {
+                report->count(chunk);
+            }
         }
     }
 
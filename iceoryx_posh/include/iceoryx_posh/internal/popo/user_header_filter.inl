@@ -0,0 +1,39 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_USER_HEADER_FILTER_INL
+#define IOX_POSH_POPO_USER_HEADER_FILTER_INL
+
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+inline expected<UserHeaderFilterError> UserHeaderFilter::addCondition(const uint32_t offset,
+                                                                      const UserHeaderFieldComparison comparison,
+                                                                      const T value) noexcept
+{
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                  "The user-header field must be an unsigned integer");
+    return addCondition(offset, static_cast<uint32_t>(sizeof(T)), comparison, static_cast<uint64_t>(value));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_USER_HEADER_FILTER_INL
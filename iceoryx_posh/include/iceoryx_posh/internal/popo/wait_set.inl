@@ -109,7 +109,8 @@ WaitSet<Capacity>::attachImpl(T& eventOrigin,
                               const uint64_t eventId,
                               const NotificationCallback<T, ContextDataType>& eventCallback,
                               const uint64_t originType,
-                              const uint64_t originTypeHash) noexcept
+                              const uint64_t originTypeHash,
+                              const NotificationPriority priority) noexcept
 {
     for (auto& currentTrigger : m_triggerArray)
     {
@@ -151,6 +152,12 @@ WaitSet<Capacity>::attachImpl(T& eventOrigin,
                                        originTypeHash);
     }
 
+    m_triggerPriorities[*index] = priority;
+    if (priority != DEFAULT_NOTIFICATION_PRIORITY)
+    {
+        ++m_numberOfPrioritizedTriggers;
+    }
+
     return success<uint64_t>(*index);
 }
 
@@ -160,7 +167,8 @@ inline expected<WaitSetError>
 WaitSet<Capacity>::attachEvent(T& eventOrigin,
                                const EventType eventType,
                                const uint64_t eventId,
-                               const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
     static_assert(IS_EVENT_ENUM<EventType>, "Only enums with an underlying EventEnumIdentifier are allowed.");
 
@@ -169,7 +177,8 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
                       eventId,
                       eventCallback,
                       static_cast<uint64_t>(eventType),
-                      typeid(EventType).hash_code())
+                      typeid(EventType).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
@@ -180,23 +189,30 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
 
 template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline expected<WaitSetError> WaitSet<Capacity>::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<WaitSetError>
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const EventType eventType,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachEvent(eventOrigin, eventType, NotificationInfo::INVALID_ID, eventCallback);
+    return attachEvent(eventOrigin, eventType, NotificationInfo::INVALID_ID, eventCallback, priority);
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
-inline expected<WaitSetError> WaitSet<Capacity>::attachEvent(
-    T& eventOrigin, const uint64_t eventId, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<WaitSetError>
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const uint64_t eventId,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
     return attachImpl(eventOrigin,
                       nullopt,
                       eventId,
                       eventCallback,
                       static_cast<uint64_t>(NoEventEnumUsed::PLACEHOLDER),
-                      typeid(NoEventEnumUsed).hash_code())
+                      typeid(NoEventEnumUsed).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
                 eventOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
@@ -206,9 +222,11 @@ inline expected<WaitSetError> WaitSet<Capacity>::attachEvent(
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline expected<WaitSetError>
-WaitSet<Capacity>::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+WaitSet<Capacity>::attachEvent(T& eventOrigin,
+                               const NotificationCallback<T, ContextDataType>& eventCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachEvent(eventOrigin, NotificationInfo::INVALID_ID, eventCallback);
+    return attachEvent(eventOrigin, NotificationInfo::INVALID_ID, eventCallback, priority);
 }
 
 template <uint64_t Capacity>
@@ -217,7 +235,8 @@ inline expected<WaitSetError>
 WaitSet<Capacity>::attachState(T& stateOrigin,
                                const StateType stateType,
                                const uint64_t id,
-                               const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
     static_assert(IS_STATE_ENUM<StateType>, "Only enums with an underlying StateEnumIdentifier are allowed.");
     auto hasTriggeredCallback = NotificationAttorney::getCallbackForIsStateConditionSatisfied(stateOrigin, stateType);
@@ -227,7 +246,8 @@ WaitSet<Capacity>::attachState(T& stateOrigin,
                       id,
                       stateCallback,
                       static_cast<uint64_t>(stateType),
-                      typeid(StateType).hash_code())
+                      typeid(StateType).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableState(
                 stateOrigin,
@@ -244,16 +264,22 @@ WaitSet<Capacity>::attachState(T& stateOrigin,
 
 template <uint64_t Capacity>
 template <typename T, typename StateType, typename ContextDataType, typename>
-inline expected<WaitSetError> WaitSet<Capacity>::attachState(
-    T& stateOrigin, const StateType stateType, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+inline expected<WaitSetError>
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const StateType stateType,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachState(stateOrigin, stateType, NotificationInfo::INVALID_ID, stateCallback);
+    return attachState(stateOrigin, stateType, NotificationInfo::INVALID_ID, stateCallback, priority);
 }
 
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
-inline expected<WaitSetError> WaitSet<Capacity>::attachState(
-    T& stateOrigin, const uint64_t id, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+inline expected<WaitSetError>
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const uint64_t id,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
     auto hasTriggeredCallback = NotificationAttorney::getCallbackForIsStateConditionSatisfied(stateOrigin);
     return attachImpl(stateOrigin,
@@ -261,7 +287,8 @@ inline expected<WaitSetError> WaitSet<Capacity>::attachState(
                       id,
                       stateCallback,
                       static_cast<uint64_t>(NoStateEnumUsed::PLACEHOLDER),
-                      typeid(NoStateEnumUsed).hash_code())
+                      typeid(NoStateEnumUsed).hash_code(),
+                      priority)
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableState(
                 stateOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
@@ -277,9 +304,11 @@ inline expected<WaitSetError> WaitSet<Capacity>::attachState(
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline expected<WaitSetError>
-WaitSet<Capacity>::attachState(T& stateOrigin, const NotificationCallback<T, ContextDataType>& stateCallback) noexcept
+WaitSet<Capacity>::attachState(T& stateOrigin,
+                               const NotificationCallback<T, ContextDataType>& stateCallback,
+                               const NotificationPriority priority) noexcept
 {
-    return attachState(stateOrigin, NotificationInfo::INVALID_ID, stateCallback);
+    return attachState(stateOrigin, NotificationInfo::INVALID_ID, stateCallback, priority);
 }
 
 template <uint64_t Capacity>
@@ -305,6 +334,11 @@ inline void WaitSet<Capacity>::removeTrigger(const uint64_t uniqueTriggerId) noe
         {
             trigger->invalidate();
             trigger.reset();
+            if (m_triggerPriorities[uniqueTriggerId] != DEFAULT_NOTIFICATION_PRIORITY)
+            {
+                m_triggerPriorities[uniqueTriggerId] = DEFAULT_NOTIFICATION_PRIORITY;
+                --m_numberOfPrioritizedTriggers;
+            }
             cxx::Ensures(m_indexRepository.push(uniqueTriggerId));
             return;
         }
@@ -324,47 +358,180 @@ template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::timedWait(const units::Duration timeout) noexcept
 {
-    return waitAndReturnTriggeredTriggers([this, timeout] { return this->m_conditionListener.timedWait(timeout); });
+    NotificationInfoVector notificationInfos;
+    IOX_DISCARD_RESULT(timedWait(timeout, notificationInfos));
+    return notificationInfos;
 }
 
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wait() noexcept
 {
-    return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
+    NotificationInfoVector notificationInfos;
+    IOX_DISCARD_RESULT(wait(notificationInfos));
+    return notificationInfos;
 }
 
 template <uint64_t Capacity>
-inline typename WaitSet<Capacity>::NotificationInfoVector
-WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
+template <uint64_t BufferCapacity>
+inline uint64_t
+WaitSet<Capacity>::timedWait(const units::Duration timeout,
+                             vector<const NotificationInfo*, BufferCapacity>& notificationInfos) noexcept
+{
+    notificationInfos.clear();
+    return timedWait(
+        timeout,
+        [&](const NotificationInfo& notificationInfo) { cxx::Expects(notificationInfos.push_back(&notificationInfo)); },
+        BufferCapacity);
+}
+
+template <uint64_t Capacity>
+template <uint64_t BufferCapacity>
+inline uint64_t WaitSet<Capacity>::wait(vector<const NotificationInfo*, BufferCapacity>& notificationInfos) noexcept
+{
+    notificationInfos.clear();
+    return wait(
+        [&](const NotificationInfo& notificationInfo) { cxx::Expects(notificationInfos.push_back(&notificationInfo)); },
+        BufferCapacity);
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::timedWait(const units::Duration timeout,
+                                             const NotificationInfoCallback& callback,
+                                             const uint64_t maxNumberOfNotifications) noexcept
+{
+    return waitAndProcessTriggeredTriggers(
+        [this, timeout] { return this->m_conditionListener.timedWait(timeout); }, callback, maxNumberOfNotifications);
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::wait(const NotificationInfoCallback& callback,
+                                        const uint64_t maxNumberOfNotifications) noexcept
+{
+    return waitAndProcessTriggeredTriggers(
+        [this] { return this->m_conditionListener.wait(); }, callback, maxNumberOfNotifications);
+}
+
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_conditionListener.setSpinDuration(spinDuration);
+}
+
+template <uint64_t Capacity>
+inline units::Duration WaitSet<Capacity>::getSpinDuration() const noexcept
+{
+    return m_conditionListener.getSpinDuration();
+}
+
+template <uint64_t Capacity>
+inline expected<int32_t, NotificationSocketError> WaitSet<Capacity>::getFileDescriptor() noexcept
+{
+    return m_conditionListener.getFileDescriptor();
+}
+
+template <uint64_t Capacity>
+inline bool WaitSet<Capacity>::processTriggeredTrigger(const uint64_t index,
+                                                       const NotificationInfoCallback& callback,
+                                                       uint64_t& numberOfProcessedNotifications) noexcept
 {
-    NotificationInfoVector triggers;
-    if (!m_activeNotifications.empty())
+    auto& trigger = m_triggerArray[index];
+    bool doRemoveNotificationId = !static_cast<bool>(trigger);
+
+    if (!doRemoveNotificationId && trigger->isStateConditionSatisfied())
     {
-        for (uint64_t i = m_activeNotifications.size() - 1U;; --i)
-        {
-            auto index = m_activeNotifications[i];
-            auto& trigger = m_triggerArray[index];
-            bool doRemoveNotificationId = !static_cast<bool>(trigger);
+        // the trigger type is acquired before the callback is called since the callback could detach the trigger
+        doRemoveNotificationId = (trigger->getTriggerType() == TriggerType::EVENT_BASED);
+        ++numberOfProcessedNotifications;
+        callback(trigger->getNotificationInfo());
+    }
 
-            if (!doRemoveNotificationId && trigger->isStateConditionSatisfied())
-            {
-                cxx::Expects(triggers.push_back(&m_triggerArray[index]->getNotificationInfo()));
-                doRemoveNotificationId = (trigger->getTriggerType() == TriggerType::EVENT_BASED);
-            }
+    return doRemoveNotificationId;
+}
 
-            if (doRemoveNotificationId)
-            {
-                m_activeNotifications.erase(m_activeNotifications.begin() + i);
-            }
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::processTriggeredTriggers(const NotificationInfoCallback& callback,
+                                                            const uint64_t maxNumberOfNotifications) noexcept
+{
+    if (m_numberOfPrioritizedTriggers != 0U)
+    {
+        return processTriggeredTriggersByPriority(callback, maxNumberOfNotifications);
+    }
 
-            if (i == 0U)
-            {
-                break;
-            }
-        }
+    // the triggers are processed starting with the highest index; when the limit stopped the previous call, this one
+    // continues below the trigger which was processed last so that a continuously triggered trigger with a high index
+    // cannot starve the notifications which are left
+    const uint64_t numberOfActiveNotifications = m_activeNotifications.size();
+    uint64_t position{0U};
+    while (position < numberOfActiveNotifications && m_activeNotifications[position] < m_roundRobinIndexBound)
+    {
+        ++position;
+    }
+
+    bool doRemoveNotificationId[Capacity]{};
+    uint64_t numberOfProcessedNotifications{0U};
+    uint64_t numberOfVisitedNotifications{0U};
+    uint64_t lastVisitedIndex{Capacity};
+    // the notifications which are not processed due to the limit stay active and are processed with the next call
+    for (; numberOfVisitedNotifications < numberOfActiveNotifications
+           && numberOfProcessedNotifications < maxNumberOfNotifications;
+         ++numberOfVisitedNotifications)
+    {
+        position = (position == 0U) ? numberOfActiveNotifications - 1U : position - 1U;
+        lastVisitedIndex = m_activeNotifications[position];
+        doRemoveNotificationId[lastVisitedIndex] =
+            processTriggeredTrigger(lastVisitedIndex, callback, numberOfProcessedNotifications);
     }
+    m_roundRobinIndexBound =
+        (numberOfVisitedNotifications < numberOfActiveNotifications) ? lastVisitedIndex : Capacity;
+
+    removeProcessedNotifications(doRemoveNotificationId);
 
-    return triggers;
+    return numberOfProcessedNotifications;
+}
+
+template <uint64_t Capacity>
+inline uint64_t WaitSet<Capacity>::processTriggeredTriggersByPriority(const NotificationInfoCallback& callback,
+                                                                      const uint64_t maxNumberOfNotifications) noexcept
+{
+    // triggers with the same priority are processed in the same order as without priorities, i.e. starting with the
+    // highest index; m_activeNotifications itself must stay sorted by index for the merge with new notifications
+    ConditionListener::NotificationVector_t processingOrder;
+    for (uint64_t i = m_activeNotifications.size(); i > 0U; --i)
+    {
+        IOX_DISCARD_RESULT(processingOrder.emplace_back(m_activeNotifications[i - 1U]));
+    }
+    internal::sortByDescendingPriority(processingOrder,
+                                       [this](const uint64_t index) { return m_triggerPriorities[index]; });
+
+    bool doRemoveNotificationId[Capacity]{};
+    uint64_t numberOfProcessedNotifications{0U};
+    // the notifications which are not processed due to the limit stay active and are processed with the next call
+    for (uint64_t i = 0U; i < processingOrder.size() && numberOfProcessedNotifications < maxNumberOfNotifications; ++i)
+    {
+        const uint64_t index = processingOrder[i];
+        doRemoveNotificationId[index] = processTriggeredTrigger(index, callback, numberOfProcessedNotifications);
+    }
+
+    removeProcessedNotifications(doRemoveNotificationId);
+
+    return numberOfProcessedNotifications;
+}
+
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::removeProcessedNotifications(const bool (&doRemoveNotificationId)[Capacity]) noexcept
+{
+    uint64_t numberOfActiveNotifications{0U};
+    for (const auto index : m_activeNotifications)
+    {
+        if (!doRemoveNotificationId[index])
+        {
+            m_activeNotifications[numberOfActiveNotifications++] = index;
+        }
+    }
+    while (m_activeNotifications.size() > numberOfActiveNotifications)
+    {
+        IOX_DISCARD_RESULT(m_activeNotifications.pop_back());
+    }
 }
 
 template <uint64_t Capacity>
@@ -382,23 +549,33 @@ inline void WaitSet<Capacity>::acquireNotifications(const WaitFunction& wait) no
 }
 
 template <uint64_t Capacity>
-inline typename WaitSet<Capacity>::NotificationInfoVector
-WaitSet<Capacity>::waitAndReturnTriggeredTriggers(const WaitFunction& wait) noexcept
+inline uint64_t WaitSet<Capacity>::waitAndProcessTriggeredTriggers(const WaitFunction& wait,
+                                                                   const NotificationInfoCallback& callback,
+                                                                   const uint64_t maxNumberOfNotifications) noexcept
 {
+    if (maxNumberOfNotifications == 0U)
+    {
+        return 0U;
+    }
+
     if (m_conditionListener.wasNotified())
     {
         this->acquireNotifications(wait);
     }
 
-    NotificationInfoVector triggers = createVectorWithTriggeredTriggers();
+    auto numberOfProcessedNotifications = processTriggeredTriggers(callback, maxNumberOfNotifications);
 
-    if (!triggers.empty())
+    if (numberOfProcessedNotifications == 0U)
     {
-        return triggers;
+        acquireNotifications(wait);
+        numberOfProcessedNotifications = processTriggeredTriggers(callback, maxNumberOfNotifications);
     }
 
-    acquireNotifications(wait);
-    return createVectorWithTriggeredTriggers();
+    // the wait drained the file descriptor; notifications which are left due to the limit or a still satisfied
+    // state must keep it readable, otherwise an event loop polling it would not come back for them
+    m_conditionListener.updateFileDescriptor(!m_activeNotifications.empty());
+
+    return numberOfProcessedNotifications;
 }
 
 template <uint64_t Capacity>
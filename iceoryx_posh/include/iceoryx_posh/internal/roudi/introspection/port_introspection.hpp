@@ -181,6 +181,19 @@ class PortIntrospection
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
+        /// @brief prepare the port histograms; the histograms are copied after the internal mutex was released in
+        /// order to not block further introspection events for the duration of the copy
+        /// @param[out] topic data structure to be prepared for sending
+        void prepareTopic(PortHistogramIntrospectionFieldTopic& topic) noexcept;
+
+        /// @brief waits until a running copy of the port histograms is finished; this must be called after a port was
+        /// removed and before its data is destroyed since the copy might still access it
+        void waitForHistogramSnapshot() noexcept;
+
+        /// @brief enable or disable the recording of the histograms of all tracked ports and of the ports added later
+        /// @param[in] enable true to record the histograms, false to skip them
+        void setHistogramsEnabled(const bool enable) noexcept;
+
         /// @brief compute the next connection state based on the current connection state and a capro message type when
         /// the communication policy is OneToMany
         /// @param[in] currentState current connection state (e.g. CONNECTED)
@@ -227,6 +240,17 @@ class PortIntrospection
 
         std::atomic<bool> m_newData;
         std::mutex m_mutex;
+
+        /// @brief the ports whose histograms are copied into the current sample; the entries of subscribers without
+        /// port data are nullptr in order to keep the indices of the subscriber list
+        vector<typename PublisherPort::MemberType_t*, algorithm::maxVal(MAX_PORT_HISTOGRAMS, 1U)> m_histogramPublishers;
+        vector<typename SubscriberPort::MemberType_t*, algorithm::maxVal(MAX_PORT_HISTOGRAMS, 1U)>
+            m_histogramSubscribers;
+        /// @note is acquired while m_mutex is held and is held until the histograms are copied; it guards the port
+        /// lists above and blocks the removal of a port until its histograms are no longer accessed
+        std::mutex m_histogramSnapshotMutex;
+        /// @note guarded by m_mutex
+        bool m_histogramsEnabled{false};
     };
 
     // end of helper classes
@@ -282,7 +306,8 @@ class PortIntrospection
     /// @return true if registration was successful, false otherwise
     bool registerPublisherPort(PublisherPort&& publisherPortGeneric,
                                PublisherPort&& publisherPortThroughput,
-                               PublisherPort&& publisherPortSubscriberPortsData) noexcept;
+                               PublisherPort&& publisherPortSubscriberPortsData,
+                               PublisherPort&& publisherPortHistograms) noexcept;
 
     /// @brief set the time interval used to send new introspection data
     /// @param[in] interval duration between two send invocations
@@ -305,13 +330,21 @@ class PortIntrospection
     /// @brief sends the subscriberport changing data, this is used from the unittests
     void sendSubscriberPortsData() noexcept;
 
-    /// @brief calls the three specific send functions from above, this is used from the periodic task
+    /// @brief sends the port histograms, this is used from the unittests
+    void sendPortHistogramData() noexcept;
+
+    /// @brief enables the recording of the port histograms only while they have subscribers and sends them then,
+    /// this is used from the unittests
+    void updatePortHistograms() noexcept;
+
+    /// @brief calls the four specific send functions from above, this is used from the periodic task
     void send() noexcept;
 
   protected:
     optional<PublisherPort> m_publisherPort;
     optional<PublisherPort> m_publisherPortThroughput;
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
+    optional<PublisherPort> m_publisherPortHistograms;
 
   private:
     PortData m_portData;
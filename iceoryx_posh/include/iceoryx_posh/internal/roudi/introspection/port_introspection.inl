@@ -57,9 +57,10 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherPort(
     PublisherPort&& publisherPortGeneric,
     PublisherPort&& publisherPortThroughput,
-    PublisherPort&& publisherPortSubscriberPortsData) noexcept
+    PublisherPort&& publisherPortSubscriberPortsData,
+    PublisherPort&& publisherPortHistograms) noexcept
 {
-    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData)
+    if (m_publisherPort || m_publisherPortThroughput || m_publisherPortSubscriberPortsData || m_publisherPortHistograms)
     {
         return false;
     }
@@ -67,6 +68,7 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
     m_publisherPort.emplace(std::move(publisherPortGeneric));
     m_publisherPortThroughput.emplace(std::move(publisherPortThroughput));
     m_publisherPortSubscriberPortsData.emplace(std::move(publisherPortSubscriberPortsData));
+    m_publisherPortHistograms.emplace(std::move(publisherPortHistograms));
 
     return true;
 }
@@ -77,14 +79,20 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     cxx::Expects(m_publisherPort.has_value());
     cxx::Expects(m_publisherPortThroughput.has_value());
     cxx::Expects(m_publisherPortSubscriberPortsData.has_value());
+    cxx::Expects(m_publisherPortHistograms.has_value());
 
     // this is a field, there needs to be a sample before activate is called
     sendPortData();
     sendThroughputData();
     sendSubscriberPortsData();
+    if (MAX_PORT_HISTOGRAMS > 0U)
+    {
+        sendPortHistogramData();
+    }
     m_publisherPort->offer();
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
+    m_publisherPortHistograms->offer();
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -98,6 +106,25 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
     }
     sendThroughputData();
     sendSubscriberPortsData();
+    updatePortHistograms();
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::updatePortHistograms() noexcept
+{
+    if (MAX_PORT_HISTOGRAMS == 0U)
+    {
+        return;
+    }
+
+    // the histograms are recorded in the hot path of the ports and a sample is large, therefore both is only done
+    // while somebody is interested in the histograms
+    const bool hasSubscribers = m_publisherPortHistograms->hasSubscribers();
+    m_portData.setHistogramsEnabled(hasSubscribers);
+    if (hasSubscribers)
+    {
+        sendPortHistogramData();
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -157,6 +184,24 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::sendPortHistogramData() noexcept
+{
+    auto maybeChunkHeader = m_publisherPortHistograms->tryAllocateChunk(sizeof(PortHistogramIntrospectionFieldTopic),
+                                                                        alignof(PortHistogramIntrospectionFieldTopic),
+                                                                        CHUNK_NO_USER_HEADER_SIZE,
+                                                                        CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (!maybeChunkHeader.has_error())
+    {
+        auto histogramSample =
+            static_cast<PortHistogramIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
+        new (histogramSample) PortHistogramIntrospectionFieldTopic();
+
+        m_portData.prepareTopic(*histogramSample);
+        m_publisherPortHistograms->sendChunk(maybeChunkHeader.value());
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(const units::Duration interval) noexcept
 {
@@ -287,6 +332,11 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addPubli
         }
     }
 
+    if (m_histogramsEnabled)
+    {
+        PublisherPort(&port).setSendIntervalHistogramEnabled(true);
+    }
+
     setNew(true);
     return true;
 }
@@ -343,6 +393,11 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::addSubsc
         }
     }
 
+    if (m_histogramsEnabled)
+    {
+        SubscriberPort(&portData).setQueueDepthHistogramEnabled(true);
+    }
+
     return true;
 }
 
@@ -608,6 +663,15 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
                     // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+                    subscriberData.lostChunksCount = port.getLostChunksCount();
+                    subscriberData.maxQueueFillLevel = port.getMaximumQueueFillLevel();
+                    subscriberData.receivedChunksCount = port.getReceivedChunksCount();
+
+                    const auto latencyHistogram = port.getLatencyHistogram();
+                    subscriberData.latencySampleCount = latencyHistogram.totalCount();
+                    subscriberData.latencyP50InNanoseconds = latencyHistogram.valueAtPercentile(50.0);
+                    subscriberData.latencyP99InNanoseconds = latencyHistogram.valueAtPercentile(99.0);
+                    subscriberData.latencyP999InNanoseconds = latencyHistogram.valueAtPercentile(99.9);
                 }
                 else
                 {
@@ -622,6 +686,114 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortHistogramIntrospectionFieldTopic& topic) noexcept
+{
+    // only the ports are collected while the internal data is locked; the snapshot mutex is acquired before it is
+    // unlocked and keeps a removed port alive until its histograms are copied
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> snapshotLock(m_histogramSnapshotMutex);
+
+    m_histogramPublishers.clear();
+    m_histogramSubscribers.clear();
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                if (!m_histogramPublishers.push_back(m_publisherContainer[publisherIndex].portData))
+                {
+                    ++topic.m_numberOfOmittedPorts;
+                }
+            }
+        }
+    }
+
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            auto connectionIndex = pair.second;
+            if (connectionIndex >= 0)
+            {
+                if (!m_histogramSubscribers.push_back(m_connectionContainer[connectionIndex].subscriberInfo.portData))
+                {
+                    ++topic.m_numberOfOmittedPorts;
+                }
+            }
+        }
+    }
+    lock.unlock();
+
+    // the histograms are large, therefore they are written directly into the sample
+    for (auto portData : m_histogramPublishers)
+    {
+        PublisherPort port(portData);
+        topic.m_publisherList.emplace_back();
+        auto& publisherData = topic.m_publisherList.back();
+        publisherData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+        publisherData.m_sendIntervalInNanoseconds = port.getSendIntervalHistogram();
+    }
+
+    for (auto portData : m_histogramSubscribers)
+    {
+        topic.m_subscriberList.emplace_back();
+        if (portData != nullptr)
+        {
+            SubscriberPort port(portData);
+            auto& subscriberData = topic.m_subscriberList.back();
+            subscriberData.m_queueDepthAtPush = port.getQueueDepthHistogram();
+            subscriberData.m_timeInQueueInNanoseconds = port.getLatencyHistogram();
+        }
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::waitForHistogramSnapshot() noexcept
+{
+    std::lock_guard<std::mutex> snapshotLock(m_histogramSnapshotMutex);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::setHistogramsEnabled(const bool enable) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_histogramsEnabled == enable)
+    {
+        return;
+    }
+    m_histogramsEnabled = enable;
+
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            if (pair.second >= 0)
+            {
+                PublisherPort(m_publisherContainer[pair.second].portData).setSendIntervalHistogramEnabled(enable);
+            }
+        }
+    }
+
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            if (pair.second >= 0)
+            {
+                auto portData = m_connectionContainer[pair.second].subscriberInfo.portData;
+                if (portData != nullptr)
+                {
+                    SubscriberPort(portData).setQueueDepthHistogramEnabled(enable);
+                }
+            }
+        }
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::isNew() const noexcept
 {
@@ -651,13 +823,17 @@ PortIntrospection<PublisherPort, SubscriberPort>::addSubscriber(typename Subscri
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::removePublisher(const PublisherPort& port) noexcept
 {
-    return m_portData.removePublisher(port);
+    const bool wasRemoved = m_portData.removePublisher(port);
+    m_portData.waitForHistogramSnapshot();
+    return wasRemoved;
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::removeSubscriber(const SubscriberPort& port) noexcept
 {
-    return m_portData.removeSubscriber(port);
+    const bool wasRemoved = m_portData.removeSubscriber(port);
+    m_portData.waitForHistogramSnapshot();
+    return wasRemoved;
 }
 
 } // namespace roudi
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
@@ -56,6 +57,19 @@ class PortManager
 {
   public:
     using PortConfigInfo = iox::runtime::PortConfigInfo;
+
+    /// @brief The number of deleted ports whose chunks are released by one doDiscovery call
+    static constexpr uint64_t MAX_PORTS_RECLAIMED_PER_DISCOVERY_RUN{16U};
+
+    /// @brief The ports of the deployment manifest which are handed over to a runtime with one claim
+    struct ClaimedManifestPorts
+    {
+        vector<PublisherPortRouDiType::MemberType_t*, MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE> m_publishers;
+        vector<SubscriberPortType::MemberType_t*, MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE> m_subscribers;
+        /// @brief true if there are further ports which did not fit into this claim
+        bool m_hasMore{false};
+    };
+
     PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept;
 
     virtual ~PortManager() noexcept = default;
@@ -65,6 +79,15 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Lets the next doDiscovery process all ports instead of only the ones which requested a discovery run;
+    ///        this is the safety net for a lost notification
+    void requestFullDiscovery() noexcept;
+
+    /// @brief The condition variable which is notified by the ports whenever their state changes and a discovery run
+    ///        is required
+    /// @return reference to the discovery condition variable
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -121,6 +144,14 @@ class PortManager
     expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Acquires a heartbeat from the shared management segment which is used to monitor a process
+    /// @return on success a pointer to the Heartbeat; on error a PortPoolError
+    expected<runtime::Heartbeat*, PortPoolError> acquireHeartbeat() noexcept;
+
+    /// @brief Releases a heartbeat which was acquired with acquireHeartbeat
+    /// @param [in] heartbeat which is no longer used by a process
+    void releaseHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of a process
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
@@ -128,15 +159,57 @@ class PortManager
     /// @brief Used to unblock potential locks in the shutdown phase of RouDi
     void unblockRouDiShutdown() noexcept;
 
+    /// @brief Disconnects the ports of a runtime from all other ports and removes its interfaces, nodes and condition
+    ///        variables; the chunks held by the publisher, subscriber, client and server ports are released
+    ///        incrementally by doDiscovery, except for the ports of RouDi itself which are released immediately
+    /// @param[in] runtimeName of the runtime whose ports are deleted
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Releases the chunks of deleted ports and removes the ports from the port pool; the released chunks are
+    ///        reported per mempool once all deleted ports are reclaimed, otherwise a further discovery run is requested
+    /// @param[in] maxNumberOfPorts which are reclaimed with this call
+    void reclaimDeletedPorts(const uint64_t maxNumberOfPorts) noexcept;
+
+    /// @brief Notifies the discovery so that the deleted ports are reclaimed without waiting for the fallback run
+    void requestReclamationRun() noexcept;
+
+    /// @brief Returns the number of deleted ports whose chunks are not yet released
+    uint64_t numberOfPortsToReclaim() const noexcept;
+
+    /// @brief Creates the publisher and subscriber ports of the deployment manifest and connects them, so that their
+    ///        runtimes only have to claim them instead of requesting every single port
+    /// @param[in] manifestPorts are the ports to create
+    /// @param[in] payloadDataSegmentMemoryManager to acquire chunks for the publishers
+    void addManifestPorts(const config::RouDiConfig::ManifestPorts_t& manifestPorts,
+                          mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept;
+
+    /// @brief Hands the ports which were created from the deployment manifest over to their runtime; every port is
+    ///        handed over only once and ports of a runtime which terminated are gone, i.e. a restarted runtime has to
+    ///        request its ports again
+    /// @param[in] runtimeName of the runtime which claims its ports
+    /// @param[in] payloadDataSegmentMemoryManager the runtime has write access to; publishers with a different one
+    ///            cannot be used by the runtime and are destroyed
+    /// @return the claimed ports; call again if ClaimedManifestPorts::m_hasMore is set
+    ClaimedManifestPorts claimManifestPorts(const RuntimeName_t& runtimeName,
+                                            const mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept;
+
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
     void destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
 
+    void disconnectPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
+    void reclaimPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData,
+                              mepoo::ChunkReclamationReport* const report) noexcept;
+
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
+    void disconnectSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
+    void reclaimSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData,
+                               mepoo::ChunkReclamationReport* const report) noexcept;
+
     void handlePublisherPorts() noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
@@ -147,6 +220,11 @@ class PortManager
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
+    void disconnectClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
+    void reclaimClientPort(popo::ClientPortData* const clientPortData,
+                           mepoo::ChunkReclamationReport* const report) noexcept;
+
     void handleClientPorts() noexcept;
 
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
@@ -155,6 +233,11 @@ class PortManager
 
     void destroyServerPort(popo::ServerPortData* const clientPortData) noexcept;
 
+    void disconnectServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
+    void reclaimServerPort(popo::ServerPortData* const serverPortData,
+                           mepoo::ChunkReclamationReport* const report) noexcept;
+
     void handleServerPorts() noexcept;
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
@@ -198,7 +281,12 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
-    void publishServiceRegistry() const noexcept;
+    /// @brief Publishes a snapshot of the whole service registry if it changed since the last snapshot
+    void publishServiceRegistry() noexcept;
+
+    /// @brief Publishes the change of the service registry entry if the last modification changed the registry
+    /// @param[in] service, service description of the modified entry
+    void publishServiceRegistryDelta(const capro::ServiceDescription& service) noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -209,6 +297,15 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryDeltaPublisherPortData;
+    uint64_t m_publishedServiceRegistryGeneration{0U};
+    uint64_t m_publishedServiceRegistryDeltaGeneration{0U};
+    vector<popo::UniquePortId, MAX_NUMBER_OF_MANIFEST_PORTS> m_unclaimedManifestPortIds;
+    uint64_t m_numberOfPortsToReclaim{0U};
+    mepoo::ChunkReclamationReport m_chunkReclamationReport;
+
+    bool isUnclaimedManifestPort(const popo::UniquePortId& portId) const noexcept;
+    void removeUnclaimedManifestPort(const popo::UniquePortId& portId) noexcept;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -27,19 +27,16 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPoli
 inline optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
-    // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // check if the publisher is already in the list; the list is copied since destroying a port modifies the index
+    const auto publisherPortsOfService = m_portPool->getPublisherPortDataListOfService(service);
+    for (auto publisherPortData : publisherPortsOfService)
     {
-        popo::PublisherPortRouDi publisherPort(publisherPortData);
-        if (service == publisherPort.getCaProServiceDescription())
+        if (publisherPortData->m_toBeDestroyed)
         {
-            if (publisherPortData->m_toBeDestroyed)
-            {
-                destroyPublisherPort(publisherPortData);
-                continue;
-            }
-            return make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
+            destroyPublisherPort(publisherPortData);
+            continue;
         }
+        return make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
     }
     return nullopt;
 }
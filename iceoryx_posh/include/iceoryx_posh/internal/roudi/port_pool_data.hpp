@@ -19,11 +19,13 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
@@ -48,6 +50,16 @@ class FixedPositionContainer
 
     vector<T*, Capacity> content() noexcept;
 
+    /// @brief Returns the element at the provided position
+    /// @param[in] index of the element
+    /// @return pointer to the element or a nullptr if there is no element at that position
+    T* get(const uint64_t index) noexcept;
+
+    /// @brief Returns the position of the provided element, which is stable for the lifetime of the element
+    /// @param[in] element for which the position is requested
+    /// @return the position of the element or Capacity if the element is not contained
+    uint64_t indexOf(const T* const element) const noexcept;
+
   private:
     vector<optional<T>, Capacity> m_data;
 };
@@ -57,12 +69,20 @@ struct PortPoolData
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
     FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
+    FixedPositionContainer<runtime::Heartbeat, MAX_PROCESS_NUMBER> m_heartbeatMembers;
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    popo::ConditionVariableData m_discoveryConditionVariableData;
+
+    popo::DirtyPortList m_dirtyPublisherPorts;
+    popo::DirtyPortList m_dirtySubscriberPorts;
+    popo::DirtyPortList m_dirtyServerPorts;
+    popo::DirtyPortList m_dirtyClientPorts;
 };
 
 } // namespace roudi
@@ -20,10 +20,12 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
+#include <atomic>
 #include <cstdint>
 
 namespace iox
@@ -41,11 +43,13 @@ class Process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] dataSegmentId is an identifier for the shm data segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] heartbeat is the heartbeat in the shared management segment which is updated by a monitored process
     Process(const RuntimeName_t& name,
             const uint32_t pid,
             const posix::PosixUser& user,
             const bool isMonitored,
-            const uint64_t sessionId) noexcept;
+            const uint64_t sessionId,
+            runtime::Heartbeat* const heartbeat = nullptr) noexcept;
 
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
@@ -64,9 +68,9 @@ class Process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
 
-    void setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept;
-
-    mepoo::TimePointNs_t getTimestamp() noexcept;
+    /// @brief The heartbeat which is used to monitor this process
+    /// @return pointer to the heartbeat or a nullptr if the process is not monitored
+    runtime::Heartbeat* getHeartbeat() const noexcept;
 
     posix::PosixUser getUser() const noexcept;
 
@@ -75,10 +79,10 @@ class Process
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
-    mepoo::TimePointNs_t m_timestamp;
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    runtime::Heartbeat* m_heartbeat{nullptr};
 };
 
 } // namespace roudi
@@ -0,0 +1,92 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PROCESS_INDEX_HPP
+#define IOX_POSH_ROUDI_PROCESS_INDEX_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
+#include "iox/string_hash.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Fixed-capacity hash index from the name of a process to a value, e.g. the position of the process in the
+/// process list. It is used by RouDi to look up the process of a runtime message with a constant cost which does not
+/// depend on the number of registered processes.
+/// @tparam T the value type which is stored for each name
+/// @tparam Capacity the maximum number of names in the index
+/// @note the index uses open addressing with linear probing and keeps the load factor below 0.5
+template <typename T, uint64_t Capacity>
+class ProcessIndex
+{
+  public:
+    /// @brief Adds a name with its value to the index
+    /// @param[in] name of the process
+    /// @param[in] value which is stored for the name
+    /// @return true if the name was added, false if the name is already contained or the index is full
+    bool insert(const RuntimeName_t& name, const T& value) noexcept;
+
+    /// @brief Removes a name from the index
+    /// @param[in] name of the process
+    /// @return true if the name was removed, false if the name is not contained
+    bool remove(const RuntimeName_t& name) noexcept;
+
+    /// @brief Looks up the value of a name
+    /// @param[in] name of the process
+    /// @return the value of the name or nullopt if the name is not contained
+    optional<T> find(const RuntimeName_t& name) const noexcept;
+
+    /// @brief Removes all names from the index
+    void clear() noexcept;
+
+    /// @brief the number of names in the index
+    uint64_t size() const noexcept;
+
+  private:
+    static constexpr uint64_t nextPowerOfTwo(const uint64_t value, const uint64_t powerOfTwo = 1U) noexcept
+    {
+        return (powerOfTwo >= value) ? powerOfTwo : nextPowerOfTwo(value, powerOfTwo * 2U);
+    }
+
+    static constexpr uint64_t NUMBER_OF_SLOTS{nextPowerOfTwo(2U * Capacity + 1U)};
+
+    struct Slot
+    {
+        RuntimeName_t name;
+        optional<T> value;
+    };
+
+    static uint64_t hash(const RuntimeName_t& name) noexcept;
+    static uint64_t next(const uint64_t index) noexcept;
+
+    /// @brief returns the slot which contains the name or the empty slot where the name would be inserted
+    uint64_t findSlot(const RuntimeName_t& name) const noexcept;
+
+    std::array<Slot, NUMBER_OF_SLOTS> m_slots;
+    uint64_t m_size{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/process_index.inl"
+
+#endif // IOX_POSH_ROUDI_PROCESS_INDEX_HPP
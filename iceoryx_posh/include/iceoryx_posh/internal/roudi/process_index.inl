@@ -0,0 +1,128 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PROCESS_INDEX_INL
+#define IOX_POSH_ROUDI_PROCESS_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/process_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+constexpr uint64_t ProcessIndex<T, Capacity>::NUMBER_OF_SLOTS;
+
+template <typename T, uint64_t Capacity>
+inline bool ProcessIndex<T, Capacity>::insert(const RuntimeName_t& name, const T& value) noexcept
+{
+    if (m_size >= Capacity)
+    {
+        return false;
+    }
+
+    auto& slot = m_slots[findSlot(name)];
+    if (slot.value.has_value())
+    {
+        return false;
+    }
+
+    slot.name = name;
+    slot.value.emplace(value);
+    ++m_size;
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool ProcessIndex<T, Capacity>::remove(const RuntimeName_t& name) noexcept
+{
+    auto index = findSlot(name);
+    if (!m_slots[index].value.has_value())
+    {
+        return false;
+    }
+    m_slots[index].value.reset();
+    --m_size;
+
+    // backward shift deletion; the following entries of the probe sequence are moved into the gap when the gap lies
+    // between their home slot and their current slot, so that no tombstones are required
+    auto gap = index;
+    for (auto current = next(gap); m_slots[current].value.has_value(); current = next(current))
+    {
+        auto home = hash(m_slots[current].name) & (NUMBER_OF_SLOTS - 1U);
+        auto distanceToGap = (current - gap) & (NUMBER_OF_SLOTS - 1U);
+        auto distanceToHome = (current - home) & (NUMBER_OF_SLOTS - 1U);
+        if (distanceToHome >= distanceToGap)
+        {
+            m_slots[gap].name = m_slots[current].name;
+            m_slots[gap].value = m_slots[current].value;
+            m_slots[current].value.reset();
+            gap = current;
+        }
+    }
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline optional<T> ProcessIndex<T, Capacity>::find(const RuntimeName_t& name) const noexcept
+{
+    return m_slots[findSlot(name)].value;
+}
+
+template <typename T, uint64_t Capacity>
+inline void ProcessIndex<T, Capacity>::clear() noexcept
+{
+    for (auto& slot : m_slots)
+    {
+        slot.value.reset();
+    }
+    m_size = 0U;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t ProcessIndex<T, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t ProcessIndex<T, Capacity>::hash(const RuntimeName_t& name) noexcept
+{
+    return StringHash()(name);
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t ProcessIndex<T, Capacity>::next(const uint64_t index) noexcept
+{
+    return (index + 1U) & (NUMBER_OF_SLOTS - 1U);
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t ProcessIndex<T, Capacity>::findSlot(const RuntimeName_t& name) const noexcept
+{
+    // the load factor is below 0.5, therefore there is always an empty slot which terminates the probing
+    auto index = hash(name) & (NUMBER_OF_SLOTS - 1U);
+    while (m_slots[index].value.has_value() && m_slots[index].name != name)
+    {
+        index = next(index);
+    }
+    return index;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_INDEX_INL
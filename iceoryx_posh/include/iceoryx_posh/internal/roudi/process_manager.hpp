@@ -23,13 +23,18 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_index.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
+#include <shared_mutex>
 
 namespace iox
 {
@@ -47,6 +52,7 @@ class ProcessManager : public ProcessManagerInterface
 {
   public:
     using ProcessList_t = cxx::list<Process, MAX_PROCESS_NUMBER>;
+    using ProcessIndex_t = ProcessIndex<ProcessList_t::iterator, MAX_PROCESS_NUMBER>;
     using PortConfigInfo = iox::runtime::PortConfigInfo;
 
     enum class TerminationFeedback
@@ -103,8 +109,6 @@ class ProcessManager : public ProcessManagerInterface
     /// @brief Tries to gracefully terminate all registered processes
     void requestShutdownOfAllProcesses() noexcept;
 
-    void updateLivelinessOfProcess(const RuntimeName_t& name) noexcept;
-
     void
     addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces interface, const NodeName_t& node) noexcept;
 
@@ -146,10 +150,36 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Sends the ports which RouDi created from the deployment manifest for the process to the OS process
+    /// @param[in] name is the name of the runtime claiming its ports
+    void claimManifestPortsForProcess(const RuntimeName_t& name) noexcept;
+
+    /// @brief Creates all ports of the batch for the process and sends the result of each port with one response
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] portBatch contains the ports to create
+    void addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& portBatch) noexcept;
+
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Monitors the processes and runs the discovery of the ports
     void run() noexcept;
 
+    /// @brief Lets the next run process all ports instead of only the ones which requested a discovery run
+    void requestFullDiscovery() noexcept;
+
+    /// @brief Monitors the processes without running the discovery of the ports
+    void monitorProcesses() noexcept;
+
+    /// @brief Checks if the termination of monitored processes is notified immediately or only detected by their
+    /// heartbeat
+    /// @return true if monitorProcessTerminations can be used, false otherwise
+    bool isProcessTerminationMonitoringAvailable() const noexcept;
+
+    /// @brief Waits for the termination of monitored processes and removes the terminated processes together with their
+    /// resources without waiting for the heartbeat timeout
+    /// @param [in] timeout the maximum time to wait for a terminated process
+    void monitorProcessTerminations(const units::Duration timeout) noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -159,9 +189,13 @@ class ProcessManager : public ProcessManagerInterface
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
-    void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
+    expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+    addPortOfBatchForProcess(const RuntimeName_t& name,
+                             const runtime::PortBatch::Entry& entry,
+                             mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept;
+
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
@@ -192,6 +226,11 @@ class ProcessManager : public ProcessManagerInterface
     bool removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
                                                              const TerminationFeedback feedback) noexcept;
 
+    /// @brief Stops the immediate notification about the termination of the given process unless another monitored
+    /// runtime is running in the same process
+    /// @param [in] process The process which is about to be removed
+    void removeFromProcessTerminationMonitor(const Process& process) noexcept;
+
     enum class ShutdownPolicy
     {
         SIG_TERM,
@@ -227,6 +266,20 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    /// @note the processes are looked up by name for every runtime message; the index avoids a linear search
+    ProcessIndex_t m_processIndex;
+    /// @note the heartbeat is the fallback for processes which cannot be monitored by the ProcessTerminationMonitor
+    ProcessTerminationMonitor m_processTerminationMonitor;
+    /// @note the messages of the runtimes are handled concurrently; they only read the process list and are therefore
+    /// running in parallel while the registration and removal of processes modifies it exclusively
+    mutable std::shared_timed_mutex m_processListMutex;
+    /// @note the PortManager is not thread-safe; this mutex is always acquired after the process list mutex and only
+    /// held while the PortManager is accessed but not while a response is sent to a process. It guards every call
+    /// which modifies the port pool, the service registry or the heartbeat pool, i.e. the acquire*Data and
+    /// claimManifestPorts calls of the port requests, deletePortsOfProcess, acquireHeartbeat/releaseHeartbeat,
+    /// unblockProcessShutdown/unblockRouDiShutdown and doDiscovery. Only the serialization of the acquired port data
+    /// and the IPC responses run without the lock, so requests of different processes overlap there.
+    std::mutex m_portManagerMutex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
 };
@@ -0,0 +1,93 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/duration.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Notifies RouDi about the termination of a process as soon as it happened instead of waiting for the
+/// heartbeat timeout. On Linux a pidfd of each monitored process is watched with the pidfd monitor of the platform;
+/// on all other platforms and on kernels without pidfd support the monitor is not available and the heartbeat is the
+/// only way to detect a terminated process.
+/// @note wait can be called concurrently to add and remove, but add and remove must not be called concurrently
+/// @attention The pids which are reported by the runtimes are interpreted in the PID namespace of RouDi. When RouDi and
+/// the applications run in different PID namespaces, e.g. in separate containers without a shared PID namespace, a
+/// pid refers to an unrelated process or to none at all and the termination of an application would be missed or
+/// reported for the wrong process. In this setup RouDi and the applications must share the PID namespace (e.g.
+/// 'docker run --pid=container:<roudi>') or the monitoring must be disabled with '--monitoring-mode off'.
+class ProcessTerminationMonitor
+{
+  public:
+    using TerminatedProcesses_t = vector<uint32_t, MAX_PROCESS_NUMBER>;
+
+    ProcessTerminationMonitor() noexcept;
+    ~ProcessTerminationMonitor() noexcept;
+
+    ProcessTerminationMonitor(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor(ProcessTerminationMonitor&&) = delete;
+    ProcessTerminationMonitor& operator=(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor& operator=(ProcessTerminationMonitor&&) = delete;
+
+    /// @brief Checks if the platform supports the notification about terminated processes
+    /// @return true if the monitor is available, false otherwise
+    bool isAvailable() const noexcept;
+
+    /// @brief Starts to monitor a process
+    /// @param[in] pid of the process
+    /// @return true if the process is monitored, false if the monitor is not available or the process could not be
+    /// opened, e.g. because it already terminated
+    bool add(const uint32_t pid) noexcept;
+
+    /// @brief Stops to monitor a process; does nothing if the process is not monitored
+    /// @param[in] pid of the process
+    void remove(const uint32_t pid) noexcept;
+
+    /// @brief Stops to monitor all processes
+    void clear() noexcept;
+
+    /// @brief Waits until at least one monitored process terminated or the timeout has passed
+    /// @param[in] timeout the maximum time to wait
+    /// @return the pids of the terminated processes; they are still monitored until they are removed
+    TerminatedProcesses_t wait(const units::Duration timeout) noexcept;
+
+  private:
+    static constexpr int32_t INVALID_FD{-1};
+
+    struct MonitoredProcess
+    {
+        uint32_t pid{0U};
+        int32_t pidFd{INVALID_FD};
+    };
+
+    void closeFileDescriptor(const int32_t fd) noexcept;
+
+    int32_t m_monitorFd{INVALID_FD};
+    vector<MonitoredProcess, MAX_PROCESS_NUMBER> m_monitoredProcesses;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
@@ -17,7 +17,6 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -27,8 +26,10 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 #include <thread>
@@ -57,12 +58,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t numberOfRuntimeMessagesThreads = roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_THREADS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_numberOfRuntimeMessagesThreads(numberOfRuntimeMessagesThreads)
         {
         }
 
@@ -71,6 +74,7 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        const uint32_t m_numberOfRuntimeMessagesThreads;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -83,7 +87,7 @@ class RouDi
     virtual ~RouDi() noexcept;
 
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
+    /// @brief Starts the threads processing messages from the runtimes
     /// Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
@@ -92,6 +96,8 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
+    /// @note with more than one runtime messages thread this is called concurrently and must be thread-safe
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -103,6 +109,12 @@ class RouDi
                                               uid_t& userId,
                                               int64_t& transmissionTimestamp) noexcept;
 
+    /// @brief Deserializes the ports of a CREATE_PORTS message
+    /// @param[in] message the CREATE_PORTS message
+    /// @param[out] portBatch the batch where the deserialized ports are added to
+    /// @return true if all ports of the message could be deserialized, false otherwise
+    bool parseCreatePortsMessage(const runtime::IpcMessage& message, runtime::PortBatch& portBatch) noexcept;
+
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
     /// @param [in] pid is the host system process id
@@ -126,6 +138,8 @@ class RouDi
 
     void monitorAndDiscoveryUpdate() noexcept;
 
+    void monitorProcessTerminations() noexcept;
+
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
@@ -145,11 +159,14 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note the ProcessManager is thread-safe and used concurrently by the runtime messages threads
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
-    std::thread m_handleRuntimeMessageThread;
+    std::thread m_processTerminationMonitoringThread;
+    optional<runtime::IpcInterfaceCreator> m_roudiIpcInterface;
+    vector<std::thread, MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS> m_handleRuntimeMessageThreads;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -158,6 +175,7 @@ class RouDi
   private:
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
     units::Duration m_processKillDelay;
+    uint32_t m_numberOfRuntimeMessagesThreads{DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_THREADS};
 };
 
 } // namespace roudi
@@ -0,0 +1,81 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Index from a ServiceDescription to the ports with this ServiceDescription. It is used by RouDi to match
+/// publisher with subscriber and server with client ports without iterating over all ports of the PortPool.
+/// @tparam T the port data type, e.g. PublisherPortData
+/// @tparam Capacity the maximum number of ports, i.e. the capacity of the corresponding port container of the PortPool
+/// @note the index is only used by the RouDi process and therefore not placed in the shared memory; it is a chained
+/// hash index with fixed capacity, the ports of one ServiceDescription are in the same chain in the order they were
+/// added
+template <typename T, uint64_t Capacity>
+class ServicePortIndex
+{
+  public:
+    using PortList_t = vector<T*, Capacity>;
+
+    ServicePortIndex() noexcept;
+
+    /// @brief Adds a port to the index with the ServiceDescription of the port
+    /// @param[in] port to add
+    /// @return false if the index already contains Capacity ports, otherwise true
+    bool add(T* const port) noexcept;
+
+    /// @brief Removes a port from the index
+    /// @param[in] port to remove; if the port is not contained, nothing happens
+    void remove(const T* const port) noexcept;
+
+    /// @brief Returns all ports with the provided ServiceDescription in the order they were added
+    /// @param[in] service of the ports
+    /// @return the list of ports, which is empty if there is no port with the ServiceDescription
+    PortList_t find(const capro::ServiceDescription& service) const noexcept;
+
+  private:
+    static constexpr uint64_t NO_INDEX{Capacity};
+    static constexpr uint64_t BUCKET_COUNT{Capacity};
+
+    struct Node
+    {
+        T* port{nullptr};
+        uint64_t next{NO_INDEX};
+    };
+
+    static uint64_t bucket(const capro::ServiceDescription& service) noexcept;
+
+    uint64_t m_buckets[BUCKET_COUNT];
+    Node m_nodes[Capacity];
+    /// @brief the unused nodes are chained via Node::next
+    uint64_t m_freeNodes{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/service_port_index.inl"
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_HPP
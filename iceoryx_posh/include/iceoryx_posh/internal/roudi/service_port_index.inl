@@ -0,0 +1,110 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <typename T, uint64_t Capacity>
+inline ServicePortIndex<T, Capacity>::ServicePortIndex() noexcept
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket = NO_INDEX;
+    }
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        m_nodes[i].next = i + 1U;
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline uint64_t ServicePortIndex<T, Capacity>::bucket(const capro::ServiceDescription& service) noexcept
+{
+    return capro::ServiceDescriptionHash()(service) % BUCKET_COUNT;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool ServicePortIndex<T, Capacity>::add(T* const port) noexcept
+{
+    if (m_freeNodes == NO_INDEX)
+    {
+        return false;
+    }
+
+    const auto nodeIndex = m_freeNodes;
+    auto& node = m_nodes[nodeIndex];
+    m_freeNodes = node.next;
+    node.port = port;
+    node.next = NO_INDEX;
+
+    // the node is appended to preserve the order in which the ports were added
+    auto* link = &m_buckets[bucket(port->m_serviceDescription)];
+    while (*link != NO_INDEX)
+    {
+        link = &m_nodes[*link].next;
+    }
+    *link = nodeIndex;
+
+    return true;
+}
+
+template <typename T, uint64_t Capacity>
+inline void ServicePortIndex<T, Capacity>::remove(const T* const port) noexcept
+{
+    auto* link = &m_buckets[bucket(port->m_serviceDescription)];
+    while (*link != NO_INDEX)
+    {
+        const auto nodeIndex = *link;
+        auto& node = m_nodes[nodeIndex];
+        if (node.port == port)
+        {
+            *link = node.next;
+            node.port = nullptr;
+            node.next = m_freeNodes;
+            m_freeNodes = nodeIndex;
+            return;
+        }
+        link = &node.next;
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline typename ServicePortIndex<T, Capacity>::PortList_t
+ServicePortIndex<T, Capacity>::find(const capro::ServiceDescription& service) const noexcept
+{
+    PortList_t ports;
+    // the chain can also contain ports of other services with a colliding hash
+    for (auto nodeIndex = m_buckets[bucket(service)]; nodeIndex != NO_INDEX; nodeIndex = m_nodes[nodeIndex].next)
+    {
+        auto port = m_nodes[nodeIndex].port;
+        if (port->m_serviceDescription == service)
+        {
+            ports.emplace_back(port);
+        }
+    }
+    return ports;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_PORT_INDEX_INL
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
@@ -32,6 +33,8 @@ namespace iox
 {
 namespace roudi
 {
+struct ServiceRegistryDelta;
+
 class ServiceRegistry
 {
   public:
@@ -96,27 +99,117 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
+    /// @brief Returns the generation of the registry, it is incremented with every change of an entry
+    /// @return the current generation
+    uint64_t generation() const noexcept;
+
+    /// @brief Applies a change of another registry, e.g. the one of RouDi, to this registry
+    /// @param[in] delta, change to apply
+    /// @return false if the delta does not directly follow the generation of this registry, i.e. a previous delta was
+    ///         lost, otherwise true if it was applied or is already contained in this registry
+    bool apply(const ServiceRegistryDelta& delta) noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief Chained hash index over the positions of the entries in m_serviceDescriptions. Since only positions
+    ///        are stored, the index stays valid when the ServiceRegistry is copied into the shared memory and can be
+    ///        used by the applications. The chains are ordered by position to preserve the order of the find results.
+    class HashIndex
+    {
+      public:
+        HashIndex() noexcept;
+
+        /// @brief Adds the entry at the position to the chain of the hash
+        void insert(const uint64_t hash, const uint32_t index) noexcept;
+
+        /// @brief Removes the entry at the position from the chain of the hash
+        void remove(const uint64_t hash, const uint32_t index) noexcept;
+
+        /// @brief Returns the first position in the chain of the hash or NO_INDEX if the chain is empty; the chain
+        ///        contains all entries with this hash but may also contain entries with a colliding hash
+        uint32_t first(const uint64_t hash) const noexcept;
+
+        /// @brief Returns the next position in the chain or NO_INDEX if the end of the chain is reached
+        uint32_t next(const uint32_t index) const noexcept;
+
+      private:
+        static constexpr uint32_t BUCKET_COUNT = CAPACITY;
+
+        static uint32_t bucket(const uint64_t hash) noexcept;
+
+        uint32_t m_buckets[BUCKET_COUNT];
+        uint32_t m_next[CAPACITY];
+        uint32_t m_previous[CAPACITY];
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
+    HashIndex m_serviceDescriptionIndex;
+    HashIndex m_serviceIndex;
+    HashIndex m_instanceIndex;
+    HashIndex m_eventIndex;
+
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
     uint32_t m_freeIndex{NO_INDEX};
 
+    uint64_t m_generation{0U};
+
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    uint32_t acquireFreeIndex() noexcept;
+
+    void emplaceAt(const uint32_t index,
+                   const capro::ServiceDescription& serviceDescription,
+                   ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept;
+
+    void resetAt(const uint32_t index) noexcept;
+
+    void findInIndex(const HashIndex& index,
+                     const capro::IdString_t& key,
+                     const optional<capro::IdString_t>& service,
+                     const optional<capro::IdString_t>& instance,
+                     const optional<capro::IdString_t>& event,
+                     function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
     expected<Error> add(const capro::ServiceDescription& serviceDescription,
                         ReferenceCounter_t ServiceDescriptionEntry::*count);
 };
 
+/// @brief A single change of the ServiceRegistry; it is published in addition to the snapshot of the whole registry
+///        so that the applications do not have to copy the registry on every change. The entry contains the counters
+///        after the change, an entry without publishers and servers was removed from the registry.
+struct ServiceRegistryDelta
+{
+    /// @brief a snapshot is published at the latest after this number of deltas, an application which lost deltas
+    ///        can therefore catch up with the latest snapshot and the deltas in its queue
+    static constexpr uint64_t MAX_DELTAS_BETWEEN_SNAPSHOTS{8U};
+
+    /// @brief number of deltas which are kept for applications which start with the latest snapshot
+    static constexpr uint64_t HISTORY_CAPACITY{algorithm::minVal(MAX_PUBLISHER_HISTORY, MAX_DELTAS_BETWEEN_SNAPSHOTS)};
+
+    /// @brief queue capacity of the subscribers of the deltas; it holds more deltas than are published between two
+    ///        snapshots, a lost delta is therefore always contained in the latest snapshot
+    static constexpr uint64_t SUBSCRIBER_QUEUE_CAPACITY{2U * MAX_DELTAS_BETWEEN_SNAPSHOTS};
+
+    /// @brief number of subscribers, i.e. ServiceDiscovery instances, which can hold a full queue at the same time;
+    ///        usually there is one per process. Further subscribers can exhaust the chunks of the deltas, the lost deltas
+    ///        are then recovered with the next snapshot
+    static constexpr uint32_t MAX_SUBSCRIBERS{MAX_PROCESS_NUMBER};
+
+    ServiceRegistryDelta(const uint64_t generation, const ServiceRegistry::ServiceDescriptionEntry& entry) noexcept;
+
+    /// @brief generation of the registry after the change
+    uint64_t generation{0U};
+    ServiceRegistry::ServiceDescriptionEntry entry;
+};
+
 } // namespace roudi
 } // namespace iox
 
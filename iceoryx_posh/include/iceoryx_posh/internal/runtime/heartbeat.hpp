@@ -0,0 +1,58 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_HEARTBEAT_HPP
+#define IOX_POSH_RUNTIME_HEARTBEAT_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Lives in the shared management segment and is periodically updated by the runtime of a monitored
+///        process. RouDi checks the time since the last beat to detect processes which stopped unexpectedly.
+class Heartbeat
+{
+  public:
+    /// @brief Creates a heartbeat with the current time as last beat
+    Heartbeat() noexcept;
+
+    Heartbeat(const Heartbeat&) = delete;
+    Heartbeat(Heartbeat&&) = delete;
+    Heartbeat& operator=(const Heartbeat&) = delete;
+    Heartbeat& operator=(Heartbeat&&) = delete;
+    ~Heartbeat() noexcept = default;
+
+    /// @brief Sets the time of the last beat to the current time
+    void beat() noexcept;
+
+    /// @brief Returns the time which has elapsed since the last beat
+    /// @return the elapsed time in milliseconds
+    uint64_t elapsedMillisecondsSinceLastBeat() const noexcept;
+
+  private:
+    /// @note the steady clock is system-wide and therefore the time is comparable between RouDi and the applications
+    static uint64_t millisecondsSinceEpoch() noexcept;
+
+    std::atomic<uint64_t> m_timestampOfLastBeat{0U};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_HEARTBEAT_HPP
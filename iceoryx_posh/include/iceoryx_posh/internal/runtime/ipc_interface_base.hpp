@@ -75,6 +75,7 @@ enum class IpcMessageType : int32_t
     CREATE_CONDITION_VARIABLE_ACK,
     CREATE_NODE,
     CREATE_NODE_ACK,
+    // deprecated, the runtimes beat their heartbeat instead; the value is reserved and the message ignored by RouDi
     KEEPALIVE,
     TERMINATION,
     TERMINATION_ACK,
@@ -85,6 +86,11 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    // new message types are appended here to keep the values of the existing ones for older runtimes
+    CLAIM_MANIFEST_PORTS,
+    CLAIM_MANIFEST_PORTS_ACK,
+    CREATE_PORTS,
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -44,10 +44,6 @@ class IpcRuntimeInterface
     IpcRuntimeInterface(IpcRuntimeInterface&&) = delete;
     IpcRuntimeInterface& operator=(IpcRuntimeInterface&&) = delete;
 
-    /// @brief sends the keep alive trigger to the RouDi daemon
-    /// @return true if sending was successful, false if not
-    bool sendKeepalive() noexcept;
-
     /// @brief send a request to the RouDi daemon
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
@@ -58,6 +54,10 @@ class IpcRuntimeInterface
     /// @return address offset as iox::RelativePointer::offset_t
     UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
 
+    /// @brief get the address offset of the heartbeat which RouDi uses to monitor this process
+    /// @return address offset as iox::RelativePointer::offset_t or nullopt if the process is not monitored
+    optional<UntypedRelativePointer::offset_t> getHeartbeatAddressOffset() const noexcept;
+
     /// @brief get the size of the management shared memory object
     /// @return size in bytes
     size_t getShmTopicSize() noexcept;
@@ -80,11 +80,11 @@ class IpcRuntimeInterface
   private:
     RuntimeName_t m_runtimeName;
     optional<UntypedRelativePointer::offset_t> m_segmentManagerAddressOffset;
+    optional<UntypedRelativePointer::offset_t> m_heartbeatAddressOffset;
     optional<IpcInterfaceCreator> m_AppIpcInterface;
     IpcInterfaceUser m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
-    bool m_sendKeepalive = true;
 };
 
 } // namespace runtime
@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/function.hpp"
@@ -77,6 +78,12 @@ class PoshRuntimeImpl : public PoshRuntime
     /// @copydoc PoshRuntime::createNode
     NodeData* createNode(const NodeProperty& nodeProperty) noexcept override;
 
+    /// @copydoc PoshRuntime::claimManifestPorts
+    uint64_t claimManifestPorts() noexcept override;
+
+    /// @copydoc PoshRuntime::createPorts
+    uint64_t createPorts(const PortBatch& portBatch) noexcept override;
+
     /// @copydoc PoshRuntime::sendRequestToRouDi
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept override;
 
@@ -104,12 +111,44 @@ class PoshRuntimeImpl : public PoshRuntime
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    uint64_t requestPortsOfBatchFromRoudi(const IpcMessage& sendBuffer,
+                                          const PortBatch::Entries_t& entries,
+                                          const uint64_t firstEntry,
+                                          const uint64_t numberOfEntries) noexcept;
+
+    IpcMessage serializePortOfBatch(const PortBatch::Entry& entry) const noexcept;
+
+    popo::SubscriberOptions adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                                    const popo::SubscriberOptions& subscriberOptions) const noexcept;
+    popo::ClientOptions adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+    popo::ServerOptions adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    /// @brief Takes a pre-created port with the given service description out of the cache
+    /// @param[in] hasRequestedOptions returns true if the port was created with the requested options; a port which was
+    ///            created with other options stays in the cache and the caller requests a new port from RouDi
+    template <typename PortData, uint64_t Capacity, typename OptionsPredicate>
+    PortData* takePreCreatedPort(vector<PortData*, Capacity>& preCreatedPorts,
+                                 const capro::ServiceDescription& service,
+                                 const OptionsPredicate& hasRequestedOptions) noexcept;
+
     mutable posix::mutex m_appIpcRequestMutex{false};
 
+    // ports which were claimed from the deployment manifest or created with a batch and are handed out by the
+    // getMiddleware calls without a further request to RouDi
+    posix::mutex m_preCreatedPortsMutex{false};
+    vector<PublisherPortUserType::MemberType_t*, MAX_PUBLISHERS> m_preCreatedPublishers;
+    vector<SubscriberPortUserType::MemberType_t*, MAX_SUBSCRIBERS> m_preCreatedSubscribers;
+    vector<popo::ClientPortUser::MemberType_t*, MAX_CLIENTS> m_preCreatedClients;
+    vector<popo::ServerPortUser::MemberType_t*, MAX_SERVERS> m_preCreatedServers;
+    vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES> m_preCreatedConditionVariables;
+
     IpcRuntimeInterface m_ipcChannelInterface;
     optional<SharedMemoryUser> m_ShmInterface;
+    // the heartbeat in the shared management segment which is checked by RouDi; a nullptr if the process is not
+    // monitored
+    Heartbeat* const m_heartbeat{nullptr};
 
-    void sendKeepAliveAndHandleShutdownPreparation() noexcept;
+    void beatHeartbeatAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
 
     // the m_keepAliveTask should always be the last member, so that it will be the first member to be destroyed
@@ -118,7 +157,7 @@ class PoshRuntimeImpl : public PoshRuntime
         PROCESS_KEEP_ALIVE_INTERVAL,
         "KeepAlive",
         *this,
-        &PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation};
+        &PoshRuntimeImpl::beatHeartbeatAndHandleShutdownPreparation};
 };
 
 } // namespace runtime
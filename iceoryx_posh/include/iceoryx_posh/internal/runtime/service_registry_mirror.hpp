@@ -0,0 +1,66 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_SERVICE_REGISTRY_MIRROR_HPP
+#define IOX_POSH_RUNTIME_SERVICE_REGISTRY_MIRROR_HPP
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/function_ref.hpp"
+
+#include <memory>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Local copy of the ServiceRegistry of RouDi which is kept up to date with the published deltas. The snapshot
+///        of the whole registry is only copied initially and after a delta was lost; until a snapshot which is at
+///        least as recent as the mirror is available, the deltas are discarded since they cannot be applied.
+class ServiceRegistryMirror
+{
+  public:
+    using DeltaCallback_t = function_ref<void(const roudi::ServiceRegistryDelta&)>;
+    /// @brief takes the next delta and calls the callback with it; returns false if no delta is left
+    using TakeDelta_t = function_ref<bool(const DeltaCallback_t&)>;
+
+    ServiceRegistryMirror() noexcept = default;
+
+    /// @brief Applies all deltas which can be taken and uses the snapshot to synchronize the mirror if required
+    /// @param[in] snapshot the latest snapshot or nullptr if no snapshot was received
+    /// @param[in] takeDelta takes the deltas one after another in the order of their publication
+    void update(const roudi::ServiceRegistry* const snapshot, const TakeDelta_t& takeDelta) noexcept;
+
+    /// @brief Checks if all published deltas up to the generation of the mirror were applied
+    /// @return true if the mirror is synchronized, false if it waits for a snapshot
+    bool isSynchronized() const noexcept;
+
+    /// @brief Returns the mirrored registry; it can be outdated when the mirror is not synchronized
+    /// @return the mirrored registry
+    const roudi::ServiceRegistry& registry() const noexcept;
+
+  private:
+    void synchronize(const roudi::ServiceRegistry* const snapshot) noexcept;
+
+    // use dynamic memory to reduce stack usage
+    /// @todo iox-#1155 improve solution to avoid stack usage without using dynamic memory
+    std::unique_ptr<roudi::ServiceRegistry> m_registry{new roudi::ServiceRegistry};
+    bool m_isSynchronized{false};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_SERVICE_REGISTRY_MIRROR_HPP
@@ -60,7 +60,9 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    /// @note version 2 is the layout with the publish timestamp which is only part of the ChunkHeader when iceoryx is
+    /// built with the IOX_PUBLISH_TIMESTAMPS option
+    static constexpr uint8_t CHUNK_HEADER_VERSION{build::IOX_PUBLISH_TIMESTAMPS ? 2U : 1U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -139,6 +141,12 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The point in time when the chunk was sent, taken from the monotonic mepoo::BaseClock_t
+    /// @return the publish timestamp in nanoseconds or 0 if the publisher does not provide timestamps
+    /// @note the timestamp is only set when iceoryx is built with the IOX_PUBLISH_TIMESTAMPS option and the
+    /// publisher is created with PublisherOptions::publishTimestamp set to true
+    uint64_t publishTimestamp() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -147,6 +155,8 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(const uint64_t publishTimestamp) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -164,6 +174,10 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
     uint64_t m_sequenceNumber{0U};
+#if IOX_POSH_PUBLISH_TIMESTAMPS
+    // monotonic timestamp in nanoseconds of the send operation; '0' if not set by the publisher
+    uint64_t m_publishTimestamp{0U};
+#endif
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
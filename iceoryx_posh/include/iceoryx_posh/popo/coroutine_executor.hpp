@@ -0,0 +1,240 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_COROUTINE_EXECUTOR_HPP
+#define IOX_POSH_POPO_COROUTINE_EXECUTOR_HPP
+
+#if __cplusplus < 202002L || !__has_include(<coroutine>)
+#error "The CoroutineExecutor requires C++20 coroutines"
+#endif
+
+#include "iceoryx_posh/internal/popo/base_client.hpp"
+#include "iceoryx_posh/internal/popo/base_server.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/expected.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The coroutine type of the tasks which are executed by a CoroutineExecutor. A task is started when the
+/// CoroutineExecutor runs and its frame is destroyed when it finished or when the CoroutineExecutor is destroyed.
+class CoroutineTask
+{
+  public:
+    struct promise_type
+    {
+        CoroutineTask get_return_object() noexcept;
+        std::suspend_always initial_suspend() const noexcept;
+        std::suspend_always final_suspend() const noexcept;
+        void return_void() const noexcept;
+        void unhandled_exception() const noexcept;
+    };
+
+    using Handle_t = std::coroutine_handle<promise_type>;
+
+    CoroutineTask(const CoroutineTask&) = delete;
+    CoroutineTask(CoroutineTask&& rhs) noexcept;
+    CoroutineTask& operator=(const CoroutineTask&) = delete;
+    CoroutineTask& operator=(CoroutineTask&& rhs) noexcept;
+    ~CoroutineTask() noexcept;
+
+    /// @brief Transfers the ownership of the coroutine frame to the caller
+    Handle_t release() noexcept;
+
+  private:
+    explicit CoroutineTask(const Handle_t handle) noexcept;
+
+    Handle_t m_handle;
+};
+
+enum class CoroutineExecutorError : uint8_t
+{
+    TASK_CAPACITY_EXCEEDED,
+};
+
+namespace internal
+{
+/// @brief Base of the awaitables whose coroutine is suspended until the WaitSet of the CoroutineExecutor is triggered
+class CoroutineAwaiter
+{
+  public:
+    CoroutineAwaiter() noexcept = default;
+    CoroutineAwaiter(const CoroutineAwaiter&) = delete;
+    CoroutineAwaiter(CoroutineAwaiter&&) = delete;
+    CoroutineAwaiter& operator=(const CoroutineAwaiter&) = delete;
+    CoroutineAwaiter& operator=(CoroutineAwaiter&&) = delete;
+
+    /// @brief Tries to complete the awaited operation
+    /// @return true when the awaiting coroutine can be resumed, otherwise false
+    virtual bool tryComplete() noexcept = 0;
+
+    /// @brief Detaches the awaited origin from the WaitSet of the CoroutineExecutor
+    virtual void detach() noexcept = 0;
+
+    std::coroutine_handle<> m_continuation;
+
+  protected:
+    ~CoroutineAwaiter() noexcept = default;
+};
+
+template <typename PortT>
+constexpr SubscriberState dataAvailableState(const BaseSubscriber<PortT>&) noexcept;
+template <typename PortT, typename TriggerHandleT>
+constexpr ClientState dataAvailableState(const BaseClient<PortT, TriggerHandleT>&) noexcept;
+template <typename PortT, typename TriggerHandleT>
+constexpr ServerState dataAvailableState(const BaseServer<PortT, TriggerHandleT>&) noexcept;
+
+constexpr bool isNoDataAvailable(const ChunkReceiveResult result) noexcept;
+constexpr bool isNoDataAvailable(const ServerRequestResult result) noexcept;
+} // namespace internal
+
+template <uint64_t Capacity>
+class CoroutineExecutor;
+
+/// @brief Awaitable which resumes the awaiting coroutine with the result of 'take' as soon as the port has data or
+/// when 'take' fails for another reason than missing data
+/// @tparam Port the subscriber, client or server whose data is awaited
+/// @tparam State the state of the port which signals that data is available
+/// @tparam Capacity of the CoroutineExecutor
+template <typename Port, typename State, uint64_t Capacity>
+class TakeAwaitable : public internal::CoroutineAwaiter
+{
+  public:
+    using Result_t = decltype(std::declval<Port&>().take());
+
+    TakeAwaitable(CoroutineExecutor<Capacity>& executor, Port& port, const State dataAvailableState) noexcept;
+    TakeAwaitable(const TakeAwaitable&) = delete;
+    TakeAwaitable(TakeAwaitable&&) = delete;
+    TakeAwaitable& operator=(const TakeAwaitable&) = delete;
+    TakeAwaitable& operator=(TakeAwaitable&&) = delete;
+    ~TakeAwaitable() noexcept = default;
+
+    bool await_ready() noexcept;
+    bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+    Result_t await_resume() noexcept;
+
+    bool tryComplete() noexcept override;
+    void detach() noexcept override;
+
+  private:
+    CoroutineExecutor<Capacity>& m_executor;
+    Port& m_port;
+    State m_dataAvailableState;
+    optional<Result_t> m_result;
+};
+
+/// @brief Single threaded executor for coroutines which await the data of subscribers, clients and servers. All
+/// awaited ports are multiplexed on one WaitSet, therefore many logical consumers can run on one thread.
+/// @code
+///   CoroutineTask consume(CoroutineExecutor<>& executor, Subscriber<Topic>& subscriber)
+///   {
+///       while (true)
+///       {
+///           auto sample = co_await executor.take(subscriber);
+///           // ...
+///       }
+///   }
+///
+///   CoroutineExecutor<> executor;
+///   executor.spawn(consume(executor, subscriber));
+///   executor.run();
+/// @endcode
+/// @note The CoroutineExecutor is not thread-safe; the tasks are only resumed by the thread which calls run().
+/// @note A port is attached to the WaitSet of the CoroutineExecutor while a coroutine awaits it, therefore it must
+/// not be attached to another WaitSet or Listener meanwhile and it can be awaited by only one coroutine at a time.
+/// @param[in] Capacity the maximum number of tasks and of ports which can be awaited at the same time
+template <uint64_t Capacity = MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET>
+class CoroutineExecutor
+{
+  public:
+    CoroutineExecutor() noexcept = default;
+    CoroutineExecutor(const CoroutineExecutor&) = delete;
+    CoroutineExecutor(CoroutineExecutor&&) = delete;
+    CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+    CoroutineExecutor& operator=(CoroutineExecutor&&) = delete;
+
+    /// @brief Destroys the tasks which did not finish
+    ~CoroutineExecutor() noexcept;
+
+    /// @brief Adds a task which is started by run()
+    /// @param[in] task which shall be executed
+    /// @return TASK_CAPACITY_EXCEEDED when Capacity tasks are already spawned
+    expected<CoroutineExecutorError> spawn(CoroutineTask&& task) noexcept;
+
+    /// @brief Returns an awaitable which suspends the coroutine until the subscriber, client or server has data
+    /// @param[in] port whose data shall be taken
+    /// @return the awaitable whose result is the result of the 'take' call of the port
+    template <typename Port>
+    TakeAwaitable<Port, decltype(internal::dataAvailableState(std::declval<Port&>())), Capacity>
+    take(Port& port) noexcept;
+
+    /// @brief Returns an awaitable which suspends the coroutine until the given state of the port is set
+    /// @param[in] port whose data shall be taken
+    /// @param[in] dataAvailableState state of the port which signals that 'take' will succeed
+    /// @return the awaitable whose result is the result of the 'take' call of the port
+    template <typename Port, typename State>
+    TakeAwaitable<Port, State, Capacity> take(Port& port, const State dataAvailableState) noexcept;
+
+    /// @brief Executes the tasks until all of them finished or stop() was called
+    void run() noexcept;
+
+    /// @brief Non-reversible call which lets run() return, e.g. from within a task or a signal handler
+    void stop() noexcept;
+
+    /// @brief Returns the number of tasks which did not finish
+    uint64_t numberOfTasks() const noexcept;
+
+  protected:
+    explicit CoroutineExecutor(ConditionVariableData& condVarData) noexcept;
+
+  private:
+    template <typename Port, typename State, uint64_t>
+    friend class TakeAwaitable;
+
+    class ExecutorWaitSet : public WaitSet<Capacity>
+    {
+      public:
+        ExecutorWaitSet() noexcept = default;
+        explicit ExecutorWaitSet(ConditionVariableData& condVarData) noexcept;
+    };
+
+    template <typename Port, typename State>
+    bool suspend(internal::CoroutineAwaiter& awaiter, Port& port, const State dataAvailableState) noexcept;
+    void resumeReadyCoroutines() noexcept;
+    void destroyFinishedTasks() noexcept;
+
+    ExecutorWaitSet m_waitSet;
+    vector<CoroutineTask::Handle_t, Capacity> m_tasks;
+    vector<std::coroutine_handle<>, Capacity> m_readyCoroutines;
+    internal::CoroutineAwaiter* m_awaiters[Capacity]{};
+    std::atomic_bool m_stopRequested{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/coroutine_executor.inl"
+
+#endif // IOX_POSH_POPO_COROUTINE_EXECUTOR_HPP
@@ -0,0 +1,85 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_HISTOGRAM_HPP
+#define IOX_POSH_POPO_HISTOGRAM_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A histogram of unsigned integer values with a bounded relative error, similar to an HDR histogram.
+/// Values smaller than SUB_BUCKET_COUNT have their own bucket. Above, each range between two consecutive powers of two
+/// is split into SUB_BUCKET_COUNT buckets of equal width. Values larger than MAX_TRACKABLE_VALUE are counted in the
+/// last bucket. The histogram has a fixed size and can therefore be used as part of a shared memory topic.
+/// @note this is the plain data representation of the histogram; the ConcurrentHistogram is used to record values
+/// from multiple threads and processes and provides a snapshot of this type
+class Histogram
+{
+  public:
+    /// @brief 16 sub-buckets per power of two bound the relative error to 1/16, i.e. 6.25%
+    static constexpr uint32_t SUB_BUCKET_BITS{4U};
+    static constexpr uint32_t SUB_BUCKET_COUNT{1U << SUB_BUCKET_BITS};
+    /// @brief values up to about 68.7s when nanoseconds are recorded
+    static constexpr uint32_t MAGNITUDE_BITS{36U};
+    static constexpr uint64_t MAX_TRACKABLE_VALUE{(1ULL << MAGNITUDE_BITS) - 1U};
+    static constexpr uint32_t BUCKET_COUNT{(MAGNITUDE_BITS - SUB_BUCKET_BITS + 1U) * SUB_BUCKET_COUNT};
+
+    /// @brief Adds a value to the histogram
+    /// @param[in] value to add
+    void record(const uint64_t value) noexcept;
+
+    /// @brief Returns the number of values in a bucket
+    /// @param[in] bucketIndex of the bucket; must be smaller than BUCKET_COUNT
+    /// @return the number of values in the bucket or 0 if the index is out of bounds
+    uint64_t count(const uint32_t bucketIndex) const noexcept;
+
+    /// @brief Returns the number of values in all buckets
+    /// @return the total number of values
+    uint64_t totalCount() const noexcept;
+
+    /// @brief Estimates the value below which a given percentage of the recorded values fall
+    /// @param[in] percentile in the range [0, 100], e.g. 99.9 for the p999
+    /// @return the upper bound of the bucket which contains the percentile or 0 if the histogram is empty
+    uint64_t valueAtPercentile(const double percentile) const noexcept;
+
+    /// @brief Returns the index of the bucket a value is counted in
+    /// @param[in] value for which the bucket is determined
+    /// @return the bucket index
+    static uint32_t bucketIndex(const uint64_t value) noexcept;
+
+    /// @brief Returns the smallest value which is counted in a bucket
+    /// @param[in] bucketIndex of the bucket; must be smaller than BUCKET_COUNT
+    /// @return the lower bound of the bucket
+    static uint64_t bucketLowerBound(const uint32_t bucketIndex) noexcept;
+
+    /// @brief Returns the largest value which is counted in a bucket
+    /// @param[in] bucketIndex of the bucket; must be smaller than BUCKET_COUNT
+    /// @return the upper bound of the bucket
+    static uint64_t bucketUpperBound(const uint32_t bucketIndex) noexcept;
+
+  private:
+    friend class ConcurrentHistogram;
+
+    uint64_t m_counts[BUCKET_COUNT]{};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_HISTOGRAM_HPP
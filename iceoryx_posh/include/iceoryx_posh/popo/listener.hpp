@@ -23,11 +23,16 @@
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
+#include "iceoryx_posh/popo/notification_priority.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
+#include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -79,7 +84,8 @@ enum class ListenerError
 
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
-///        an encapsulated thread inside this class.
+///        an encapsulated thread inside this class. Optionally the callbacks are executed by a pool of worker threads,
+///        so that a slow callback does not delay the callbacks of the other events.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
@@ -103,6 +109,15 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief Creates a Listener which executes the callbacks in a pool of worker threads. The callbacks of different
+    ///        events are executed in parallel but the callback of one event is never executed concurrently to itself;
+    ///        if the event is notified while its callback is running, the callback is executed once more afterwards.
+    /// @param[in] numberOfWorkerThreads which execute the callbacks, limited to
+    ///            MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER with a warning; with 0 the callbacks are executed by the
+    ///            background thread of the Listener
+    explicit ListenerImpl(const uint64_t numberOfWorkerThreads) noexcept;
+
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -121,6 +136,8 @@ class ListenerImpl
     /// @param[in] eventType enum required to specify the type of event inside of eventOrigin
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the callbacks of events which occur together are executed in the order of their priority,
+    /// starting with the highest one
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T,
               typename EventType,
@@ -128,7 +145,8 @@ class ListenerImpl
               typename = std::enable_if_t<std::is_enum<EventType>::value>>
     expected<ListenerError> attachEvent(T& eventOrigin,
                                         const EventType eventType,
-                                        const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                        const NotificationCallback<T, ContextDataType>& eventCallback,
+                                        const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin and
     ///        the corresponding callback which will be called when the event occurs.
@@ -139,10 +157,13 @@ class ListenerImpl
     /// @param[in] eventOrigin the object which will signal the event (the origin)
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. Has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] priority the callbacks of events which occur together are executed in the order of their priority,
+    /// starting with the highest one
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T, typename ContextDataType>
     expected<ListenerError> attachEvent(T& eventOrigin,
-                                        const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                        const NotificationCallback<T, ContextDataType>& eventCallback,
+                                        const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief Detaches an event. Hereby, the event is defined as a class T, the eventOrigin and
     ///        the eventType with further specifies the event inside of eventOrigin
@@ -167,20 +188,45 @@ class ListenerImpl
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Sets how long the background thread busy polls for events before it blocks. This reduces the latency
+    ///        until a callback is executed at the cost of a fully utilized CPU core while spinning, therefore it is
+    ///        only reasonable when the Listener runs on an isolated core.
+    /// @note This method can be called from any thread concurrently without any restrictions!
+    /// @param[in] spinDuration how long the Listener busy polls at most, zero (the default) disables spinning
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns how long the background thread busy polls for events before it blocks
+    /// @return the spin duration, zero when spinning is disabled
+    units::Duration getSpinDuration() const noexcept;
+
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkerThreads = 0U) noexcept;
 
   private:
     class Event_t;
 
+    enum class DispatchState : uint8_t
+    {
+        IDLE,
+        SCHEDULED,
+        RUNNING,
+        RUNNING_AND_NOTIFIED
+    };
+
     void threadLoop() noexcept;
+    void workerLoop() noexcept;
+    void scheduleCallbacks(const ConditionListener::NotificationVector_t& eventIds) noexcept;
+    void pushScheduledEvent(const uint64_t eventId) noexcept;
+    uint64_t popScheduledEvent() noexcept;
+    void resetDispatchState(const uint64_t eventId) noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
                                                const uint64_t eventTypeHash,
                                                internal::GenericCallbackRef_t callback,
                                                internal::TranslationCallbackRef_t translationCallback,
-                                               const function<void(uint64_t)> invalidationCallback) noexcept;
+                                               const function<void(uint64_t)> invalidationCallback,
+                                               const NotificationPriority priority) noexcept;
 
     void removeTrigger(const uint64_t index) noexcept;
 
@@ -213,6 +259,22 @@ class ListenerImpl
     std::atomic_bool m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+
+    // the notified events are only sorted by priority when at least one event has a priority other than the default
+    std::atomic<NotificationPriority> m_eventPriorities[Capacity]{};
+    std::atomic<uint64_t> m_numberOfPrioritizedEvents{0U};
+
+    // the worker threads execute the scheduled events first in, first out, and the events which are notified together
+    // are scheduled in the order of their priority; an event is scheduled at most once, therefore the ring buffer of
+    // scheduled events can never overflow
+    vector<std::thread, MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER> m_workerThreads;
+    std::mutex m_workerMutex;
+    std::condition_variable m_workerWakeup;
+    bool m_stopWorkers{false};
+    DispatchState m_dispatchStates[Capacity]{};
+    uint64_t m_scheduledEvents[Capacity]{};
+    uint64_t m_scheduledEventsBegin{0U};
+    uint64_t m_numberOfScheduledEvents{0U};
 };
 
 class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
@@ -221,8 +283,12 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
 
+    /// @brief Creates a Listener which executes the callbacks in a pool of worker threads
+    /// @param[in] numberOfWorkerThreads which execute the callbacks, see ListenerImpl
+    explicit Listener(const uint64_t numberOfWorkerThreads) noexcept;
+
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkerThreads = 0U) noexcept;
 };
 
 } // namespace popo
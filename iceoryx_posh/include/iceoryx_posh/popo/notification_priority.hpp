@@ -0,0 +1,61 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
+#define IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The priority of an event or state which is attached to a WaitSet or Listener. Triggered events and states
+///        with a higher priority are returned by the WaitSet and dispatched by the Listener before the ones with a
+///        lower priority.
+using NotificationPriority = uint8_t;
+
+/// @brief The priority of events and states which are attached without an explicit priority
+constexpr NotificationPriority DEFAULT_NOTIFICATION_PRIORITY{0U};
+
+namespace internal
+{
+/// @brief Stable sort of notification indices by descending priority, i.e. the order of notification indices with
+///        the same priority is preserved. An insertion sort is used since the number of triggered notifications is
+///        small and no memory has to be allocated.
+/// @param[in] notificationIndices the indices which shall be sorted
+/// @param[in] getPriority callable which returns the priority of a notification index
+template <typename Vector, typename PriorityGetter>
+inline void sortByDescendingPriority(Vector& notificationIndices, const PriorityGetter& getPriority) noexcept
+{
+    for (uint64_t i = 1U; i < notificationIndices.size(); ++i)
+    {
+        const auto notificationIndex = notificationIndices[i];
+        const NotificationPriority priority = getPriority(notificationIndex);
+        uint64_t position = i;
+        while (position > 0U && getPriority(notificationIndices[position - 1U]) < priority)
+        {
+            notificationIndices[position] = notificationIndices[position - 1U];
+            --position;
+        }
+        notificationIndices[position] = notificationIndex;
+    }
+}
+} // namespace internal
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_NOTIFICATION_PRIORITY_HPP
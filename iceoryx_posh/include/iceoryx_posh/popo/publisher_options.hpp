@@ -44,6 +44,10 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the publisher sets the publish timestamp in the ChunkHeader of each sent chunk
+    /// @note this has only an effect if iceoryx is built with the IOX_PUBLISH_TIMESTAMPS option
+    bool publishTimestamp{false};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
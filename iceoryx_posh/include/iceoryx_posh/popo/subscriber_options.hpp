@@ -19,8 +19,10 @@
 
 #include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
 #include "port_queue_policies.hpp"
+#include "user_header_filter.hpp"
 
 #include "iceoryx_dust/cxx/serialization.hpp"
+#include "iox/duration.hpp"
 
 #include <cstdint>
 
@@ -51,6 +53,18 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The filter which is evaluated by the publisher on the user-header of each chunk before it is pushed
+    ///        into the receiver queue; chunks which do not match are neither enqueued nor do they cause a wakeup
+    UserHeaderFilter userHeaderFilter{};
+
+    /// @brief Only every n-th chunk is delivered to the subscriber, the others are discarded by the publisher without
+    ///        being enqueued; a value of 0 or 1 delivers every chunk
+    uint64_t decimationFactor{1U};
+
+    /// @brief The minimum time between two chunks delivered to the subscriber; chunks arriving earlier are discarded
+    ///        by the publisher without being enqueued; zero disables the rate limit
+    units::Duration minimumDeliveryInterval{units::Duration::zero()};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
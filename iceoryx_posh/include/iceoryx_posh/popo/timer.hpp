@@ -0,0 +1,109 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_HPP
+#define IOX_POSH_POPO_TIMER_HPP
+
+#include "iceoryx_posh/popo/timer_scheduler.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iox/duration.hpp"
+#include "iox/expected.hpp"
+
+namespace iox
+{
+namespace popo
+{
+enum class TimerMode : uint8_t
+{
+    /// @brief the timer triggers once when the interval elapsed after start()
+    ONE_SHOT,
+    /// @brief the timer triggers every interval after start() until it is stopped
+    PERIODIC,
+};
+
+/// @brief An event based trigger which is triggered when its interval elapsed. It can be attached to a WaitSet or
+///        Listener like every other event, all Timers of one TimerScheduler share its background thread.
+///        A ONE_SHOT Timer which is restarted whenever a sample arrives serves as watchdog which is triggered when no
+///        sample was received within the interval.
+/// @note When a PERIODIC Timer misses periods, e.g. since the system was suspended, it is triggered only once and
+///       continues with the next period in the future.
+class Timer
+{
+  public:
+    /// @brief Creates a stopped Timer
+    /// @param[in] timerScheduler which triggers the Timer, it must outlive the Timer
+    /// @param[in] interval after which the Timer is triggered
+    /// @param[in] mode whether the Timer is triggered once or periodically
+    Timer(TimerScheduler& timerScheduler, const units::Duration interval, const TimerMode mode) noexcept;
+    Timer(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer& operator=(Timer&&) = delete;
+
+    /// @brief Stops the Timer and detaches it from the WaitSet/Listener
+    ~Timer() noexcept;
+
+    /// @brief Starts the Timer. When it is already running it is restarted, i.e. the interval starts again.
+    /// @return TIMER_SCHEDULER_FULL when the TimerScheduler already runs its maximum number of Timers or
+    ///         ZERO_PERIOD when a PERIODIC Timer has an interval of zero
+    expected<TimerError> start() noexcept;
+
+    /// @brief Stops the Timer, it is not triggered until it is started again
+    void stop() noexcept;
+
+    /// @brief Returns true when the Timer was started and did not yet expire (ONE_SHOT) or was not stopped
+    bool isRunning() const noexcept;
+
+    /// @brief Returns the interval of the Timer
+    units::Duration getInterval() const noexcept;
+
+    /// @brief Returns the mode of the Timer
+    TimerMode getMode() const noexcept;
+
+    /// @brief Checks if the Timer was triggered
+    /// @note The hasTriggered state will be reset after it was handled by a WaitSet/Listener
+    bool hasTriggered() const noexcept;
+
+    friend class NotificationAttorney;
+    friend class TimerScheduler;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    ///        trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Resets the internal triggerHandle
+    void disableEvent() noexcept;
+
+    /// @brief Called by the TimerScheduler when the interval elapsed
+    void trigger() noexcept;
+
+  private:
+    TimerScheduler* m_timerScheduler{nullptr};
+    units::Duration m_interval;
+    TimerMode m_mode;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_HPP
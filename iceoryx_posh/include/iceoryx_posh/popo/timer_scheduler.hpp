@@ -0,0 +1,110 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_SCHEDULER_HPP
+#define IOX_POSH_POPO_TIMER_SCHEDULER_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/expected.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+class Timer;
+
+enum class TimerError : uint8_t
+{
+    TIMER_SCHEDULER_FULL,
+    ZERO_PERIOD,
+};
+
+/// @brief Multiplexes the deadlines of many Timers on one background thread. The thread only triggers the Timers
+///        which expired, the corresponding callbacks are executed by the WaitSet or Listener to which the Timers are
+///        attached, therefore timing and data handling run on the same thread.
+/// @code
+///   TimerScheduler timerScheduler;
+///   Timer cyclicTimer(timerScheduler, 100_ms, TimerMode::PERIODIC);
+///   Timer dataWatchdog(timerScheduler, 1_s, TimerMode::ONE_SHOT);
+///
+///   waitset.attachEvent(cyclicTimer, 0U);
+///   waitset.attachEvent(dataWatchdog, 1U);
+///   waitset.attachState(subscriber, SubscriberState::HAS_DATA, 2U);
+///   cyclicTimer.start();
+///   dataWatchdog.start();
+///
+///   // every received sample restarts the dataWatchdog, it expires only when no sample arrives within one second
+/// @endcode
+/// @note The TimerScheduler must outlive all Timers which were created with it
+class TimerScheduler
+{
+  public:
+    using Clock_t = std::chrono::steady_clock;
+
+    TimerScheduler() noexcept;
+    TimerScheduler(const TimerScheduler&) = delete;
+    TimerScheduler(TimerScheduler&&) = delete;
+    TimerScheduler& operator=(const TimerScheduler&) = delete;
+    TimerScheduler& operator=(TimerScheduler&&) = delete;
+    ~TimerScheduler() noexcept;
+
+    /// @brief Returns the maximum number of Timers which can run at the same time
+    static constexpr uint64_t capacity() noexcept;
+
+    /// @brief Returns the number of running Timers
+    uint64_t size() const noexcept;
+
+  private:
+    friend class Timer;
+
+    struct ScheduledTimer
+    {
+        Timer* timer{nullptr};
+        Clock_t::time_point deadline;
+    };
+
+    /// @brief Schedules the timer for the point in time when its interval elapsed, reschedules it when it is already
+    ///        scheduled
+    expected<TimerError> schedule(Timer& timer) noexcept;
+    void unschedule(const Timer& timer) noexcept;
+    bool isScheduled(const Timer& timer) const noexcept;
+
+    void threadLoop() noexcept;
+    void triggerExpiredTimers(const Clock_t::time_point now) noexcept;
+
+  private:
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_wasDtorCalled{false};
+    vector<ScheduledTimer, MAX_NUMBER_OF_TIMERS_PER_TIMER_SCHEDULER> m_scheduledTimers;
+    std::thread m_thread;
+};
+
+constexpr uint64_t TimerScheduler::capacity() noexcept
+{
+    return MAX_NUMBER_OF_TIMERS_PER_TIMER_SCHEDULER;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_SCHEDULER_HPP
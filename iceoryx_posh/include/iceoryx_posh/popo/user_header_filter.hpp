@@ -0,0 +1,133 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+#define IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+
+#include "iceoryx_dust/cxx/serialization.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/expected.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The comparison which is applied between a user-header field and the reference value of a condition
+enum class UserHeaderFieldComparison : uint8_t
+{
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    LESS_OR_EQUAL,
+    GREATER,
+    GREATER_OR_EQUAL
+};
+
+enum class UserHeaderFilterError
+{
+    TOO_MANY_CONDITIONS,
+    INVALID_FIELD_SIZE
+};
+
+/// @brief A single comparison of an unsigned integer field in the user-header with a reference value
+struct UserHeaderFieldCondition
+{
+    /// @brief The offset of the field in bytes, relative to the start of the user-header
+    uint32_t offset{0U};
+    /// @brief The size of the field in bytes; must be 1, 2, 4 or 8
+    uint32_t size{0U};
+    UserHeaderFieldComparison comparison{UserHeaderFieldComparison::EQUAL};
+    uint64_t value{0U};
+};
+
+/// @brief The UserHeaderFilter is a predicate over the user-header of a chunk. It is stored in the shared memory
+/// alongside the ChunkQueueData of a subscriber and evaluated by the ChunkDistributor of the publisher before a chunk
+/// is pushed into the queue. Chunks which do not match are neither enqueued nor do they trigger a notification.
+/// All conditions must be fulfilled for a chunk to match. A filter without conditions matches every chunk.
+/// @note A chunk whose user-header is too small to contain a field of a condition does not match
+/// @code
+///     struct MyHeader
+///     {
+///         uint16_t channel;
+///     };
+///
+///     SubscriberOptions options;
+///     options.userHeaderFilter.addCondition(offsetof(MyHeader, channel), UserHeaderFieldComparison::EQUAL,
+///     uint16_t{3});
+/// @endcode
+class UserHeaderFilter
+{
+  public:
+    static constexpr uint64_t MAX_CONDITIONS{4U};
+
+    /// @brief Adds a condition to the filter
+    /// @param[in] offset of the field in bytes, relative to the start of the user-header
+    /// @param[in] size of the field in bytes; must be 1, 2, 4 or 8
+    /// @param[in] comparison which is applied as 'field <comparison> value'
+    /// @param[in] value is the reference value for the comparison
+    /// @return an error if the field size is invalid or the filter has already MAX_CONDITIONS conditions
+    expected<UserHeaderFilterError> addCondition(const uint32_t offset,
+                                                 const uint32_t size,
+                                                 const UserHeaderFieldComparison comparison,
+                                                 const uint64_t value) noexcept;
+
+    /// @brief Adds a condition to the filter with the field size deduced from the type of the reference value
+    /// @tparam T is the unsigned integer type of the user-header field
+    /// @param[in] offset of the field in bytes, relative to the start of the user-header
+    /// @param[in] comparison which is applied as 'field <comparison> value'
+    /// @param[in] value is the reference value for the comparison
+    /// @return an error if the filter has already MAX_CONDITIONS conditions
+    template <typename T>
+    expected<UserHeaderFilterError>
+    addCondition(const uint32_t offset, const UserHeaderFieldComparison comparison, const T value) noexcept;
+
+    /// @brief Checks whether the filter has any conditions
+    /// @return true if there is at least one condition, false otherwise
+    bool hasConditions() const noexcept;
+
+    /// @brief Evaluates the filter on the user-header of a chunk
+    /// @param[in] chunkHeader of the chunk to evaluate
+    /// @return true if all conditions are fulfilled, false otherwise
+    bool matches(const mepoo::ChunkHeader& chunkHeader) const noexcept;
+
+    /// @brief serialization of the UserHeaderFilter
+    cxx::Serialization serialize() const noexcept;
+    /// @brief deserialization of the UserHeaderFilter
+    static expected<UserHeaderFilter, cxx::Serialization::Error>
+    deserialize(const cxx::Serialization& serialized) noexcept;
+
+    friend bool operator==(const UserHeaderFilter& lhs, const UserHeaderFilter& rhs) noexcept;
+
+  private:
+    static bool isValidFieldSize(const uint32_t size) noexcept;
+    static bool evaluate(const UserHeaderFieldCondition& condition, const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+  private:
+    vector<UserHeaderFieldCondition, MAX_CONDITIONS> m_conditions;
+};
+
+bool operator!=(const UserHeaderFilter& lhs, const UserHeaderFilter& rhs) noexcept;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/user_header_filter.inl"
+
+#endif // IOX_POSH_POPO_USER_HEADER_FILTER_HPP
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/notification_info.hpp"
+#include "iceoryx_posh/popo/notification_priority.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -58,6 +59,7 @@ class WaitSet
     static constexpr uint64_t CAPACITY = Capacity;
     using TriggerArray = optional<Trigger>[Capacity];
     using NotificationInfoVector = vector<const NotificationInfo*, CAPACITY>;
+    using NotificationInfoCallback = function_ref<void(const NotificationInfo&)>;
 
     WaitSet() noexcept;
     ~WaitSet() noexcept;
@@ -82,6 +84,7 @@ class WaitSet
     /// @param[in] eventType the event specified by the class
     /// @param[in] notificationId an arbitrary user defined id for the event
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait() and timedWait()
     template <typename T,
               typename EventType,
               typename ContextDataType = popo::internal::NoType_t,
@@ -89,7 +92,8 @@ class WaitSet
     expected<WaitSetError> attachEvent(T& eventOrigin,
                                        const EventType eventType,
                                        const uint64_t notificationId = 0U,
-                                       const NotificationCallback<T, ContextDataType>& eventCallback = {}) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& eventCallback = {},
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
@@ -97,13 +101,15 @@ class WaitSet
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] eventType the event specified by the class
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait() and timedWait()
     template <typename T,
               typename EventType,
               typename ContextDataType = popo::internal::NoType_t,
               typename = std::enable_if_t<std::is_enum<EventType>::value, void>>
     expected<WaitSetError> attachEvent(T& eventOrigin,
                                        const EventType eventType,
-                                       const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& eventCallback,
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
@@ -111,19 +117,23 @@ class WaitSet
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] notificationId an arbitrary user defined id for the event
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait() and timedWait()
     template <typename T, typename ContextDataType = popo::internal::NoType_t>
     expected<WaitSetError> attachEvent(T& eventOrigin,
                                        const uint64_t notificationId = 0U,
-                                       const NotificationCallback<T, ContextDataType>& eventCallback = {}) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& eventCallback = {},
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches an event of a given class to the WaitSet.
     /// @note attachEvent does not take ownership of callback in the underlying eventCallback or the optional
     /// contextData. The user has to ensure that both will live as long as the event is attached.
     /// @param[in] eventOrigin the class from which the event originates.
     /// @param[in] eventCallback a callback which should be assigned to the event
+    /// @param[in] priority triggered events with a higher priority are returned first by wait() and timedWait()
     template <typename T, typename ContextDataType = popo::internal::NoType_t>
     expected<WaitSetError> attachEvent(T& eventOrigin,
-                                       const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& eventCallback,
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -132,6 +142,7 @@ class WaitSet
     /// @param[in] stateType the state specified by the class
     /// @param[in] id an arbitrary user defined id for the state
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait() and timedWait()
     template <typename T,
               typename StateType,
               typename ContextDataType = popo::internal::NoType_t,
@@ -139,7 +150,8 @@ class WaitSet
     expected<WaitSetError> attachState(T& stateOrigin,
                                        const StateType stateType,
                                        const uint64_t id = 0U,
-                                       const NotificationCallback<T, ContextDataType>& stateCallback = {}) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& stateCallback = {},
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -147,13 +159,15 @@ class WaitSet
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] stateType the state specified by the class
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait() and timedWait()
     template <typename T,
               typename StateType,
               typename ContextDataType = popo::internal::NoType_t,
               typename = std::enable_if_t<std::is_enum<StateType>::value, void>>
     expected<WaitSetError> attachState(T& stateOrigin,
                                        const StateType stateType,
-                                       const NotificationCallback<T, ContextDataType>& stateCallback) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& stateCallback,
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
@@ -161,19 +175,23 @@ class WaitSet
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] id an arbitrary user defined id for the state
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait() and timedWait()
     template <typename T, typename ContextDataType = popo::internal::NoType_t>
     expected<WaitSetError> attachState(T& stateOrigin,
                                        const uint64_t id = 0U,
-                                       const NotificationCallback<T, ContextDataType>& stateCallback = {}) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& stateCallback = {},
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief attaches a state of a given class to the WaitSet.
     /// @note attachState does not take ownership of callback in the underlying stateCallback or the optional
     /// contextData. The user has to ensure that both will live as long as the state is attached.
     /// @param[in] stateOrigin the class from which the state originates.
     /// @param[in] stateCallback a callback which should be assigned to the state
+    /// @param[in] priority triggered states with a higher priority are returned first by wait() and timedWait()
     template <typename T, typename ContextDataType = popo::internal::NoType_t>
     expected<WaitSetError> attachState(T& stateOrigin,
-                                       const NotificationCallback<T, ContextDataType>& stateCallback) noexcept;
+                                       const NotificationCallback<T, ContextDataType>& stateCallback,
+                                       const NotificationPriority priority = DEFAULT_NOTIFICATION_PRIORITY) noexcept;
 
     /// @brief detaches an event from the WaitSet
     /// @param[in] eventOrigin the origin of the event that should be detached
@@ -196,6 +214,70 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Blocking wait with time limit till one or more of the triggers are triggered. The NotificationInfos
+    ///        are stored in the provided vector instead of a newly created NotificationInfoVector, therefore a wait
+    ///        loop can reuse one vector whose capacity fits the expected number of notifications.
+    /// @param[in] timeout How long shall we wait for a trigger
+    /// @param[out] notificationInfos is cleared and filled with at most BufferCapacity triggered NotificationInfos.
+    ///             The remaining ones are not lost, the next call returns them without blocking.
+    /// @return the number of NotificationInfos stored in notificationInfos
+    template <uint64_t BufferCapacity>
+    uint64_t timedWait(const units::Duration timeout,
+                       vector<const NotificationInfo*, BufferCapacity>& notificationInfos) noexcept;
+
+    /// @brief Blocking wait till one or more of the triggers are triggered. The NotificationInfos are stored in the
+    ///        provided vector instead of a newly created NotificationInfoVector, therefore a wait loop can reuse one
+    ///        vector whose capacity fits the expected number of notifications.
+    /// @param[out] notificationInfos is cleared and filled with at most BufferCapacity triggered NotificationInfos.
+    ///             The remaining ones are not lost, the next call returns them without blocking.
+    /// @return the number of NotificationInfos stored in notificationInfos
+    template <uint64_t BufferCapacity>
+    uint64_t wait(vector<const NotificationInfo*, BufferCapacity>& notificationInfos) noexcept;
+
+    /// @brief Blocking wait with time limit till one or more of the triggers are triggered. Every triggered
+    ///        NotificationInfo is handed to the callback instead of being collected in a NotificationInfoVector.
+    /// @note  The callback must not call wait() or timedWait() of the same WaitSet
+    /// @param[in] timeout How long shall we wait for a trigger
+    /// @param[in] callback which is called with every triggered NotificationInfo
+    /// @param[in] maxNumberOfNotifications the maximum number of NotificationInfos which are handed to the
+    ///            callback; the remaining ones are not lost, the next call returns them without blocking
+    /// @return the number of NotificationInfos which were handed to the callback
+    uint64_t timedWait(const units::Duration timeout,
+                       const NotificationInfoCallback& callback,
+                       const uint64_t maxNumberOfNotifications = Capacity) noexcept;
+
+    /// @brief Blocking wait till one or more of the triggers are triggered. Every triggered NotificationInfo is
+    ///        handed to the callback instead of being collected in a NotificationInfoVector.
+    /// @note  The callback must not call wait() or timedWait() of the same WaitSet
+    /// @param[in] callback which is called with every triggered NotificationInfo
+    /// @param[in] maxNumberOfNotifications the maximum number of NotificationInfos which are handed to the
+    ///            callback; the remaining ones are not lost, the next call returns them without blocking
+    /// @return the number of NotificationInfos which were handed to the callback
+    uint64_t wait(const NotificationInfoCallback& callback,
+                  const uint64_t maxNumberOfNotifications = Capacity) noexcept;
+
+    /// @brief Sets how long wait() and timedWait() busy poll for triggers before they block. This reduces the
+    ///        wakeup latency for latency critical threads on isolated cores at the cost of a fully utilized CPU core
+    ///        while spinning. With timedWait() the spinning is part of the timeout.
+    /// @param[in] spinDuration how long the WaitSet busy polls at most, zero (the default) disables spinning
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns how long wait() and timedWait() busy poll for triggers before they block
+    units::Duration getSpinDuration() const noexcept;
+
+    /// @brief Returns a file descriptor which becomes readable when one or more of the triggers are triggered. It can
+    ///        be added to an existing epoll, poll or select based event loop so that no extra thread is required to
+    ///        wait for the WaitSet. When it is readable, timedWait() with a zero duration returns the triggered
+    ///        triggers without blocking and makes the file descriptor unreadable again.
+    /// @note  The file descriptor is owned by the WaitSet and is valid as long as the WaitSet exists. It may become
+    ///        readable without a triggered trigger, e.g. when a state based trigger was reset meanwhile.
+    ///        It stays readable as long as triggered triggers are left, e.g. due to maxNumberOfNotifications.
+    /// @note  The triggers are notified via a socket in the abstract namespace which is separate for every network
+    ///        namespace. When a trigger is notified from a process in another network namespace, the WaitSet is
+    ///        woken up but the file descriptor does not become readable.
+    /// @return the file descriptor or NotificationSocketError::NOT_SUPPORTED on platforms other than Linux
+    expected<int32_t, NotificationSocketError> getFileDescriptor() noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -223,10 +305,20 @@ class WaitSet
                                                 const uint64_t notificationId,
                                                 const NotificationCallback<T, ContextDataType>& eventCallback,
                                                 const uint64_t originType,
-                                                const uint64_t originTypeHash) noexcept;
-
-    NotificationInfoVector waitAndReturnTriggeredTriggers(const WaitFunction& wait) noexcept;
-    NotificationInfoVector createVectorWithTriggeredTriggers() noexcept;
+                                                const uint64_t originTypeHash,
+                                                const NotificationPriority priority) noexcept;
+
+    uint64_t waitAndProcessTriggeredTriggers(const WaitFunction& wait,
+                                             const NotificationInfoCallback& callback,
+                                             const uint64_t maxNumberOfNotifications) noexcept;
+    uint64_t processTriggeredTriggers(const NotificationInfoCallback& callback,
+                                      const uint64_t maxNumberOfNotifications) noexcept;
+    uint64_t processTriggeredTriggersByPriority(const NotificationInfoCallback& callback,
+                                                const uint64_t maxNumberOfNotifications) noexcept;
+    bool processTriggeredTrigger(const uint64_t index,
+                                 const NotificationInfoCallback& callback,
+                                 uint64_t& numberOfProcessedNotifications) noexcept;
+    void removeProcessedNotifications(const bool (&doRemoveNotificationId)[Capacity]) noexcept;
 
     void removeTrigger(const uint64_t uniqueTriggerId) noexcept;
     void removeAllTriggers() noexcept;
@@ -240,6 +332,12 @@ class WaitSet
 
     stack<uint64_t, Capacity> m_indexRepository;
     ConditionListener::NotificationVector_t m_activeNotifications;
+    /// the next call of processTriggeredTriggers starts with the highest active trigger index below this bound
+    uint64_t m_roundRobinIndexBound{Capacity};
+
+    // the triggers are only sorted by priority when at least one trigger has a priority other than the default one
+    NotificationPriority m_triggerPriorities[Capacity]{};
+    uint64_t m_numberOfPrioritizedTriggers{0U};
 };
 
 } // namespace popo
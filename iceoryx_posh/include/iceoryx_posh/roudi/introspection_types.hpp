@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/histogram.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -118,6 +120,16 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // monotonic counters of the subscriber queue which are never reset
+    uint64_t lostChunksCount{0};
+    uint64_t maxQueueFillLevel{0};
+    uint64_t receivedChunksCount{0};
+    // percentiles of the time between sending and taking of the chunks which carry a publish timestamp; the
+    // latencies are only recorded if iceoryx is built with PUBLISH_TIMESTAMPS and the publisher enables them
+    uint64_t latencySampleCount{0};
+    uint64_t latencyP50InNanoseconds{0};
+    uint64_t latencyP99InNanoseconds{0};
+    uint64_t latencyP999InNanoseconds{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
@@ -125,6 +137,45 @@ struct SubscriberPortChangingIntrospectionFieldTopic
     vector<SubscriberPortChangingData, MAX_SUBSCRIBERS> subscriberPortChangingDataList;
 };
 
+const capro::ServiceDescription
+    IntrospectionPortHistogramService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortHistograms");
+
+struct PublisherPortHistogramData
+{
+    uint64_t m_publisherPortID{0};
+    // only recorded if iceoryx is built with PUBLISH_TIMESTAMPS and the publisher enables them
+    popo::Histogram m_sendIntervalInNanoseconds;
+};
+
+struct SubscriberPortHistogramData
+{
+    // index used to identify subscriber is same as in PortIntrospectionFieldTopic->subscriberList
+    popo::Histogram m_queueDepthAtPush;
+    // time between sending and taking of a chunk; only recorded for chunks with a publish timestamp
+    popo::Histogram m_timeInQueueInNanoseconds;
+};
+
+/// @brief the maximum number of publisher and of subscriber ports with histograms in one sample; 0 disables the
+/// port histograms, i.e. they are neither recorded nor published and no memory is reserved for them
+constexpr uint32_t MAX_PORT_HISTOGRAMS{build::IOX_MAX_PORT_HISTOGRAMS};
+
+/// @brief the topic for the port histograms that a user can subscribe to
+struct PortHistogramIntrospectionFieldTopic
+{
+    // the capacity must not be 0 in order to be able to instantiate the topic when the port histograms are disabled
+    vector<PublisherPortHistogramData, algorithm::maxVal(MAX_PORT_HISTOGRAMS, 1U)> m_publisherList;
+    vector<SubscriberPortHistogramData, algorithm::maxVal(MAX_PORT_HISTOGRAMS, 1U)> m_subscriberList;
+    /// @brief the number of ports which exceed MAX_PORT_HISTOGRAMS and are therefore not part of the lists
+    uint64_t m_numberOfOmittedPorts{0U};
+};
+
+/// @brief the queue capacity of the subscribers of the port histograms; a sample is about the size of
+/// 3 * MAX_PORT_HISTOGRAMS histograms, therefore only the latest one is queued and RouDi limits larger requests to it
+constexpr uint32_t PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY{1U};
+/// @brief the number of subscribers of the port histograms which can queue and hold samples at the same time without
+/// exhausting the introspection memory
+constexpr uint32_t MAX_PORT_HISTOGRAM_SUBSCRIBERS{4U};
+
 const capro::ServiceDescription IntrospectionProcessService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Process");
 
 struct ProcessIntrospectionData
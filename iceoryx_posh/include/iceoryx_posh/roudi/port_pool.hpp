@@ -28,6 +28,8 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -54,6 +56,7 @@ enum class PortPoolError : uint8_t
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    HEARTBEAT_LIST_FULL,
 };
 
 class PortPool
@@ -71,6 +74,54 @@ class PortPool
     vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES> getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the publisher ports with the provided service description without iterating over all ports
+    /// @param[in] service of the publisher ports
+    /// @return the publisher ports with this service description in the order they were added
+    ServicePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS>::PortList_t
+    getPublisherPortDataListOfService(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief Returns the subscriber ports with the provided service description without iterating over all ports
+    /// @param[in] service of the subscriber ports
+    /// @return the subscriber ports with this service description in the order they were added
+    ServicePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS>::PortList_t
+    getSubscriberPortDataListOfService(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief Returns the client ports with the provided service description without iterating over all ports
+    /// @param[in] service of the client ports
+    /// @return the client ports with this service description in the order they were added
+    ServicePortIndex<popo::ClientPortData, MAX_CLIENTS>::PortList_t
+    getClientPortDataListOfService(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief Returns the server ports with the provided service description without iterating over all ports
+    /// @param[in] service of the server ports
+    /// @return the server ports with this service description in the order they were added
+    ServicePortIndex<popo::ServerPortData, MAX_SERVERS>::PortList_t
+    getServerPortDataListOfService(const capro::ServiceDescription& service) const noexcept;
+
+    /// @brief The condition variable which is notified by the ports whenever a discovery run is required
+    /// @return reference to the discovery condition variable
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
+    /// @brief Collects the publisher ports which requested a discovery run since the last call
+    /// @return the publisher ports which have to be processed by the discovery
+    vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getDirtyPublisherPortDataList() noexcept;
+
+    /// @brief Collects the subscriber ports which requested a discovery run since the last call
+    /// @return the subscriber ports which have to be processed by the discovery
+    vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getDirtySubscriberPortDataList() noexcept;
+
+    /// @brief Collects the client ports which requested a discovery run since the last call
+    /// @return the client ports which have to be processed by the discovery
+    vector<popo::ClientPortData*, MAX_CLIENTS> getDirtyClientPortDataList() noexcept;
+
+    /// @brief Collects the server ports which requested a discovery run since the last call
+    /// @return the server ports which have to be processed by the discovery
+    vector<popo::ServerPortData*, MAX_SERVERS> getDirtyServerPortDataList() noexcept;
+
+    /// @brief Marks every port as dirty so that the next discovery run processes all ports, e.g. to recover from a
+    /// lost notification
+    void markAllPortsDirty() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -134,6 +185,10 @@ class PortPool
     expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds a Heartbeat to the internal pool
+    /// @return on success a pointer to a Heartbeat; on error a PortPoolError
+    expected<runtime::Heartbeat*, PortPoolError> addHeartbeat() noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -154,6 +209,26 @@ class PortPool
     /// @note after this call the provided ServerPortData is no longer available for usage
     void removeServerPort(const popo::ServerPortData* const portData) noexcept;
 
+    /// @brief Removes a PublisherPortData from the service index but keeps it in the internal pool, e.g. until its
+    ///        chunks are released; it is no longer returned by getPublisherPortDataListOfService
+    /// @param[in] portData is a pointer to the PublisherPortData to be removed from the service index
+    void removePublisherPortFromServiceIndex(const PublisherPortRouDiType::MemberType_t* const portData) noexcept;
+
+    /// @brief Removes a SubscriberPortData from the service index but keeps it in the internal pool, e.g. until its
+    ///        chunks are released; it is no longer returned by getSubscriberPortDataListOfService
+    /// @param[in] portData is a pointer to the SubscriberPortData to be removed from the service index
+    void removeSubscriberPortFromServiceIndex(const SubscriberPortType::MemberType_t* const portData) noexcept;
+
+    /// @brief Removes a ClientPortData from the service index but keeps it in the internal pool, e.g. until its
+    ///        chunks are released; it is no longer returned by getClientPortDataListOfService
+    /// @param[in] portData is a pointer to the ClientPortData to be removed from the service index
+    void removeClientPortFromServiceIndex(const popo::ClientPortData* const portData) noexcept;
+
+    /// @brief Removes a ServerPortData from the service index but keeps it in the internal pool, e.g. until its
+    ///        chunks are released; it is no longer returned by getServerPortDataListOfService
+    /// @param[in] portData is a pointer to the ServerPortData to be removed from the service index
+    void removeServerPortFromServiceIndex(const popo::ServerPortData* const portData) noexcept;
+
     /// @brief Removes a InterfacePortData from the internal pool
     /// @param[in] portData is a  pointer to the InterfacePortData to be removed
     /// @note after this call the provided InterfacePortData is no longer available for usage
@@ -169,8 +244,32 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes a Heartbeat from the internal pool
+    /// @param[in] heartbeat is a pointer to the Heartbeat to be removed
+    /// @note after this call the provided Heartbeat is no longer available for usage
+    void removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept;
+
   private:
+    /// @brief Attaches the port to the discovery condition variable and to its dirty port list and notifies the
+    ///        discovery, since a newly added port always requires a discovery run, e.g. to process the offerOnCreate
+    ///        or subscribeOnCreate options
+    /// @param[in] portData of the newly added port
+    /// @param[in] dirtyPortList in which the port marks itself
+    /// @param[in] index of the port in its FixedPositionContainer
+    void attachToDiscovery(popo::BasePortData& portData,
+                           popo::DirtyPortList& dirtyPortList,
+                           const uint64_t index) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    vector<T*, Capacity> collectDirtyPorts(FixedPositionContainer<T, Capacity>& container,
+                                           popo::DirtyPortList& dirtyPortList) noexcept;
+
     PortPoolData* m_portPoolData;
+
+    ServicePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS> m_publisherPortIndex;
+    ServicePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    ServicePortIndex<popo::ClientPortData, MAX_CLIENTS> m_clientPortIndex;
+    ServicePortIndex<popo::ServerPortData, MAX_SERVERS> m_serverPortIndex;
 };
 
 } // namespace roudi
@@ -52,6 +52,22 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         subscriberOptions,
         memoryInfo);
 }
+
+template <typename T, uint64_t Capacity>
+inline vector<T*, Capacity> PortPool::collectDirtyPorts(FixedPositionContainer<T, Capacity>& container,
+                                                        popo::DirtyPortList& dirtyPortList) noexcept
+{
+    vector<T*, Capacity> dirtyPorts;
+    dirtyPortList.collect([&](const uint64_t index) {
+        // the port might have been removed after it was marked
+        auto port = container.get(index);
+        if (port != nullptr)
+        {
+            dirtyPorts.emplace_back(port);
+        }
+    });
+    return dirtyPorts;
+}
 } // namespace roudi
 } // namespace iox
 
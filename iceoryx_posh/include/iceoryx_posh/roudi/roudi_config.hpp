@@ -16,7 +16,11 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 #define IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 
+#include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 
@@ -24,8 +28,32 @@ namespace iox
 {
 namespace config
 {
+/// @brief A port of the deployment manifest; RouDi creates it in advance for the given runtime which claims it on
+///        startup instead of requesting it from RouDi
+struct ManifestPortEntry
+{
+    enum class PortType : uint8_t
+    {
+        PUBLISHER,
+        SUBSCRIBER
+    };
+
+    PortType m_portType{PortType::PUBLISHER};
+    RuntimeName_t m_runtimeName;
+    capro::ServiceDescription m_serviceDescription;
+    /// @brief only used if m_portType is PortType::PUBLISHER
+    popo::PublisherOptions m_publisherOptions;
+    /// @brief only used if m_portType is PortType::SUBSCRIBER
+    popo::SubscriberOptions m_subscriberOptions;
+};
+
 struct RouDiConfig
 {
+    using ManifestPorts_t = vector<ManifestPortEntry, MAX_NUMBER_OF_MANIFEST_PORTS>;
+
+    /// @brief The ports of the deployment manifest which are created by RouDi on startup
+    ManifestPorts_t m_manifestPorts;
+
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
 };
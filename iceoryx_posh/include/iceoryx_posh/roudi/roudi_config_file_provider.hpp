@@ -35,6 +35,10 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED - the max number of publishers and subscribers in the manifest is exceeded
+/// MANIFEST_PORT_WITHOUT_RUNTIME_NAME - runtime name not specified for a publisher or subscriber of the manifest
+/// MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION - service, instance or event not specified for a publisher or subscriber
+/// of the manifest
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +50,9 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED,
+    MANIFEST_PORT_WITHOUT_RUNTIME_NAME,
+    MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +65,9 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED",
+                                                                 "MANIFEST_PORT_WITHOUT_RUNTIME_NAME",
+                                                                 "MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
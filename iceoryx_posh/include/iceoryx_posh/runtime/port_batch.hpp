@@ -0,0 +1,132 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_BATCH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/variant.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Collects the ports of an application which are created together with PoshRuntime::createPorts in as few
+///        requests to the RouDi daemon as possible
+/// @code
+///     runtime::PortBatch batch;
+///     batch.addPublisher({"Radar", "FrontLeft", "Object"})
+///         .addSubscriber({"Vehicle", "Ego", "Speed"}, subscriberOptions)
+///         .addConditionVariables(1U);
+///     runtime::PoshRuntime::getInstance().createPorts(batch);
+///
+///     // the ports are taken from the batch without a further request to RouDi
+///     popo::Publisher<Object> publisher({"Radar", "FrontLeft", "Object"});
+/// @endcode
+class PortBatch
+{
+  public:
+    enum class PortType : uint32_t
+    {
+        PUBLISHER,
+        SUBSCRIBER,
+        CLIENT,
+        SERVER,
+        CONDITION_VARIABLE
+    };
+
+    using Options_t =
+        variant<popo::PublisherOptions, popo::SubscriberOptions, popo::ClientOptions, popo::ServerOptions>;
+
+    struct Entry
+    {
+        PortType portType{PortType::PUBLISHER};
+        capro::ServiceDescription service;
+        Options_t options;
+        PortConfigInfo portConfigInfo;
+    };
+
+    using Entries_t = vector<Entry, MAX_PORTS_PER_BATCH>;
+
+    /// @brief adds a publisher to the batch
+    /// @param[in] service the service description of the publisher
+    /// @param[in] publisherOptions the options of the publisher
+    /// @param[in] portConfigInfo the port config info of the publisher
+    /// @return reference to the batch to chain further ports
+    PortBatch& addPublisher(const capro::ServiceDescription& service,
+                            const popo::PublisherOptions& publisherOptions = {},
+                            const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a subscriber to the batch
+    /// @param[in] service the service description of the subscriber
+    /// @param[in] subscriberOptions the options of the subscriber
+    /// @param[in] portConfigInfo the port config info of the subscriber
+    /// @return reference to the batch to chain further ports
+    PortBatch& addSubscriber(const capro::ServiceDescription& service,
+                             const popo::SubscriberOptions& subscriberOptions = {},
+                             const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a client to the batch
+    /// @param[in] service the service description of the client
+    /// @param[in] clientOptions the options of the client
+    /// @param[in] portConfigInfo the port config info of the client
+    /// @return reference to the batch to chain further ports
+    PortBatch& addClient(const capro::ServiceDescription& service,
+                         const popo::ClientOptions& clientOptions = {},
+                         const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a server to the batch
+    /// @param[in] service the service description of the server
+    /// @param[in] serverOptions the options of the server
+    /// @param[in] portConfigInfo the port config info of the server
+    /// @return reference to the batch to chain further ports
+    PortBatch& addServer(const capro::ServiceDescription& service,
+                         const popo::ServerOptions& serverOptions = {},
+                         const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds condition variables, e.g. for the WaitSets and Listeners of the application, to the batch
+    /// @param[in] count the number of condition variables
+    /// @return reference to the batch to chain further ports
+    PortBatch& addConditionVariables(const uint64_t count) noexcept;
+
+    /// @brief the entries of the batch in the order they were added
+    const Entries_t& entries() const noexcept;
+
+    /// @brief the number of entries in the batch
+    uint64_t size() const noexcept;
+
+    /// @brief returns true if the batch contains no entries
+    bool empty() const noexcept;
+
+  private:
+    PortBatch& add(Entry&& entry) noexcept;
+
+    Entries_t m_entries;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_HPP
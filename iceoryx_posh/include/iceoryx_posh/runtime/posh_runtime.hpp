@@ -30,6 +30,7 @@
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
@@ -151,6 +152,22 @@ class PoshRuntime
     /// @return pointer to the data of the node
     virtual NodeData* createNode(const NodeProperty& nodeProperty) noexcept = 0;
 
+    /// @brief claims the ports which the RouDi daemon created for this runtime from the deployment manifest; a
+    ///        subsequent getMiddlewarePublisher or getMiddlewareSubscriber call with the service description and
+    ///        the options of a claimed port returns this port without a request to the RouDi daemon; a call with
+    ///        other options requests a new port
+    /// @return the number of claimed ports
+    virtual uint64_t claimManifestPorts() noexcept = 0;
+
+    /// @brief request the RouDi daemon to create all ports of the batch with as few requests as possible; a
+    ///        subsequent getMiddleware call with the service description and the options of a created port, or
+    ///        getMiddlewareConditionVariable for a created condition variable, returns this port without a request to
+    ///        the RouDi daemon; a call with other options requests a new port
+    /// @param[in] portBatch the ports to create
+    /// @return the number of created ports; ports which could not be created are requested individually on the
+    ///         getMiddleware call
+    virtual uint64_t createPorts(const PortBatch& portBatch) noexcept = 0;
+
     /// @brief send a request to the RouDi daemon and get the response
     ///        currently each request is followed by a response
     /// @param[in] msg request message to send
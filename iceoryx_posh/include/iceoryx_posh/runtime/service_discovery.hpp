@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_mirror.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -74,15 +75,20 @@ class ServiceDiscovery
     iox::popo::WaitSetIsConditionSatisfiedCallback
     getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state);
 
-    // use dynamic memory to reduce stack usage
-    /// @todo iox-#1155 improve solution to avoid stack usage without using dynamic memory
-    std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
+    ServiceRegistryMirror m_serviceRegistry;
     std::mutex m_serviceRegistryMutex;
 
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    popo::Subscriber<roudi::ServiceRegistryDelta> m_serviceRegistryDeltaSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {roudi::ServiceRegistryDelta::SUBSCRIBER_QUEUE_CAPACITY,
+         roudi::ServiceRegistryDelta::HISTORY_CAPACITY,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
     void update();
 };
 
@@ -17,6 +17,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_dust/cxx/std_string_support.hpp"
+#include "iox/string_hash.hpp"
 
 #include <iomanip>
 
@@ -229,6 +230,25 @@ bool serviceMatch(const ServiceDescription& first, const ServiceDescription& sec
     return (first.getServiceIDString() == second.getServiceIDString());
 }
 
+uint64_t IdStringHash::operator()(const IdString_t& value) const noexcept
+{
+    return StringHash()(value);
+}
+
+uint64_t ServiceDescriptionHash::operator()(const ServiceDescription& service) const noexcept
+{
+    // the combination depends on the order, otherwise e.g. {"a", "b", "c"} and {"b", "a", "c"} would always collide
+    auto combine = [](const uint64_t hash, const uint64_t value) {
+        return hash ^ (value + 0x9e3779b97f4a7c15ULL + (hash << 6U) + (hash >> 2U));
+    };
+
+    IdStringHash hashString;
+    uint64_t hash = hashString(service.getServiceIDString());
+    hash = combine(hash, hashString(service.getInstanceIDString()));
+    hash = combine(hash, hashString(service.getEventIDString()));
+    return hash;
+}
+
 std::ostream& operator<<(std::ostream& stream, const ServiceDescription& service) noexcept
 {
     /// @todo iox-#1141 Add classHash, scope and interface
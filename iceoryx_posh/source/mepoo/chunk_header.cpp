@@ -221,6 +221,22 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+#if IOX_POSH_PUBLISH_TIMESTAMPS
+    return m_publishTimestamp;
+#else
+    return 0U;
+#endif
+}
+
+void ChunkHeader::setPublishTimestamp(IOX_MAYBE_UNUSED const uint64_t publishTimestamp) noexcept
+{
+#if IOX_POSH_PUBLISH_TIMESTAMPS
+    m_publishTimestamp = publishTimestamp;
+#endif
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
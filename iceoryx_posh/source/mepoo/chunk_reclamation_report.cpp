@@ -0,0 +1,66 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+void ChunkReclamationReport::count(const SharedChunk& chunk) noexcept
+{
+    if (!chunk)
+    {
+        return;
+    }
+
+    const auto chunkSize = chunk.getChunkHeader()->chunkSize();
+    for (auto& memPool : m_memPools)
+    {
+        if (memPool.chunkSize == chunkSize)
+        {
+            ++memPool.numberOfChunks;
+            return;
+        }
+    }
+
+    // there are never more chunk sizes than mempools, therefore the entry always fits
+    m_memPools.emplace_back(MemPoolEntry{chunkSize, 1U});
+}
+
+uint64_t ChunkReclamationReport::numberOfChunks() const noexcept
+{
+    uint64_t numberOfChunks{0U};
+    for (const auto& memPool : m_memPools)
+    {
+        numberOfChunks += memPool.numberOfChunks;
+    }
+    return numberOfChunks;
+}
+
+const ChunkReclamationReport::MemPoolEntries_t& ChunkReclamationReport::memPools() const noexcept
+{
+    return m_memPools;
+}
+
+void ChunkReclamationReport::clear() noexcept
+{
+    m_memPools.clear();
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -0,0 +1,48 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/concurrent_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+ConcurrentHistogram::ConcurrentHistogram() noexcept
+{
+    for (auto& count : m_counts)
+    {
+        count.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void ConcurrentHistogram::record(const uint64_t value) noexcept
+{
+    // the counts are independent of each other, therefore no ordering guarantees are required
+    m_counts[Histogram::bucketIndex(value)].fetch_add(1U, std::memory_order_relaxed);
+}
+
+Histogram ConcurrentHistogram::snapshot() const noexcept
+{
+    Histogram histogram;
+    for (uint32_t i = 0U; i < Histogram::BUCKET_COUNT; ++i)
+    {
+        histogram.m_counts[i] = m_counts[i].load(std::memory_order_relaxed);
+    }
+    return histogram;
+}
+
+} // namespace popo
+} // namespace iox
@@ -17,6 +17,9 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -56,36 +59,112 @@ bool ConditionListener::wasNotified() const noexcept
     return getMembers()->m_wasNotified.load(std::memory_order_relaxed);
 }
 
-ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
+void ConditionListener::setSpinDuration(const units::Duration spinDuration) noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
+    m_spinDurationInNanoseconds.store(spinDuration.toNanoseconds(), std::memory_order_relaxed);
+}
+
+units::Duration ConditionListener::getSpinDuration() const noexcept
+{
+    return units::Duration::fromNanoseconds(m_spinDurationInNanoseconds.load(std::memory_order_relaxed));
+}
+
+expected<int32_t, NotificationSocketError> ConditionListener::getFileDescriptor() noexcept
+{
+    if (!m_notificationSocket)
+    {
+        auto notificationSocket = NotificationSocket::create(*getMembers());
+        if (notificationSocket.has_error())
         {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
-            return false;
+            return error<NotificationSocketError>(notificationSocket.get_error());
         }
-        return true;
-    });
+        m_notificationSocket.emplace(std::move(notificationSocket.value()));
+    }
+    return success<int32_t>(m_notificationSocket->getFileDescriptor());
+}
+
+void ConditionListener::updateFileDescriptor(const bool hasPendingNotifications) noexcept
+{
+    if (!m_notificationSocket)
+    {
+        return;
+    }
+
+    if (hasPendingNotifications)
+    {
+        m_notificationSocket->rearm();
+        return;
+    }
+
+    m_notificationSocket->disarm();
+    // disarming may have drained the datagram of a notification which was not yet collected; since m_wasNotified
+    // is set before the datagram is sent, such a notification is either seen here or its datagram arrives later
+    if (wasNotified())
+    {
+        m_notificationSocket->rearm();
+    }
+}
+
+ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
+{
+    return waitImpl(
+        [this]() -> bool {
+            if (this->getMembers()->m_semaphore->wait().has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        getSpinDuration());
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    // the spinning is part of the time to wait
+    const auto spinDuration = std::min(getSpinDuration(), timeToWait);
+    const auto remainingTimeToWait = timeToWait - spinDuration;
+    return waitImpl(
+        [this, remainingTimeToWait]() -> bool {
+            if (this->getMembers()->m_semaphore->timedWait(remainingTimeToWait).has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            }
+            return false;
+        },
+        spinDuration);
+}
+
+bool ConditionListener::spinUntilNotified(const units::Duration spinDuration) const noexcept
+{
+    deadline_timer spinTimer(spinDuration);
+    while (!m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        if (getMembers()->m_wasNotified.load(std::memory_order_relaxed))
         {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            return true;
         }
-        return false;
-    });
+        if (spinTimer.hasExpired())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall,
+                                                                    const units::Duration spinDuration) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
+    if (m_notificationSocket)
+    {
+        m_notificationSocket->drain();
+    }
     bool doReturnAfterNotificationCollection = false;
+    bool isSpinningRequired = spinDuration > units::Duration::zero();
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
@@ -101,6 +180,17 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
             return activeNotifications;
         }
 
+        // spinning happens only once per call; when m_wasNotified was set by an already collected notification
+        // the semaphore takes over
+        if (isSpinningRequired)
+        {
+            isSpinningRequired = false;
+            if (spinUntilNotified(spinDuration))
+            {
+                continue;
+            }
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
     }
 
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iox/logging.hpp"
 
 namespace iox
@@ -40,6 +41,7 @@ void ConditionNotifier::notify() noexcept
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
+    NotificationSocket::sendNotification(*getMembers());
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
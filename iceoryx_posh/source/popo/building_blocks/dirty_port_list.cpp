@@ -0,0 +1,68 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DirtyPortList::CAPACITY;
+constexpr uint64_t DirtyPortList::BITS_PER_WORD;
+constexpr uint64_t DirtyPortList::NUMBER_OF_WORDS;
+
+DirtyPortList::DirtyPortList() noexcept
+{
+    for (auto& word : m_words)
+    {
+        word.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void DirtyPortList::mark(const uint64_t index) noexcept
+{
+    if (index >= CAPACITY)
+    {
+        return;
+    }
+
+    // release, to make the port state changes which caused the mark visible to the collecting side
+    m_words[index / BITS_PER_WORD].fetch_or(1ULL << (index % BITS_PER_WORD), std::memory_order_release);
+}
+
+void DirtyPortList::collect(const function_ref<void(const uint64_t)> callback) noexcept
+{
+    for (uint64_t wordIndex = 0U; wordIndex < NUMBER_OF_WORDS; ++wordIndex)
+    {
+        if (m_words[wordIndex].load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        // a port which is marked after the exchange is collected with the next call
+        uint64_t bits = m_words[wordIndex].exchange(0U, std::memory_order_acquire);
+        for (uint64_t bit = 0U; bits != 0U; ++bit, bits >>= 1U)
+        {
+            if ((bits & 1U) != 0U)
+            {
+                callback(wordIndex * BITS_PER_WORD + bit);
+            }
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,300 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/socket.hpp"
+#include "iceoryx_platform/un.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/attributes.hpp"
+#include "iox/logging.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+#if defined(__linux__)
+#define IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED
+#endif
+
+namespace iox
+{
+namespace popo
+{
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+namespace
+{
+struct SocketAddress
+{
+    sockaddr_un address{};
+    socklen_t length{0U};
+};
+
+/// @brief the abstract name consists of a leading null byte followed by a prefix and the socket id in hex
+SocketAddress createSocketAddress(const uint64_t socketId) noexcept
+{
+    constexpr const char PREFIX[]{"iox_notification_"};
+    constexpr const char HEX_DIGITS[]{"0123456789abcdef"};
+    constexpr uint64_t BITS_PER_HEX_DIGIT{4U};
+    constexpr uint64_t NUMBER_OF_HEX_DIGITS{sizeof(uint64_t) * 8U / BITS_PER_HEX_DIGIT};
+
+    SocketAddress socketAddress;
+    socketAddress.address.sun_family = AF_UNIX;
+
+    uint64_t position{1U};
+    for (uint64_t i = 0U; i + 1U < sizeof(PREFIX); ++i)
+    {
+        socketAddress.address.sun_path[position++] = PREFIX[i];
+    }
+    for (uint64_t i = NUMBER_OF_HEX_DIGITS; i > 0U; --i)
+    {
+        socketAddress.address.sun_path[position++] = HEX_DIGITS[(socketId >> ((i - 1U) * BITS_PER_HEX_DIGIT)) & 0xFU];
+    }
+
+    socketAddress.length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + position);
+    return socketAddress;
+}
+
+uint64_t createSocketId() noexcept
+{
+    // the pid makes the id unique across processes, the counter within the process
+    static std::atomic<uint32_t> socketCounter{0U};
+    const auto pid = static_cast<uint32_t>(getpid());
+    const uint32_t counter = socketCounter.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    constexpr uint64_t PID_SHIFT{32U};
+    return (static_cast<uint64_t>(pid) << PID_SHIFT) | counter;
+}
+
+void closeSocket(const int32_t fd) noexcept
+{
+    posix::posixCall(iox_closesocket)(fd).failureReturnValue(-1).evaluate().or_else([](auto& r) {
+        IOX_LOG(ERROR) << "Unable to close the notification socket: " << r.getHumanReadableErrnum();
+    });
+}
+} // namespace
+#endif
+
+constexpr int32_t NotificationSocket::INVALID_FD;
+
+expected<NotificationSocket, NotificationSocketError>
+NotificationSocket::create(ConditionVariableData& condVarData) noexcept
+{
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+    auto socketCall = posix::posixCall(iox_socket)(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)
+                          .failureReturnValue(-1)
+                          .evaluate();
+    if (socketCall.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to create the notification socket: "
+                       << socketCall.get_error().getHumanReadableErrnum();
+        return error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_CREATE_SOCKET);
+    }
+    const int32_t fd = socketCall->value;
+
+    const auto socketId = createSocketId();
+    const auto socketAddress = createSocketAddress(socketId);
+    auto bindCall =
+        // NOLINTJUSTIFICATION enforced by POSIX API
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        posix::posixCall(iox_bind)(fd, reinterpret_cast<const sockaddr*>(&socketAddress.address), socketAddress.length)
+            .failureReturnValue(-1)
+            .evaluate();
+    if (bindCall.has_error())
+    {
+        IOX_LOG(ERROR) << "Unable to bind the notification socket: " << bindCall.get_error().getHumanReadableErrnum();
+        closeSocket(fd);
+        return error<NotificationSocketError>(NotificationSocketError::UNABLE_TO_CREATE_SOCKET);
+    }
+
+    condVarData.m_notificationSocketId.store(socketId, std::memory_order_relaxed);
+    return success<NotificationSocket>(NotificationSocket(condVarData, socketId, fd));
+#else
+    IOX_DISCARD_RESULT(condVarData);
+    return error<NotificationSocketError>(NotificationSocketError::NOT_SUPPORTED);
+#endif
+}
+
+NotificationSocket::NotificationSocket(ConditionVariableData& condVarData,
+                                       const uint64_t socketId,
+                                       const int32_t fd) noexcept
+    : m_condVarDataPtr(&condVarData)
+    , m_socketId(socketId)
+    , m_fd(fd)
+{
+}
+
+NotificationSocket::NotificationSocket(NotificationSocket&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+NotificationSocket& NotificationSocket::operator=(NotificationSocket&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+
+        m_condVarDataPtr = rhs.m_condVarDataPtr;
+        m_socketId = rhs.m_socketId;
+        m_fd = rhs.m_fd;
+        m_isRearmed = rhs.m_isRearmed;
+
+        rhs.m_condVarDataPtr = nullptr;
+        rhs.m_socketId = ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID;
+        rhs.m_fd = INVALID_FD;
+    }
+    return *this;
+}
+
+NotificationSocket::~NotificationSocket() noexcept
+{
+    destroy();
+}
+
+void NotificationSocket::destroy() noexcept
+{
+    if (m_fd == INVALID_FD)
+    {
+        return;
+    }
+
+    // a newer socket could already be registered, it must stay registered
+    auto registeredSocketId = m_socketId;
+    m_condVarDataPtr->m_notificationSocketId.compare_exchange_strong(
+        registeredSocketId, ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID, std::memory_order_relaxed);
+
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+    closeSocket(m_fd);
+#endif
+    m_condVarDataPtr = nullptr;
+    m_socketId = ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID;
+    m_fd = INVALID_FD;
+}
+
+int32_t NotificationSocket::getFileDescriptor() const noexcept
+{
+    return m_fd;
+}
+
+void NotificationSocket::drain() noexcept
+{
+    m_isRearmed = false;
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+    uint8_t datagram{0U};
+    while (true)
+    {
+        auto receiveCall = posix::posixCall(iox_recvfrom)(m_fd, &datagram, sizeof(datagram), 0, nullptr, nullptr)
+                               .failureReturnValue(-1)
+                               .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK)
+                               .evaluate();
+        if (receiveCall.has_error())
+        {
+            return;
+        }
+    }
+#endif
+}
+
+void NotificationSocket::rearm() noexcept
+{
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+    // one datagram keeps the file descriptor readable, further ones would only fill the socket
+    if (m_isRearmed)
+    {
+        return;
+    }
+
+    const auto socketAddress = createSocketAddress(m_socketId);
+    const uint8_t datagram{0U};
+    auto sendCall =
+        // NOLINTJUSTIFICATION enforced by POSIX API
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        posix::posixCall(iox_sendto)(m_fd,
+                                     &datagram,
+                                     sizeof(datagram),
+                                     MSG_DONTWAIT,
+                                     reinterpret_cast<const sockaddr*>(&socketAddress.address),
+                                     socketAddress.length)
+            .failureReturnValue(-1)
+            .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK)
+            .evaluate();
+    // a full socket is readable as well
+    m_isRearmed = !sendCall.has_error() || sendCall.get_error().errnum == EAGAIN
+                  || sendCall.get_error().errnum == EWOULDBLOCK;
+#endif
+}
+
+void NotificationSocket::disarm() noexcept
+{
+    if (m_isRearmed)
+    {
+        drain();
+    }
+}
+
+void NotificationSocket::sendNotification(const ConditionVariableData& condVarData) noexcept
+{
+    const auto socketId = condVarData.m_notificationSocketId.load(std::memory_order_relaxed);
+    if (socketId == ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID)
+    {
+        return;
+    }
+
+#if defined(IOX_POPO_NOTIFICATION_SOCKET_SUPPORTED)
+    // one unbound socket per process is sufficient to send to all notification sockets; it is closed when the
+    // process terminates
+    static const int32_t sendSocket = [] {
+        auto socketCall =
+            posix::posixCall(iox_socket)(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0).failureReturnValue(-1).evaluate();
+        return socketCall.has_error() ? INVALID_FD : socketCall->value;
+    }();
+    if (sendSocket == INVALID_FD)
+    {
+        return;
+    }
+
+    const auto socketAddress = createSocketAddress(socketId);
+    const uint8_t datagram{0U};
+    auto sendCall =
+        // NOLINTJUSTIFICATION enforced by POSIX API
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        posix::posixCall(iox_sendto)(sendSocket,
+                                     &datagram,
+                                     sizeof(datagram),
+                                     MSG_DONTWAIT,
+                                     reinterpret_cast<const sockaddr*>(&socketAddress.address),
+                                     socketAddress.length)
+            .failureReturnValue(-1)
+            .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK, ECONNREFUSED, ENOENT)
+            .evaluate();
+
+    // a full socket is already readable; an unreachable socket was either destroyed meanwhile or is in another
+    // network namespace, the latter would be reported with every notification and is therefore only logged once
+    if (sendCall.has_error()
+        && (sendCall.get_error().errnum == ECONNREFUSED || sendCall.get_error().errnum == ENOENT))
+    {
+        static std::atomic_bool isUnreachableSocketReported{false};
+        if (!isUnreachableSocketReported.exchange(true, std::memory_order_relaxed))
+        {
+            IOX_LOG(WARN) << "Unable to reach the notification socket of a listener, its file descriptor does not "
+                             "become readable. The listener was either destroyed or is in another network namespace. "
+                             "This is reported only once.";
+        }
+    }
+#endif
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,127 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/histogram.hpp"
+
+#include <cmath>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t Histogram::SUB_BUCKET_BITS;
+constexpr uint32_t Histogram::SUB_BUCKET_COUNT;
+constexpr uint32_t Histogram::MAGNITUDE_BITS;
+constexpr uint64_t Histogram::MAX_TRACKABLE_VALUE;
+constexpr uint32_t Histogram::BUCKET_COUNT;
+
+void Histogram::record(const uint64_t value) noexcept
+{
+    ++m_counts[bucketIndex(value)];
+}
+
+uint64_t Histogram::count(const uint32_t bucketIndex) const noexcept
+{
+    return (bucketIndex < BUCKET_COUNT) ? m_counts[bucketIndex] : 0U;
+}
+
+uint64_t Histogram::totalCount() const noexcept
+{
+    uint64_t total{0U};
+    for (const auto count : m_counts)
+    {
+        total += count;
+    }
+    return total;
+}
+
+uint64_t Histogram::valueAtPercentile(const double percentile) const noexcept
+{
+    const uint64_t total{totalCount()};
+    if (total == 0U)
+    {
+        return 0U;
+    }
+
+    const double clampedPercentile = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+    auto rank = static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(total)));
+    rank = (rank == 0U) ? 1U : ((rank > total) ? total : rank);
+
+    uint64_t accumulatedCount{0U};
+    for (uint32_t i = 0U; i < BUCKET_COUNT; ++i)
+    {
+        accumulatedCount += m_counts[i];
+        if (accumulatedCount >= rank)
+        {
+            return bucketUpperBound(i);
+        }
+    }
+
+    return MAX_TRACKABLE_VALUE;
+}
+
+uint32_t Histogram::bucketIndex(const uint64_t value) noexcept
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return static_cast<uint32_t>(value);
+    }
+    if (value > MAX_TRACKABLE_VALUE)
+    {
+        return BUCKET_COUNT - 1U;
+    }
+
+    // position of the most significant bit, determined by a binary search to stay independent of compiler intrinsics
+    uint32_t mostSignificantBit{0U};
+    uint64_t remainder{value};
+    for (uint32_t shift = 32U; shift > 0U; shift >>= 1U)
+    {
+        if ((remainder >> shift) != 0U)
+        {
+            remainder >>= shift;
+            mostSignificantBit += shift;
+        }
+    }
+
+    // the SUB_BUCKET_BITS below the most significant bit select the sub-bucket within the power of two range
+    const uint32_t magnitude{mostSignificantBit - SUB_BUCKET_BITS + 1U};
+    const auto subBucket = static_cast<uint32_t>(value >> (mostSignificantBit - SUB_BUCKET_BITS)) - SUB_BUCKET_COUNT;
+    return magnitude * SUB_BUCKET_COUNT + subBucket;
+}
+
+uint64_t Histogram::bucketLowerBound(const uint32_t bucketIndex) noexcept
+{
+    if (bucketIndex < SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+
+    const uint32_t magnitude{bucketIndex / SUB_BUCKET_COUNT};
+    const uint32_t subBucket{bucketIndex % SUB_BUCKET_COUNT};
+    return static_cast<uint64_t>(SUB_BUCKET_COUNT + subBucket) << (magnitude - 1U);
+}
+
+uint64_t Histogram::bucketUpperBound(const uint32_t bucketIndex) noexcept
+{
+    if (bucketIndex + 1U >= BUCKET_COUNT)
+    {
+        return MAX_TRACKABLE_VALUE;
+    }
+    return bucketLowerBound(bucketIndex + 1U) - 1U;
+}
+
+} // namespace popo
+} // namespace iox
@@ -24,8 +24,13 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
-    : Parent(conditionVariableData)
+Listener::Listener(const uint64_t numberOfWorkerThreads) noexcept
+    : Parent(numberOfWorkerThreads)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkerThreads) noexcept
+    : Parent(conditionVariableData, numberOfWorkerThreads)
 {
 }
 
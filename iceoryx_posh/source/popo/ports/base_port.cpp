@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -69,6 +70,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +78,20 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    auto dirtyPortList = getMembers()->m_dirtyPortListPtr.get();
+    if (dirtyPortList != nullptr)
+    {
+        dirtyPortList->mark(getMembers()->m_dirtyPortListIndex);
+    }
+
+    auto discoveryConditionVariableData = getMembers()->m_discoveryConditionVariableDataPtr.get();
+    if (discoveryConditionVariableData != nullptr)
+    {
+        ConditionNotifier(*discoveryConditionVariableData, roudi::DISCOVERY_NOTIFICATION_INDEX).notify();
+    }
+}
+
 } // namespace popo
 } // namespace iox
@@ -245,10 +245,10 @@ ClientPortRouDi::handleCaProMessageForStateDisconnectRequested(const capro::Capr
     return nullopt;
 }
 
-void ClientPortRouDi::releaseAllChunks() noexcept
+void ClientPortRouDi::releaseAllChunks(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    m_chunkSender.releaseAll();
-    m_chunkReceiver.releaseAll();
+    m_chunkSender.releaseAll(report);
+    m_chunkReceiver.releaseAll(report);
 }
 
 } // namespace popo
@@ -32,6 +32,7 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    m_chunkSenderData.m_publishTimestampEnabled = publisherOptions.publishTimestamp;
 }
 
 } // namespace popo
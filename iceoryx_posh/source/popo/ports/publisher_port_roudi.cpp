@@ -116,9 +116,9 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
     return make_optional<capro::CaproMessage>(responseMessage);
 }
 
-void PublisherPortRouDi::releaseAllChunks() noexcept
+void PublisherPortRouDi::releaseAllChunks(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    m_chunkSender.releaseAll();
+    m_chunkSender.releaseAll(report);
 }
 
 } // namespace popo
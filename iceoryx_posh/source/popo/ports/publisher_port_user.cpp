@@ -76,11 +76,22 @@ optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() con
     return m_chunkSender.tryGetPreviousChunk();
 }
 
+Histogram PublisherPortUser::getSendIntervalHistogram() const noexcept
+{
+    return m_chunkSender.getSendIntervalHistogram();
+}
+
+void PublisherPortUser::setSendIntervalHistogramEnabled(const bool enable) noexcept
+{
+    m_chunkSender.setSendIntervalHistogramEnabled(enable);
+}
+
 void PublisherPortUser::offer() noexcept
 {
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -89,6 +100,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -163,10 +163,10 @@ ServerPortRouDi::handleCaProMessageForStateNotOffered(const capro::CaproMessage&
     return nullopt;
 }
 
-void ServerPortRouDi::releaseAllChunks() noexcept
+void ServerPortRouDi::releaseAllChunks(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    m_chunkSender.releaseAll();
-    m_chunkReceiver.releaseAll();
+    m_chunkSender.releaseAll(report);
+    m_chunkReceiver.releaseAll(report);
 }
 
 } // namespace popo
@@ -33,6 +33,10 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_userHeaderFilter = subscriberOptions.userHeaderFilter;
+    m_chunkReceiverData.m_decimationFactor = subscriberOptions.decimationFactor;
+    m_chunkReceiverData.m_minimumDeliveryIntervalInNanoseconds =
+        subscriberOptions.minimumDeliveryInterval.toNanoseconds();
 }
 
 } // namespace popo
@@ -42,9 +42,9 @@ SubscriberPortRouDi::MemberType_t* SubscriberPortRouDi::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
-void SubscriberPortRouDi::releaseAllChunks() noexcept
+void SubscriberPortRouDi::releaseAllChunks(mepoo::ChunkReclamationReport* const report) noexcept
 {
-    m_chunkReceiver.releaseAll();
+    m_chunkReceiver.releaseAll(report);
 }
 
 } // namespace popo
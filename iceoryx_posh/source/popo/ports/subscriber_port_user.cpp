@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -88,6 +90,21 @@ bool SubscriberPortUser::hasLostChunksSinceLastCall() noexcept
     return m_chunkReceiver.hasLostChunks();
 }
 
+uint64_t SubscriberPortUser::getLostChunksCount() const noexcept
+{
+    return m_chunkReceiver.getLostChunksCount();
+}
+
+uint64_t SubscriberPortUser::getMaximumQueueFillLevel() const noexcept
+{
+    return m_chunkReceiver.getMaximumFillLevel();
+}
+
+uint64_t SubscriberPortUser::getReceivedChunksCount() const noexcept
+{
+    return m_chunkReceiver.getReceivedChunksCount();
+}
+
 void SubscriberPortUser::setConditionVariable(ConditionVariableData& conditionVariableData,
                                               const uint64_t notificationIndex) noexcept
 {
@@ -104,5 +121,20 @@ bool SubscriberPortUser::isConditionVariableSet() noexcept
     return m_chunkReceiver.isConditionVariableSet();
 }
 
+Histogram SubscriberPortUser::getLatencyHistogram() const noexcept
+{
+    return m_chunkReceiver.getLatencyHistogram();
+}
+
+Histogram SubscriberPortUser::getQueueDepthHistogram() const noexcept
+{
+    return m_chunkReceiver.getQueueDepthHistogram();
+}
+
+void SubscriberPortUser::setQueueDepthHistogramEnabled(const bool enable) noexcept
+{
+    m_chunkReceiver.setQueueDepthHistogramEnabled(enable);
+}
+
 } // namespace popo
 } // namespace iox
@@ -27,7 +27,8 @@ cxx::Serialization PublisherOptions::serialize() const noexcept
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        publishTimestamp);
 }
 
 expected<PublisherOptions, cxx::Serialization::Error>
@@ -41,7 +42,8 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.publishTimestamp);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -28,7 +28,10 @@ cxx::Serialization SubscriberOptions::serialize() const noexcept
                                       nodeName,
                                       subscribeOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+                                      requiresPublisherHistorySupport,
+                                      userHeaderFilter.serialize(),
+                                      decimationFactor,
+                                      minimumDeliveryInterval.toNanoseconds());
 }
 
 expected<SubscriberOptions, cxx::Serialization::Error>
@@ -38,13 +41,18 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
 
     SubscriberOptions subscriberOptions;
     QueueFullPolicyUT queueFullPolicy;
+    cxx::Serialization userHeaderFilter{""};
+    uint64_t minimumDeliveryIntervalInNanoseconds{0U};
 
     auto deserializationSuccessful = serialized.extract(subscriberOptions.queueCapacity,
                                                         subscriberOptions.historyRequest,
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        userHeaderFilter,
+                                                        subscriberOptions.decimationFactor,
+                                                        minimumDeliveryIntervalInNanoseconds);
 
     if (!deserializationSuccessful
         || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
@@ -53,6 +61,15 @@ SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
     }
 
     subscriberOptions.queueFullPolicy = static_cast<QueueFullPolicy>(queueFullPolicy);
+    subscriberOptions.minimumDeliveryInterval = units::Duration::fromNanoseconds(minimumDeliveryIntervalInNanoseconds);
+
+    auto deserializedFilter = UserHeaderFilter::deserialize(userHeaderFilter);
+    if (deserializedFilter.has_error())
+    {
+        return error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+    }
+    subscriberOptions.userHeaderFilter = deserializedFilter.value();
+
     return success<SubscriberOptions>(subscriberOptions);
 }
 } // namespace popo
@@ -0,0 +1,94 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+Timer::Timer(TimerScheduler& timerScheduler, const units::Duration interval, const TimerMode mode) noexcept
+    : m_timerScheduler(&timerScheduler)
+    , m_interval(interval)
+    , m_mode(mode)
+{
+}
+
+Timer::~Timer() noexcept
+{
+    stop();
+}
+
+expected<TimerError> Timer::start() noexcept
+{
+    if (m_mode == TimerMode::PERIODIC && m_interval == units::Duration::zero())
+    {
+        return error<TimerError>(TimerError::ZERO_PERIOD);
+    }
+
+    return m_timerScheduler->schedule(*this);
+}
+
+void Timer::stop() noexcept
+{
+    m_timerScheduler->unschedule(*this);
+}
+
+bool Timer::isRunning() const noexcept
+{
+    return m_timerScheduler->isScheduled(*this);
+}
+
+units::Duration Timer::getInterval() const noexcept
+{
+    return m_interval;
+}
+
+TimerMode Timer::getMode() const noexcept
+{
+    return m_mode;
+}
+
+bool Timer::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+void Timer::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        m_trigger.invalidate();
+    }
+}
+
+void Timer::enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept
+{
+    m_trigger = std::move(triggerHandle);
+}
+
+void Timer::disableEvent() noexcept
+{
+    m_trigger.reset();
+}
+
+void Timer::trigger() noexcept
+{
+    m_trigger.trigger();
+}
+
+} // namespace popo
+} // namespace iox
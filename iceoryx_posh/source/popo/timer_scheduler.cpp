@@ -0,0 +1,196 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/timer_scheduler.hpp"
+#include "iceoryx_posh/popo/timer.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+// a Duration exceeds the range of the clock by far, e.g. Duration::max(); longer durations are clamped to the
+// maximum which is treated as a deadline that is never reached
+TimerScheduler::Clock_t::duration toClockDuration(const units::Duration duration) noexcept
+{
+    constexpr uint64_t MAX_NANOSECONDS{static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(TimerScheduler::Clock_t::duration::max()).count())};
+    const auto nanoseconds = duration.toNanoseconds();
+    if (nanoseconds >= MAX_NANOSECONDS)
+    {
+        return TimerScheduler::Clock_t::duration::max();
+    }
+    return std::chrono::duration_cast<TimerScheduler::Clock_t::duration>(
+        std::chrono::nanoseconds(static_cast<int64_t>(nanoseconds)));
+}
+
+TimerScheduler::Clock_t::time_point addSaturated(const TimerScheduler::Clock_t::time_point timePoint,
+                                                 const TimerScheduler::Clock_t::duration duration) noexcept
+{
+    // the durations are never negative
+    if (duration > TimerScheduler::Clock_t::time_point::max() - timePoint)
+    {
+        return TimerScheduler::Clock_t::time_point::max();
+    }
+    return timePoint + duration;
+}
+} // namespace
+
+TimerScheduler::TimerScheduler() noexcept
+{
+    m_thread = std::thread(&TimerScheduler::threadLoop, this);
+}
+
+TimerScheduler::~TimerScheduler() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_wasDtorCalled = true;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+}
+
+uint64_t TimerScheduler::size() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_scheduledTimers.size();
+}
+
+expected<TimerError> TimerScheduler::schedule(Timer& timer) noexcept
+{
+    const auto deadline = addSaturated(Clock_t::now(), toClockDuration(timer.getInterval()));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bool isAlreadyScheduled{false};
+        for (auto& scheduledTimer : m_scheduledTimers)
+        {
+            if (scheduledTimer.timer == &timer)
+            {
+                scheduledTimer.deadline = deadline;
+                isAlreadyScheduled = true;
+                break;
+            }
+        }
+
+        if (!isAlreadyScheduled && !m_scheduledTimers.push_back({&timer, deadline}))
+        {
+            return error<TimerError>(TimerError::TIMER_SCHEDULER_FULL);
+        }
+    }
+
+    // the new deadline could be earlier than the one the thread is waiting for
+    m_wakeup.notify_one();
+    return success<>();
+}
+
+void TimerScheduler::unschedule(const Timer& timer) noexcept
+{
+    // the thread triggers the timers while holding the mutex, therefore the timer is never accessed after this call
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (uint64_t i = 0U; i < m_scheduledTimers.size(); ++i)
+    {
+        if (m_scheduledTimers[i].timer == &timer)
+        {
+            m_scheduledTimers.erase(m_scheduledTimers.begin() + i);
+            return;
+        }
+    }
+}
+
+bool TimerScheduler::isScheduled(const Timer& timer) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& scheduledTimer : m_scheduledTimers)
+    {
+        if (scheduledTimer.timer == &timer)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TimerScheduler::threadLoop() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_wasDtorCalled)
+    {
+        if (m_scheduledTimers.empty())
+        {
+            m_wakeup.wait(lock, [this] { return m_wasDtorCalled || !m_scheduledTimers.empty(); });
+            continue;
+        }
+
+        auto nextDeadline = m_scheduledTimers[0U].deadline;
+        for (const auto& scheduledTimer : m_scheduledTimers)
+        {
+            nextDeadline = std::min(nextDeadline, scheduledTimer.deadline);
+        }
+
+        const auto now = Clock_t::now();
+        if (nextDeadline == Clock_t::time_point::max())
+        {
+            // the deadline is never reached and would overflow the conversion of some wait_until implementations
+            m_wakeup.wait(lock);
+            continue;
+        }
+        if (nextDeadline > now)
+        {
+            // a newly scheduled or stopped timer wakes up the thread so that the deadlines are evaluated again
+            m_wakeup.wait_until(lock, nextDeadline);
+            continue;
+        }
+
+        triggerExpiredTimers(now);
+    }
+}
+
+void TimerScheduler::triggerExpiredTimers(const Clock_t::time_point now) noexcept
+{
+    for (uint64_t i = 0U; i < m_scheduledTimers.size();)
+    {
+        auto& scheduledTimer = m_scheduledTimers[i];
+        if (scheduledTimer.deadline > now)
+        {
+            ++i;
+            continue;
+        }
+
+        scheduledTimer.timer->trigger();
+
+        if (scheduledTimer.timer->getMode() == TimerMode::ONE_SHOT)
+        {
+            m_scheduledTimers.erase(m_scheduledTimers.begin() + i);
+            continue;
+        }
+
+        const auto period = toClockDuration(scheduledTimer.timer->getInterval());
+        scheduledTimer.deadline = addSaturated(scheduledTimer.deadline, period);
+        if (scheduledTimer.deadline <= now)
+        {
+            // missed periods are skipped instead of triggering the timer in a burst
+            scheduledTimer.deadline = addSaturated(now, period);
+        }
+        ++i;
+    }
+}
+
+} // namespace popo
+} // namespace iox
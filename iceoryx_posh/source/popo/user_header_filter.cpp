@@ -0,0 +1,207 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t UserHeaderFilter::MAX_CONDITIONS;
+
+expected<UserHeaderFilterError> UserHeaderFilter::addCondition(const uint32_t offset,
+                                                               const uint32_t size,
+                                                               const UserHeaderFieldComparison comparison,
+                                                               const uint64_t value) noexcept
+{
+    if (!isValidFieldSize(size))
+    {
+        return error<UserHeaderFilterError>(UserHeaderFilterError::INVALID_FIELD_SIZE);
+    }
+
+    if (!m_conditions.push_back(UserHeaderFieldCondition{offset, size, comparison, value}))
+    {
+        return error<UserHeaderFilterError>(UserHeaderFilterError::TOO_MANY_CONDITIONS);
+    }
+
+    return success<>();
+}
+
+bool UserHeaderFilter::hasConditions() const noexcept
+{
+    return !m_conditions.empty();
+}
+
+bool UserHeaderFilter::matches(const mepoo::ChunkHeader& chunkHeader) const noexcept
+{
+    for (const auto& condition : m_conditions)
+    {
+        if (!evaluate(condition, chunkHeader))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UserHeaderFilter::isValidFieldSize(const uint32_t size) noexcept
+{
+    return size == sizeof(uint8_t) || size == sizeof(uint16_t) || size == sizeof(uint32_t) || size == sizeof(uint64_t);
+}
+
+bool UserHeaderFilter::evaluate(const UserHeaderFieldCondition& condition,
+                                const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    // the sum cannot overflow since both operands are 32 bit values
+    if (static_cast<uint64_t>(condition.offset) + condition.size > chunkHeader.userHeaderSize())
+    {
+        return false;
+    }
+
+    // the field is not necessarily aligned within the user-header, therefore it is copied
+    const auto* const field = static_cast<const uint8_t*>(chunkHeader.userHeader()) + condition.offset;
+    uint64_t fieldValue{0U};
+    switch (condition.size)
+    {
+    case sizeof(uint8_t):
+    {
+        uint8_t value{0U};
+        std::memcpy(&value, field, sizeof(value));
+        fieldValue = value;
+        break;
+    }
+    case sizeof(uint16_t):
+    {
+        uint16_t value{0U};
+        std::memcpy(&value, field, sizeof(value));
+        fieldValue = value;
+        break;
+    }
+    case sizeof(uint32_t):
+    {
+        uint32_t value{0U};
+        std::memcpy(&value, field, sizeof(value));
+        fieldValue = value;
+        break;
+    }
+    default:
+    {
+        std::memcpy(&fieldValue, field, sizeof(fieldValue));
+        break;
+    }
+    }
+
+    switch (condition.comparison)
+    {
+    case UserHeaderFieldComparison::EQUAL:
+        return fieldValue == condition.value;
+    case UserHeaderFieldComparison::NOT_EQUAL:
+        return fieldValue != condition.value;
+    case UserHeaderFieldComparison::LESS:
+        return fieldValue < condition.value;
+    case UserHeaderFieldComparison::LESS_OR_EQUAL:
+        return fieldValue <= condition.value;
+    case UserHeaderFieldComparison::GREATER:
+        return fieldValue > condition.value;
+    case UserHeaderFieldComparison::GREATER_OR_EQUAL:
+        return fieldValue >= condition.value;
+    }
+
+    return false;
+}
+
+cxx::Serialization UserHeaderFilter::serialize() const noexcept
+{
+    using ComparisonUT = std::underlying_type_t<UserHeaderFieldComparison>;
+
+    // the conditions are appended as flat list of 'offset, size, comparison, value' tuples after their number
+    std::string serialized = cxx::Serialization::create(m_conditions.size()).toString();
+    for (const auto& condition : m_conditions)
+    {
+        serialized.append(cxx::Serialization::create(condition.offset,
+                                                     condition.size,
+                                                     static_cast<ComparisonUT>(condition.comparison),
+                                                     condition.value)
+                              .toString());
+    }
+    return cxx::Serialization(serialized);
+}
+
+expected<UserHeaderFilter, cxx::Serialization::Error>
+UserHeaderFilter::deserialize(const cxx::Serialization& serialized) noexcept
+{
+    using ComparisonUT = std::underlying_type_t<UserHeaderFieldComparison>;
+    constexpr uint32_t ENTRIES_PER_CONDITION{4U};
+
+    UserHeaderFilter filter;
+    uint64_t numberOfConditions{0U};
+    if (!serialized.getNth(0U, numberOfConditions) || numberOfConditions > MAX_CONDITIONS)
+    {
+        return error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+    }
+
+    for (uint32_t i = 0U; i < numberOfConditions; ++i)
+    {
+        const uint32_t index{1U + i * ENTRIES_PER_CONDITION};
+        uint32_t offset{0U};
+        uint32_t size{0U};
+        ComparisonUT comparison{0U};
+        uint64_t value{0U};
+
+        if (!serialized.getNth(index, offset) || !serialized.getNth(index + 1U, size)
+            || !serialized.getNth(index + 2U, comparison) || !serialized.getNth(index + 3U, value)
+            || comparison > static_cast<ComparisonUT>(UserHeaderFieldComparison::GREATER_OR_EQUAL))
+        {
+            return error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+        }
+
+        if (filter.addCondition(offset, size, static_cast<UserHeaderFieldComparison>(comparison), value).has_error())
+        {
+            return error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+        }
+    }
+
+    return success<UserHeaderFilter>(filter);
+}
+
+bool operator==(const UserHeaderFilter& lhs, const UserHeaderFilter& rhs) noexcept
+{
+    if (lhs.m_conditions.size() != rhs.m_conditions.size())
+    {
+        return false;
+    }
+
+    for (uint64_t i = 0U; i < lhs.m_conditions.size(); ++i)
+    {
+        const auto& l = lhs.m_conditions[i];
+        const auto& r = rhs.m_conditions[i];
+        if (l.offset != r.offset || l.size != r.size || l.comparison != r.comparison || l.value != r.value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool operator!=(const UserHeaderFilter& lhs, const UserHeaderFilter& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+} // namespace popo
+} // namespace iox
@@ -37,6 +37,15 @@ IceOryxRouDiComponents::IceOryxRouDiComponents(const RouDiConfig_t& roudiConfig)
         return &rouDiMemoryManager;
     }())
 {
+    if (!roudiConfig.m_manifestPorts.empty())
+    {
+        auto segmentInfo = rouDiMemoryManager.segmentManager().value()->getSegmentInformationWithWriteAccessForUser(
+            posix::PosixUser::getUserOfCurrentProcess());
+        portManager.addManifestPorts(roudiConfig.m_manifestPorts,
+                                     segmentInfo.m_memoryManager.has_value()
+                                         ? &segmentInfo.m_memoryManager.value().get()
+                                         : nullptr);
+    }
 }
 
 } // namespace roudi
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -57,6 +58,28 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the port histograms are by far the largest introspection topic, therefore the chunk count is derived from the
+    // supported subscribers instead of using spare chunks; each subscriber holds a full queue and the sample it reads,
+    // the publisher holds its history sample and the one it is writing
+    if (roudi::MAX_PORT_HISTOGRAMS > 0U)
+    {
+        constexpr uint32_t HISTOGRAM_PUBLISHER_CHUNK_COUNT{2U};
+        constexpr uint32_t HISTOGRAM_CHUNK_COUNT{
+            MAX_PORT_HISTOGRAM_SUBSCRIBERS * (PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY + 1U)
+            + HISTOGRAM_PUBLISHER_CHUNK_COUNT};
+        mempoolConfig.m_mempoolConfig.push_back(
+            {align(static_cast<uint32_t>(sizeof(roudi::PortHistogramIntrospectionFieldTopic)), ALIGNMENT),
+             HISTOGRAM_CHUNK_COUNT});
+    }
+    // the service registry deltas are small but each change is a sample; every ServiceDiscovery can hold a full queue
+    // and the delta it currently applies since it only takes the deltas when it searches for services, the publisher
+    // holds its history and the delta it is writing
+    constexpr uint32_t SERVICE_REGISTRY_DELTA_CHUNK_COUNT{static_cast<uint32_t>(
+        ServiceRegistryDelta::MAX_SUBSCRIBERS * (ServiceRegistryDelta::SUBSCRIBER_QUEUE_CAPACITY + 1U)
+        + ServiceRegistryDelta::HISTORY_CAPACITY + 1U)};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryDelta)), ALIGNMENT),
+         SERVICE_REGISTRY_DELTA_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -18,12 +18,14 @@
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/logging.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -66,15 +68,26 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
     registryPortOptions.offerOnCreate = true;
 
-    // we cannot (fully) perform discovery without this port
+    popo::PublisherOptions registryDeltaPortOptions;
+    registryDeltaPortOptions.historyCapacity = ServiceRegistryDelta::HISTORY_CAPACITY;
+    registryDeltaPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryDeltaPortOptions.offerOnCreate = true;
+
+    // we cannot (fully) perform discovery without these ports
     m_serviceRegistryPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         registryPortOptions,
         introspectionMemoryManager);
+    m_serviceRegistryDeltaPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        registryDeltaPortOptions,
+        introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryDeltaPort(*m_serviceRegistryDeltaPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryDeltaPort);
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -89,10 +102,16 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     auto subscriberPortsData = acquireInternalPublisherPortData(
         IntrospectionSubscriberPortChangingDataService, options, introspectionMemoryManager);
 
+    auto portHistograms =
+        acquireInternalPublisherPortData(IntrospectionPortHistogramService, options, introspectionMemoryManager);
+
     m_portIntrospection.registerPublisherPort(PublisherPortUserType(std::move(portGeneric)),
                                               PublisherPortUserType(std::move(portThroughput)),
-                                              PublisherPortUserType(std::move(subscriberPortsData)));
+                                              PublisherPortUserType(std::move(subscriberPortsData)),
+                                              PublisherPortUserType(std::move(portHistograms)));
     m_portIntrospection.run();
+
+    publishServiceRegistry();
 }
 
 void PortManager::stopPortIntrospection() noexcept
@@ -100,6 +119,11 @@ void PortManager::stopPortIntrospection() noexcept
     m_portIntrospection.stop();
 }
 
+popo::ConditionVariableData& PortManager::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPool->getDiscoveryConditionVariableData();
+}
+
 void PortManager::doDiscovery() noexcept
 {
     handlePublisherPorts();
@@ -115,13 +139,30 @@ void PortManager::doDiscovery() noexcept
     handleNodes();
 
     handleConditionVariables();
+
+    // the deltas are published with every change, the snapshot for applications which lost deltas or start late only
+    // once per run or after a number of deltas
+    publishServiceRegistry();
+
+    reclaimDeletedPorts(MAX_PORTS_RECLAIMED_PER_DISCOVERY_RUN);
+}
+
+void PortManager::requestFullDiscovery() noexcept
+{
+    m_portPool->markAllPortsDirty();
 }
 
 void PortManager::handlePublisherPorts() noexcept
 {
-    // get the changes of publisher port offer state
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // get the changes of publisher port offer state; only the ports which requested a discovery run are processed
+    for (auto publisherPortData : m_portPool->getDirtyPublisherPortDataList())
     {
+        // the port is already disconnected and only waits for its chunks to be released
+        if (publisherPortData->m_toBeReclaimed)
+        {
+            continue;
+        }
+
         PublisherPortRouDiType publisherPort(publisherPortData);
 
         doDiscoveryForPublisherPort(publisherPort);
@@ -164,9 +205,16 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
 
 void PortManager::handleSubscriberPorts() noexcept
 {
-    // get requests for change of subscription state of subscribers
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    // get requests for change of subscription state of subscribers; only the ports which requested a discovery run
+    // are processed
+    for (auto subscriberPortData : m_portPool->getDirtySubscriberPortDataList())
     {
+        // the port is already disconnected and only waits for its chunks to be released
+        if (subscriberPortData->m_toBeReclaimed)
+        {
+            continue;
+        }
+
         SubscriberPortType subscriberPort(subscriberPortData);
 
         doDiscoveryForSubscriberPort(subscriberPort);
@@ -214,6 +262,12 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 {
     cxx::Ensures(clientPortData != nullptr && "clientPortData must not be a nullptr");
 
+    disconnectClientPort(clientPortData);
+    reclaimClientPort(clientPortData, nullptr);
+}
+
+void PortManager::disconnectClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
     // create temporary client ports to orderly shut this client down
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
@@ -228,9 +282,14 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
         this->sendToAllMatchingServerPorts(caproMessage, clientPortRoudi);
     });
 
-    clientPortRoudi.releaseAllChunks();
-
     /// @todo iox-#1128 remove from to port introspection
+}
+
+void PortManager::reclaimClientPort(popo::ClientPortData* const clientPortData,
+                                    mepoo::ChunkReclamationReport* const report) noexcept
+{
+    popo::ClientPortRouDi clientPortRoudi(*clientPortData);
+    clientPortRoudi.releaseAllChunks(report);
 
     IOX_LOG(DEBUG) << "Destroy client port from runtime '" << clientPortData->m_runtimeName
                    << "' and with service description '" << clientPortData->m_serviceDescription << "'";
@@ -241,9 +300,16 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 
 void PortManager::handleClientPorts() noexcept
 {
-    // get requests for change of connection state of clients
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    // get requests for change of connection state of clients; only the ports which requested a discovery run are
+    // processed
+    for (auto clientPortData : m_portPool->getDirtyClientPortDataList())
     {
+        // the port is already disconnected and only waits for its chunks to be released
+        if (clientPortData->m_toBeReclaimed)
+        {
+            continue;
+        }
+
         popo::ClientPortRouDi clientPort(*clientPortData);
 
         doDiscoveryForClientPort(clientPort);
@@ -300,6 +366,12 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
 {
     cxx::Ensures(serverPortData != nullptr && "serverPortData must not be a nullptr");
 
+    disconnectServerPort(serverPortData);
+    reclaimServerPort(serverPortData, nullptr);
+}
+
+void PortManager::disconnectServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
     // create temporary server ports to orderly shut this server down
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
@@ -317,9 +389,14 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
         this->sendToAllMatchingInterfacePorts(caproMessage);
     });
 
-    serverPortRoudi.releaseAllChunks();
-
     /// @todo iox-#1128 remove from port introspection
+}
+
+void PortManager::reclaimServerPort(popo::ServerPortData* const serverPortData,
+                                    mepoo::ChunkReclamationReport* const report) noexcept
+{
+    popo::ServerPortRouDi serverPortRoudi{*serverPortData};
+    serverPortRoudi.releaseAllChunks(report);
 
     IOX_LOG(DEBUG) << "Destroy server port from runtime '" << serverPortData->m_runtimeName
                    << "' and with service description '" << serverPortData->m_serviceDescription << "'";
@@ -330,9 +407,15 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
 
 void PortManager::handleServerPorts() noexcept
 {
-    // get the changes of server port offer state
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    // get the changes of server port offer state; only the ports which requested a discovery run are processed
+    for (auto serverPortData : m_portPool->getDirtyServerPortDataList())
     {
+        // the port is already disconnected and only waits for its chunks to be released
+        if (serverPortData->m_toBeReclaimed)
+        {
+            continue;
+        }
+
         popo::ServerPortRouDi serverPort(*serverPortData);
 
         doDiscoveryForServerPort(serverPort);
@@ -497,7 +580,9 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // only publishers with the same service description can be compatible
+    for (auto publisherPortData :
+         m_portPool->getPublisherPortDataListOfService(subscriberSource.getCaProServiceDescription()))
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -535,7 +620,9 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    // only subscribers with the same service description can be compatible
+    for (auto subscriberPortData :
+         m_portPool->getSubscriberPortDataListOfService(publisherSource.getCaProServiceDescription()))
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -601,7 +688,8 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    // only clients with the same service description can be compatible
+    for (auto clientPortData : m_portPool->getClientPortDataListOfService(serverSource.getCaProServiceDescription()))
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
@@ -638,7 +726,8 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    // only servers with the same service description can be compatible
+    for (auto serverPortData : m_portPool->getServerPortDataListOfService(clientSource.getCaProServiceDescription()))
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
@@ -723,40 +812,53 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryDeltaPublisherPortData.reset();
     }
+    // the chunks are released later by reclaimDeletedPorts since releasing all chunks of a runtime with many ports
+    // would stall the discovery; until then the ports are disconnected and removed from the service index
     for (auto port : m_portPool->getPublisherPortDataList())
     {
-        PublisherPortRouDiType sender(port);
-        if (runtimeName == sender.getRuntimeName())
+        if (runtimeName == port->m_runtimeName && !port->m_toBeReclaimed)
         {
-            destroyPublisherPort(port);
+            disconnectPublisherPort(port);
+            removeUnclaimedManifestPort(port->m_uniqueId);
+            m_portPool->removePublisherPortFromServiceIndex(port);
+            port->m_toBeReclaimed = true;
+            ++m_numberOfPortsToReclaim;
         }
     }
 
     for (auto port : m_portPool->getSubscriberPortDataList())
     {
-        SubscriberPortUserType subscriber(port);
-        if (runtimeName == subscriber.getRuntimeName())
+        if (runtimeName == port->m_runtimeName && !port->m_toBeReclaimed)
         {
-            destroySubscriberPort(port);
+            disconnectSubscriberPort(port);
+            removeUnclaimedManifestPort(port->m_uniqueId);
+            m_portPool->removeSubscriberPortFromServiceIndex(port);
+            port->m_toBeReclaimed = true;
+            ++m_numberOfPortsToReclaim;
         }
     }
 
     for (auto port : m_portPool->getServerPortDataList())
     {
-        popo::ServerPortRouDi server(*port);
-        if (runtimeName == server.getRuntimeName())
+        if (runtimeName == port->m_runtimeName && !port->m_toBeReclaimed)
         {
-            destroyServerPort(port);
+            disconnectServerPort(port);
+            m_portPool->removeServerPortFromServiceIndex(port);
+            port->m_toBeReclaimed = true;
+            ++m_numberOfPortsToReclaim;
         }
     }
 
     for (auto port : m_portPool->getClientPortDataList())
     {
-        popo::ClientPortRouDi client(*port);
-        if (runtimeName == client.getRuntimeName())
+        if (runtimeName == port->m_runtimeName && !port->m_toBeReclaimed)
         {
-            destroyClientPort(port);
+            disconnectClientPort(port);
+            m_portPool->removeClientPortFromServiceIndex(port);
+            port->m_toBeReclaimed = true;
+            ++m_numberOfPortsToReclaim;
         }
     }
 
@@ -787,9 +889,247 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
             IOX_LOG(DEBUG) << "Deleted condition variable of application" << runtimeName;
         }
     }
+
+    // RouDi is shutting down, therefore there is no discovery which could be stalled
+    if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
+    {
+        reclaimDeletedPorts(std::numeric_limits<uint64_t>::max());
+    }
+    else if (m_numberOfPortsToReclaim > 0U)
+    {
+        requestReclamationRun();
+    }
+}
+
+void PortManager::requestReclamationRun() noexcept
+{
+    // the discovery runs only when it is notified or on the fallback interval, without the notification a large
+    // backlog would block the chunks and the port pool for many fallback intervals
+    popo::ConditionNotifier(getDiscoveryConditionVariableData(), DISCOVERY_NOTIFICATION_INDEX).notify();
+}
+
+void PortManager::reclaimDeletedPorts(const uint64_t maxNumberOfPorts) noexcept
+{
+    if (m_numberOfPortsToReclaim == 0U)
+    {
+        return;
+    }
+
+    uint64_t numberOfReclaimedPorts{0U};
+    auto hasBudget = [&] { return numberOfReclaimedPorts < maxNumberOfPorts && m_numberOfPortsToReclaim > 0U; };
+    auto countReclaimedPort = [&] {
+        ++numberOfReclaimedPorts;
+        --m_numberOfPortsToReclaim;
+    };
+
+    for (auto port : m_portPool->getPublisherPortDataList())
+    {
+        if (!hasBudget())
+        {
+            break;
+        }
+        if (port->m_toBeReclaimed)
+        {
+            reclaimPublisherPort(port, &m_chunkReclamationReport);
+            countReclaimedPort();
+        }
+    }
+
+    for (auto port : m_portPool->getSubscriberPortDataList())
+    {
+        if (!hasBudget())
+        {
+            break;
+        }
+        if (port->m_toBeReclaimed)
+        {
+            reclaimSubscriberPort(port, &m_chunkReclamationReport);
+            countReclaimedPort();
+        }
+    }
+
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        if (!hasBudget())
+        {
+            break;
+        }
+        if (port->m_toBeReclaimed)
+        {
+            reclaimServerPort(port, &m_chunkReclamationReport);
+            countReclaimedPort();
+        }
+    }
+
+    for (auto port : m_portPool->getClientPortDataList())
+    {
+        if (!hasBudget())
+        {
+            break;
+        }
+        if (port->m_toBeReclaimed)
+        {
+            reclaimClientPort(port, &m_chunkReclamationReport);
+            countReclaimedPort();
+        }
+    }
+
+    if (m_numberOfPortsToReclaim > 0U)
+    {
+        requestReclamationRun();
+        return;
+    }
+
+    IOX_LOG(INFO) << "Reclaimed " << m_chunkReclamationReport.numberOfChunks()
+                  << " chunks from the ports of terminated runtimes";
+    for (const auto& memPool : m_chunkReclamationReport.memPools())
+    {
+        IOX_LOG(INFO) << "  mempool with chunk size " << memPool.chunkSize << ": " << memPool.numberOfChunks
+                      << " chunks";
+    }
+    m_chunkReclamationReport.clear();
+}
+
+uint64_t PortManager::numberOfPortsToReclaim() const noexcept
+{
+    return m_numberOfPortsToReclaim;
+}
+
+void PortManager::addManifestPorts(const config::RouDiConfig::ManifestPorts_t& manifestPorts,
+                                   mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
+{
+    for (const auto& entry : manifestPorts)
+    {
+        if (entry.m_portType == config::ManifestPortEntry::PortType::PUBLISHER)
+        {
+            if (payloadDataSegmentMemoryManager == nullptr)
+            {
+                IOX_LOG(WARN) << "No writable shared memory segment for the publisher of the manifest with service '"
+                              << entry.m_serviceDescription << "'! The runtime '" << entry.m_runtimeName
+                              << "' has to request it by itself.";
+                continue;
+            }
+
+            acquirePublisherPortData(entry.m_serviceDescription,
+                                     entry.m_publisherOptions,
+                                     entry.m_runtimeName,
+                                     payloadDataSegmentMemoryManager,
+                                     PortConfigInfo())
+                .and_then([&](auto publisherPortData) {
+                    m_unclaimedManifestPortIds.emplace_back(publisherPortData->m_uniqueId);
+                })
+                .or_else([&](auto&) {
+                    IOX_LOG(WARN) << "Could not create the publisher of the manifest with service '"
+                                  << entry.m_serviceDescription << "' for the runtime '" << entry.m_runtimeName << "'";
+                });
+        }
+        else
+        {
+            acquireSubscriberPortData(
+                entry.m_serviceDescription, entry.m_subscriberOptions, entry.m_runtimeName, PortConfigInfo())
+                .and_then([&](auto subscriberPortData) {
+                    m_unclaimedManifestPortIds.emplace_back(subscriberPortData->m_uniqueId);
+                })
+                .or_else([&](auto&) {
+                    IOX_LOG(WARN) << "Could not create the subscriber of the manifest with service '"
+                                  << entry.m_serviceDescription << "' for the runtime '" << entry.m_runtimeName << "'";
+                });
+        }
+    }
+
+    // connect the new ports already now and not only when the first runtime registers
+    doDiscovery();
+}
+
+PortManager::ClaimedManifestPorts
+PortManager::claimManifestPorts(const RuntimeName_t& runtimeName,
+                                const mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
+{
+    ClaimedManifestPorts claimedPorts;
+    if (m_unclaimedManifestPortIds.empty())
+    {
+        return claimedPorts;
+    }
+
+    auto isFull = [&] {
+        return claimedPorts.m_publishers.size() + claimedPorts.m_subscribers.size()
+               >= MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE;
+    };
+
+    for (auto port : m_portPool->getPublisherPortDataList())
+    {
+        if (port->m_runtimeName != runtimeName || !isUnclaimedManifestPort(port->m_uniqueId))
+        {
+            continue;
+        }
+        if (isFull())
+        {
+            claimedPorts.m_hasMore = true;
+            return claimedPorts;
+        }
+
+        removeUnclaimedManifestPort(port->m_uniqueId);
+        if (port->m_chunkSenderData.m_memoryMgr.get() != payloadDataSegmentMemoryManager)
+        {
+            IOX_LOG(WARN) << "The publisher of the manifest with service '" << port->m_serviceDescription
+                          << "' does not use the shared memory segment of the runtime '" << runtimeName
+                          << "' and is discarded.";
+            destroyPublisherPort(port);
+            continue;
+        }
+        claimedPorts.m_publishers.emplace_back(port);
+    }
+
+    for (auto port : m_portPool->getSubscriberPortDataList())
+    {
+        if (port->m_runtimeName != runtimeName || !isUnclaimedManifestPort(port->m_uniqueId))
+        {
+            continue;
+        }
+        if (isFull())
+        {
+            claimedPorts.m_hasMore = true;
+            return claimedPorts;
+        }
+
+        removeUnclaimedManifestPort(port->m_uniqueId);
+        claimedPorts.m_subscribers.emplace_back(port);
+    }
+
+    return claimedPorts;
+}
+
+bool PortManager::isUnclaimedManifestPort(const popo::UniquePortId& portId) const noexcept
+{
+    for (const auto& unclaimedPortId : m_unclaimedManifestPortIds)
+    {
+        if (unclaimedPortId == portId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PortManager::removeUnclaimedManifestPort(const popo::UniquePortId& portId) noexcept
+{
+    for (auto iter = m_unclaimedManifestPortIds.begin(); iter != m_unclaimedManifestPortIds.end(); ++iter)
+    {
+        if (*iter == portId)
+        {
+            m_unclaimedManifestPortIds.erase(iter);
+            return;
+        }
+    }
 }
 
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    disconnectPublisherPort(publisherPortData);
+    reclaimPublisherPort(publisherPortData, nullptr);
+}
+
+void PortManager::disconnectPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
     // create temporary publisher ports to orderly shut this publisher down
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
@@ -807,9 +1147,14 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
         this->sendToAllMatchingInterfacePorts(caproMessage);
     });
 
-    publisherPortRoudi.releaseAllChunks();
-
     m_portIntrospection.removePublisher(publisherPortUser);
+}
+
+void PortManager::reclaimPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData,
+                                       mepoo::ChunkReclamationReport* const report) noexcept
+{
+    PublisherPortRouDiType publisherPortRoudi{publisherPortData};
+    publisherPortRoudi.releaseAllChunks(report);
 
     IOX_LOG(DEBUG) << "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
                    << "' and with service description '" << publisherPortData->m_serviceDescription << "'";
@@ -818,6 +1163,12 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
 }
 
 void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    disconnectSubscriberPort(subscriberPortData);
+    reclaimSubscriberPort(subscriberPortData, nullptr);
+}
+
+void PortManager::disconnectSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
 {
     // create temporary subscriber ports to orderly shut this subscriber down
     SubscriberPortType subscriberPortRoudi(subscriberPortData);
@@ -833,9 +1184,14 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
         this->sendToAllMatchingPublisherPorts(caproMessage, subscriberPortRoudi);
     });
 
-    subscriberPortRoudi.releaseAllChunks();
-
     m_portIntrospection.removeSubscriber(subscriberPortUser);
+}
+
+void PortManager::reclaimSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData,
+                                        mepoo::ChunkReclamationReport* const report) noexcept
+{
+    SubscriberPortType subscriberPortRoudi(subscriberPortData);
+    subscriberPortRoudi.releaseAllChunks(report);
 
     IOX_LOG(DEBUG) << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
                    << "' and with service description '" << subscriberPortData->m_serviceDescription << "'";
@@ -942,8 +1298,18 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
                                        const RuntimeName_t& runtimeName,
                                        const PortConfigInfo& portConfigInfo) noexcept
 {
+    // the introspection memory is sized for port histogram subscribers which queue only the latest sample
+    auto options = subscriberOptions;
+    if ((service == IntrospectionPortHistogramService)
+        && (options.queueCapacity > PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY))
+    {
+        IOX_LOG(WARN) << "The queue capacity " << options.queueCapacity << " of the port histogram subscriber from '"
+                      << runtimeName << "' is limited to " << PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY;
+        options.queueCapacity = PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY;
+    }
+
     auto maybeSubscriberPortData =
-        m_portPool->addSubscriberPort(service, runtimeName, subscriberOptions, portConfigInfo.memoryInfo);
+        m_portPool->addSubscriberPort(service, runtimeName, options, portConfigInfo.memoryInfo);
     if (!maybeSubscriberPortData.has_error())
     {
         auto subscriberPortData = maybeSubscriberPortData.value();
@@ -987,23 +1353,21 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
     // it is not allowed to have two servers with the same ServiceDescription;
-    // check if the server is already in the list
-    for (const auto serverPortData : m_portPool->getServerPortDataList())
+    // check if the server is already in the list; the list is copied since destroying a port modifies the index
+    const auto serverPortsOfService = m_portPool->getServerPortDataListOfService(service);
+    for (const auto serverPortData : serverPortsOfService)
     {
-        if (service == serverPortData->m_serviceDescription)
+        if (serverPortData->m_toBeDestroyed)
         {
-            if (serverPortData->m_toBeDestroyed)
-            {
-                destroyServerPort(serverPortData);
-                continue;
-            }
-            IOX_LOG(WARN) << "Process '" << runtimeName
-                          << "' violates the communication policy by requesting a ServerPort which is already used by '"
-                          << serverPortData->m_runtimeName << "' with service '"
-                          << service.operator cxx::Serialization().toString() << "'.";
-            errorHandler(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, ErrorLevel::MODERATE);
-            return error<PortPoolError>(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            destroyServerPort(serverPortData);
+            continue;
         }
+        IOX_LOG(WARN) << "Process '" << runtimeName
+                      << "' violates the communication policy by requesting a ServerPort which is already used by '"
+                      << serverPortData->m_runtimeName << "' with service '"
+                      << service.operator cxx::Serialization().toString() << "'.";
+        errorHandler(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, ErrorLevel::MODERATE);
+        return error<PortPoolError>(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
     }
 
     // we can create a new port
@@ -1034,8 +1398,12 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
-void PortManager::publishServiceRegistry() const noexcept
+void PortManager::publishServiceRegistry() noexcept
 {
+    if (m_serviceRegistry.generation() == m_publishedServiceRegistryGeneration)
+    {
+        return;
+    }
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
         // should not happen (except during RouDi shutdown)
@@ -1043,6 +1411,8 @@ void PortManager::publishServiceRegistry() const noexcept
         IOX_LOG(WARN) << "Could not publish service registry!";
         return;
     }
+    m_publishedServiceRegistryGeneration = m_serviceRegistry.generation();
+
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
     publisher
         .tryAllocateChunk(sizeof(ServiceRegistry),
@@ -1058,6 +1428,50 @@ void PortManager::publishServiceRegistry() const noexcept
         .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry!"; });
 }
 
+void PortManager::publishServiceRegistryDelta(const capro::ServiceDescription& service) noexcept
+{
+    if (m_serviceRegistry.generation() == m_publishedServiceRegistryDeltaGeneration)
+    {
+        // the modification did not change the registry
+        return;
+    }
+    if (!m_serviceRegistryDeltaPublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        // the port always exists, otherwise we would terminate during startup
+        IOX_LOG(WARN) << "Could not publish service registry delta!";
+        return;
+    }
+    // a lost delta is detected by the applications with the generation and they catch up with the next snapshot
+    m_publishedServiceRegistryDeltaGeneration = m_serviceRegistry.generation();
+
+    // the counters stay zero if the entry was removed
+    ServiceRegistry::ServiceDescriptionEntry entry{service};
+    m_serviceRegistry.find(service.getServiceIDString(),
+                           service.getInstanceIDString(),
+                           service.getEventIDString(),
+                           [&](const ServiceRegistry::ServiceDescriptionEntry& serviceEntry) { entry = serviceEntry; });
+
+    PublisherPortUserType publisher(m_serviceRegistryDeltaPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryDelta),
+                          alignof(ServiceRegistryDelta),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            new (chunk->userPayload()) ServiceRegistryDelta(m_serviceRegistry.generation(), entry);
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry delta!"; });
+
+    if (m_serviceRegistry.generation() - m_publishedServiceRegistryGeneration
+        >= ServiceRegistryDelta::MAX_DELTAS_BETWEEN_SNAPSHOTS)
+    {
+        publishServiceRegistry();
+    }
+}
+
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
@@ -1069,13 +1483,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         IOX_LOG(WARN) << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryDelta(service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryDelta(service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1084,13 +1498,13 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         IOX_LOG(WARN) << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryDelta(service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryDelta(service);
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -1105,6 +1519,16 @@ PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noex
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
+expected<runtime::Heartbeat*, PortPoolError> PortManager::acquireHeartbeat() noexcept
+{
+    return m_portPool->addHeartbeat();
+}
+
+void PortManager::releaseHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept
+{
+    m_portPool->removeHeartbeat(heartbeat);
+}
+
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
 {
     for (auto& internalService : m_internalServices)
@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/roudi/port_pool.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 
 namespace iox
@@ -43,6 +45,83 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+ServicePortIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS>::PortList_t
+PortPool::getPublisherPortDataListOfService(const capro::ServiceDescription& service) const noexcept
+{
+    return m_publisherPortIndex.find(service);
+}
+
+ServicePortIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS>::PortList_t
+PortPool::getSubscriberPortDataListOfService(const capro::ServiceDescription& service) const noexcept
+{
+    return m_subscriberPortIndex.find(service);
+}
+
+ServicePortIndex<popo::ClientPortData, MAX_CLIENTS>::PortList_t
+PortPool::getClientPortDataListOfService(const capro::ServiceDescription& service) const noexcept
+{
+    return m_clientPortIndex.find(service);
+}
+
+ServicePortIndex<popo::ServerPortData, MAX_SERVERS>::PortList_t
+PortPool::getServerPortDataListOfService(const capro::ServiceDescription& service) const noexcept
+{
+    return m_serverPortIndex.find(service);
+}
+
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariableData;
+}
+
+vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getDirtyPublisherPortDataList() noexcept
+{
+    return collectDirtyPorts(m_portPoolData->m_publisherPortMembers, m_portPoolData->m_dirtyPublisherPorts);
+}
+
+vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getDirtySubscriberPortDataList() noexcept
+{
+    return collectDirtyPorts(m_portPoolData->m_subscriberPortMembers, m_portPoolData->m_dirtySubscriberPorts);
+}
+
+vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getDirtyClientPortDataList() noexcept
+{
+    return collectDirtyPorts(m_portPoolData->m_clientPortMembers, m_portPoolData->m_dirtyClientPorts);
+}
+
+vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getDirtyServerPortDataList() noexcept
+{
+    return collectDirtyPorts(m_portPoolData->m_serverPortMembers, m_portPoolData->m_dirtyServerPorts);
+}
+
+void PortPool::markAllPortsDirty() noexcept
+{
+    auto markDirty = [](popo::BasePortData* const portData) {
+        auto dirtyPortList = portData->m_dirtyPortListPtr.get();
+        if (dirtyPortList != nullptr)
+        {
+            dirtyPortList->mark(portData->m_dirtyPortListIndex);
+        }
+    };
+
+    for (auto portData : getPublisherPortDataList())
+    {
+        markDirty(portData);
+    }
+    for (auto portData : getSubscriberPortDataList())
+    {
+        markDirty(portData);
+    }
+    for (auto portData : getClientPortDataList())
+    {
+        markDirty(portData);
+    }
+    for (auto portData : getServerPortDataList())
+    {
+        markDirty(portData);
+    }
+}
+
 expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(const RuntimeName_t& runtimeName,
                                                                              const capro::Interfaces interface) noexcept
 {
@@ -93,6 +172,21 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+expected<runtime::Heartbeat*, PortPoolError> PortPool::addHeartbeat() noexcept
+{
+    if (m_portPoolData->m_heartbeatMembers.hasFreeSpace())
+    {
+        auto heartbeat = m_portPoolData->m_heartbeatMembers.insert();
+        return success<runtime::Heartbeat*>(heartbeat);
+    }
+    else
+    {
+        IOX_LOG(WARN) << "Out of heartbeats!";
+        errorHandler(PoshError::PORT_POOL__HEARTBEAT_LIST_OVERFLOW, ErrorLevel::MODERATE);
+        return error<PortPoolError>(PortPoolError::HEARTBEAT_LIST_FULL);
+    }
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
     m_portPoolData->m_interfacePortMembers.erase(portData);
@@ -108,6 +202,11 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept
+{
+    m_portPoolData->m_heartbeatMembers.erase(heartbeat);
+}
+
 vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
@@ -129,6 +228,10 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        attachToDiscovery(*publisherPortData,
+                          m_portPoolData->m_dirtyPublisherPorts,
+                          m_portPoolData->m_publisherPortMembers.indexOf(publisherPortData));
+        cxx::Ensures(m_publisherPortIndex.add(publisherPortData));
         return success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -150,6 +253,10 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        attachToDiscovery(*subscriberPortData,
+                          m_portPoolData->m_dirtySubscriberPorts,
+                          m_portPoolData->m_subscriberPortMembers.indexOf(subscriberPortData));
+        cxx::Ensures(m_subscriberPortIndex.add(subscriberPortData));
 
         return success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -189,6 +296,10 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    attachToDiscovery(*clientPortData,
+                      m_portPoolData->m_dirtyClientPorts,
+                      m_portPoolData->m_clientPortMembers.indexOf(clientPortData));
+    cxx::Ensures(m_clientPortIndex.add(clientPortData));
     return success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -209,27 +320,67 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    attachToDiscovery(*serverPortData,
+                      m_portPoolData->m_dirtyServerPorts,
+                      m_portPoolData->m_serverPortMembers.indexOf(serverPortData));
+    cxx::Ensures(m_serverPortIndex.add(serverPortData));
     return success<popo::ServerPortData*>(serverPortData);
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    m_publisherPortIndex.remove(portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    m_subscriberPortIndex.remove(portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    m_clientPortIndex.remove(portData);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    m_serverPortIndex.remove(portData);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
+void PortPool::removePublisherPortFromServiceIndex(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
+{
+    m_publisherPortIndex.remove(portData);
+}
+
+void PortPool::removeSubscriberPortFromServiceIndex(const SubscriberPortType::MemberType_t* const portData) noexcept
+{
+    m_subscriberPortIndex.remove(portData);
+}
+
+void PortPool::removeClientPortFromServiceIndex(const popo::ClientPortData* const portData) noexcept
+{
+    m_clientPortIndex.remove(portData);
+}
+
+void PortPool::removeServerPortFromServiceIndex(const popo::ServerPortData* const portData) noexcept
+{
+    m_serverPortIndex.remove(portData);
+}
+
+void PortPool::attachToDiscovery(popo::BasePortData& portData,
+                                 popo::DirtyPortList& dirtyPortList,
+                                 const uint64_t index) noexcept
+{
+    portData.m_discoveryConditionVariableDataPtr = &m_portPoolData->m_discoveryConditionVariableData;
+    portData.m_dirtyPortListPtr = &dirtyPortList;
+    portData.m_dirtyPortListIndex = index;
+
+    dirtyPortList.mark(index);
+    popo::ConditionNotifier(m_portPoolData->m_discoveryConditionVariableData, DISCOVERY_NOTIFICATION_INDEX).notify();
+}
+
 } // namespace roudi
 } // namespace iox
@@ -29,13 +29,14 @@ Process::Process(const RuntimeName_t& name,
                  const uint32_t pid,
                  const posix::PosixUser& user,
                  const bool isMonitored,
-                 const uint64_t sessionId) noexcept
+                 const uint64_t sessionId,
+                 runtime::Heartbeat* const heartbeat) noexcept
     : m_pid(pid)
     , m_ipcChannel(name)
-    , m_timestamp(mepoo::BaseClock_t::now())
     , m_user(user)
     , m_isMonitored(isMonitored)
     , m_sessionId(sessionId)
+    , m_heartbeat(heartbeat)
 {
 }
 
@@ -64,14 +65,9 @@ uint64_t Process::getSessionId() noexcept
     return m_sessionId.load(std::memory_order_relaxed);
 }
 
-void Process::setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept
+runtime::Heartbeat* Process::getHeartbeat() const noexcept
 {
-    m_timestamp = timestamp;
-}
-
-mepoo::TimePointNs_t Process::getTimestamp() noexcept
-{
-    return m_timestamp;
+    return m_heartbeat;
 }
 
 posix::PosixUser Process::getUser() const noexcept
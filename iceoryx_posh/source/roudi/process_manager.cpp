@@ -37,6 +37,22 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+runtime::IpcMessageErrorType publisherPortPoolErrorToIpcMessageErrorType(const PortPoolError error) noexcept
+{
+    switch (error)
+    {
+    case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+        return runtime::IpcMessageErrorType::NO_UNIQUE_CREATED;
+    case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        return runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN;
+    default:
+        return runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL;
+    }
+}
+} // namespace
+
 ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                                PortManager& portManager,
                                const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept
@@ -79,9 +95,13 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
-            m_portManager.unblockProcessShutdown(name);
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.unblockProcessShutdown(name);
+            }
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
@@ -92,6 +112,7 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -99,11 +120,13 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.unblockRouDiShutdown();
 }
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -116,6 +139,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -126,12 +150,22 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
                       << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
     }
+    {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        for (auto& process : m_processList)
+        {
+            m_portManager.releaseHeartbeat(process.getHeartbeat());
+        }
+    }
     m_processList.clear();
+    m_processIndex.clear();
+    m_processTerminationMonitor.clear();
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -195,6 +229,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint64_t sessionId,
                                      const version::VersionInfo& versionInfo) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     bool returnValue{false};
 
     findProcess(name)
@@ -257,21 +292,43 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         IOX_LOG(ERROR) << "Could not register process '" << name << "' - too many processes";
         return false;
     }
-    m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+
+    // a monitored process beats its heartbeat in the shared management segment, which is checked by monitorProcesses
+    runtime::Heartbeat* heartbeat{nullptr};
+    if (isMonitored)
+    {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        auto maybeHeartbeat = m_portManager.acquireHeartbeat();
+        if (maybeHeartbeat.has_error())
+        {
+            IOX_LOG(ERROR) << "Could not register process '" << name << "' - out of heartbeats";
+            return false;
+        }
+        heartbeat = maybeHeartbeat.value();
+    }
+
+    auto processIter = m_processList.emplace(m_processList.end(), name, pid, user, isMonitored, sessionId, heartbeat);
+    m_processIndex.insert(name, processIter);
+    if (isMonitored && !m_processTerminationMonitor.add(pid))
+    {
+        IOX_LOG(DEBUG) << "The termination of application " << name << " is only detected by its heartbeat";
+    }
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
-    const bool sendKeepAlive = isMonitored;
 
     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
+    // the heartbeat offset is only evaluated by the application if the process is monitored
+    UntypedRelativePointer::offset_t heartbeatOffset{0U};
+    if (heartbeat != nullptr)
+    {
+        heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat);
+    }
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId << sendKeepAlive;
+               << m_mgmtSegmentId << isMonitored << heartbeatOffset;
 
-    m_processList.back().sendViaIpcChannel(sendBuffer);
-
-    // set current timestamp again (already done in Process's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock_t::now());
+    processIter->sendViaIpcChannel(sendBuffer);
 
     m_processIntrospection->addProcess(static_cast<int>(pid), name);
 
@@ -281,6 +338,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -292,22 +350,17 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
-    // we need to search for the process (currently linear search)
-    auto it = m_processList.begin();
-    while (it != m_processList.end())
+    auto processIter = m_processIndex.find(name);
+    if (!processIter.has_value())
     {
-        auto otherName = it->getName();
-        if (name == otherName)
-        {
-            if (removeProcessAndDeleteRespectiveSharedMemoryObjects(it, feedback))
-            {
-                IOX_LOG(DEBUG) << "Removed existing application " << name;
-            }
-            return true; // we can assume there are no other processes with this name
-        }
-        ++it;
+        return false;
     }
-    return false;
+
+    if (removeProcessAndDeleteRespectiveSharedMemoryObjects(processIter.value(), feedback))
+    {
+        IOX_LOG(DEBUG) << "Removed existing application " << name;
+    }
+    return true;
 }
 
 bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(ProcessList_t::iterator& processIter,
@@ -315,7 +368,11 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
+        {
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+            m_portManager.deletePortsOfProcess(processIter->getName());
+            m_portManager.releaseHeartbeat(processIter->getHeartbeat());
+        }
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
@@ -326,30 +383,25 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
             processIter->sendViaIpcChannel(sendBuffer);
         }
 
+        m_processIndex.remove(processIter->getName());
+        removeFromProcessTerminationMonitor(*processIter);
         processIter = m_processList.erase(processIter); // delete application
         return true;
     }
     return false;
 }
 
-void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
-{
-    findProcess(name)
-        .and_then([&](auto& process) {
-            // reset timestamp
-            process->setTimestamp(mepoo::BaseClock_t::now());
-        })
-        .or_else([&]() { IOX_LOG(WARN) << "Received Keepalive from unknown process " << name; });
-}
-
 void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(interface, name, node);
+            portManagerLock.unlock();
 
             // send ReceiverPort to app as a serialized relative pointer
             auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, port);
@@ -366,9 +418,14 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) {
-            m_portManager.acquireNodeData(runtimeName, nodeName)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeNodeData = m_portManager.acquireNodeData(runtimeName, nodeName);
+            portManagerLock.unlock();
+
+            maybeNodeData
                 .and_then([&](auto nodeData) {
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, nodeData);
 
@@ -399,6 +456,7 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
@@ -413,11 +471,14 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a SubscriberPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             auto maybeSubscriber =
                 m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+            portManagerLock.unlock();
 
             if (!maybeSubscriber.has_error())
             {
@@ -453,6 +514,7 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a PublisherPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -468,8 +530,10 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                 return;
             }
 
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             auto maybePublisher = m_portManager.acquirePublisherPortData(
                 service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
 
             if (!maybePublisher.has_error())
             {
@@ -489,27 +553,8 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
 
-                std::string error;
-                switch (maybePublisher.get_error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
+                sendBuffer << runtime::IpcMessageErrorTypeToString(
+                    publisherPortPoolErrorToIpcMessageErrorType(maybePublisher.get_error()));
 
                 process->sendViaIpcChannel(sendBuffer);
                 IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << name
@@ -527,6 +572,7 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ClientPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -542,9 +588,12 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                 return;
             }
 
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeClient = m_portManager.acquireClientPortData(
+                service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
+
+            maybeClient
                 .and_then([&](auto& clientPort) {
                     auto relativePtrToClientPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
@@ -579,6 +628,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ServerPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -594,9 +644,12 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                 return;
             }
 
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeServer = m_portManager.acquireServerPortData(
+                service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
+
+            maybeServer
                 .and_then([&](auto& serverPort) {
                     auto relativePtrToServerPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
@@ -628,9 +681,14 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
-            m_portManager.acquireConditionVariableData(runtimeName)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeConditionVariable = m_portManager.acquireConditionVariableData(runtimeName);
+            portManagerLock.unlock();
+
+            maybeConditionVariable
                 .and_then([&](auto condVar) {
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
 
@@ -659,6 +717,172 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
             [&]() { IOX_LOG(WARN) << "Unknown application " << runtimeName << " requested a ConditionVariable."; });
 }
 
+void ProcessManager::claimManifestPortsForProcess(const RuntimeName_t& name) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto claimedPorts = m_portManager.claimManifestPorts(
+                name, segmentInfo.m_memoryManager.has_value() ? &segmentInfo.m_memoryManager.value().get() : nullptr);
+            portManagerLock.unlock();
+
+            // send the ports as serialized relative pointers; the publishers are followed by the subscribers
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CLAIM_MANIFEST_PORTS_ACK)
+                       << cxx::convert::toString(m_mgmtSegmentId) << cxx::convert::toString(claimedPorts.m_hasMore)
+                       << cxx::convert::toString(claimedPorts.m_publishers.size());
+            for (auto publisher : claimedPorts.m_publishers)
+            {
+                sendBuffer << cxx::convert::toString(
+                    UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, publisher));
+            }
+            for (auto subscriber : claimedPorts.m_subscribers)
+            {
+                sendBuffer << cxx::convert::toString(
+                    UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, subscriber));
+            }
+            process->sendViaIpcChannel(sendBuffer);
+
+            IOX_LOG(DEBUG) << "Application '" << name << "' claimed " << claimedPorts.m_publishers.size()
+                           << " publishers and " << claimedPorts.m_subscribers.size()
+                           << " subscribers of the manifest";
+        })
+        .or_else([&]() { IOX_LOG(WARN) << "Unknown application " << name << " claimed the ports of the manifest."; });
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& portBatch) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+            mepoo::MemoryManager* payloadDataSegmentMemoryManager =
+                segmentInfo.m_memoryManager.has_value() ? &segmentInfo.m_memoryManager.value().get() : nullptr;
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+
+            // send the result of each port in the order of the request; either the serialized relative pointer to the
+            // port or the reason why it could not be created
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK)
+                       << cxx::convert::toString(m_mgmtSegmentId);
+            uint64_t numberOfCreatedPorts{0U};
+            for (const auto& entry : portBatch.entries())
+            {
+                addPortOfBatchForProcess(name, entry, payloadDataSegmentMemoryManager)
+                    .and_then([&](auto offset) {
+                        sendBuffer << cxx::convert::toString(true) << cxx::convert::toString(offset);
+                        ++numberOfCreatedPorts;
+                    })
+                    .or_else([&](auto error) {
+                        sendBuffer << cxx::convert::toString(false) << runtime::IpcMessageErrorTypeToString(error);
+                    });
+            }
+            portManagerLock.unlock();
+            process->sendViaIpcChannel(sendBuffer);
+
+            IOX_LOG(DEBUG) << "Created " << numberOfCreatedPorts << " of " << portBatch.size()
+                           << " ports of a batch for application '" << name << "'";
+        })
+        .or_else([&]() { IOX_LOG(WARN) << "Unknown application " << name << " requested a batch of ports."; });
+}
+
+expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>
+ProcessManager::addPortOfBatchForProcess(const RuntimeName_t& name,
+                                         const runtime::PortBatch::Entry& entry,
+                                         mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
+{
+    using PortType = runtime::PortBatch::PortType;
+
+    void* port{nullptr};
+    switch (entry.portType)
+    {
+    case PortType::PUBLISHER:
+    {
+        if (payloadDataSegmentMemoryManager == nullptr)
+        {
+            return error<runtime::IpcMessageErrorType>(
+                runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+        }
+        auto maybePublisher = m_portManager.acquirePublisherPortData(entry.service,
+                                                                     *entry.options.get<popo::PublisherOptions>(),
+                                                                     name,
+                                                                     payloadDataSegmentMemoryManager,
+                                                                     entry.portConfigInfo);
+        if (maybePublisher.has_error())
+        {
+            return error<runtime::IpcMessageErrorType>(
+                publisherPortPoolErrorToIpcMessageErrorType(maybePublisher.get_error()));
+        }
+        port = maybePublisher.value();
+        break;
+    }
+    case PortType::SUBSCRIBER:
+    {
+        auto maybeSubscriber = m_portManager.acquireSubscriberPortData(
+            entry.service, *entry.options.get<popo::SubscriberOptions>(), name, entry.portConfigInfo);
+        if (maybeSubscriber.has_error())
+        {
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+        }
+        port = maybeSubscriber.value();
+        break;
+    }
+    case PortType::CLIENT:
+    {
+        if (payloadDataSegmentMemoryManager == nullptr)
+        {
+            return error<runtime::IpcMessageErrorType>(
+                runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+        }
+        auto maybeClient = m_portManager.acquireClientPortData(entry.service,
+                                                               *entry.options.get<popo::ClientOptions>(),
+                                                               name,
+                                                               payloadDataSegmentMemoryManager,
+                                                               entry.portConfigInfo);
+        if (maybeClient.has_error())
+        {
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+        }
+        port = maybeClient.value();
+        break;
+    }
+    case PortType::SERVER:
+    {
+        if (payloadDataSegmentMemoryManager == nullptr)
+        {
+            return error<runtime::IpcMessageErrorType>(
+                runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+        }
+        auto maybeServer = m_portManager.acquireServerPortData(entry.service,
+                                                               *entry.options.get<popo::ServerOptions>(),
+                                                               name,
+                                                               payloadDataSegmentMemoryManager,
+                                                               entry.portConfigInfo);
+        if (maybeServer.has_error())
+        {
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+        }
+        port = maybeServer.value();
+        break;
+    }
+    case PortType::CONDITION_VARIABLE:
+    {
+        auto maybeConditionVariable = m_portManager.acquireConditionVariableData(name);
+        if (maybeConditionVariable.has_error())
+        {
+            return error<runtime::IpcMessageErrorType>(runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
+        }
+        port = maybeConditionVariable.value();
+        break;
+    }
+    }
+
+    return success<UntypedRelativePointer::offset_t>(
+        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, port));
+}
+
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
 {
     m_processIntrospection = processIntrospection;
@@ -670,23 +894,28 @@ void ProcessManager::run() noexcept
     discoveryUpdate();
 }
 
+void ProcessManager::requestFullDiscovery() noexcept
+{
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    m_portManager.requestFullDiscovery();
+}
+
 popo::PublisherPortData*
 ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept
 {
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
     options.nodeName = INTROSPECTION_NODE_NAME;
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     return m_portManager.acquireInternalPublisherPortData(service, options, m_introspectionMemoryManager);
 }
 
 optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexcept
 {
-    for (auto& process : m_processList)
+    auto processIter = m_processIndex.find(name);
+    if (processIter.has_value())
     {
-        if (process.getName() == name)
-        {
-            return make_optional<Process*>(&process);
-        }
+        return make_optional<Process*>(&*processIter.value());
     }
 
     return nullopt;
@@ -694,14 +923,15 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
 
 void ProcessManager::monitorProcesses() noexcept
 {
-    auto currentTimestamp = mepoo::BaseClock_t::now();
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
 
     auto processIterator = m_processList.begin();
     while (processIterator != m_processList.end())
     {
-        if (processIterator->isMonitored())
+        auto heartbeat = processIterator->getHeartbeat();
+        if (processIterator->isMonitored() && heartbeat != nullptr)
         {
-            auto timediff = into<units::Duration>(currentTimestamp - processIterator->getTimestamp());
+            auto timediff = units::Duration::fromMilliseconds(heartbeat->elapsedMillisecondsSinceLastBeat());
 
             static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                           "keep alive timeout too small");
@@ -716,11 +946,17 @@ void ProcessManager::monitorProcesses() noexcept
                 // delete all associated subscriber and publisher ports in shared
                 // memory and the associated RouDi discovery ports
                 // @todo iox-#539 Check if ShmManager and Process Manager end up in unintended condition
-                m_portManager.deletePortsOfProcess(processIterator->getName());
+                {
+                    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                    m_portManager.deletePortsOfProcess(processIterator->getName());
+                    m_portManager.releaseHeartbeat(heartbeat);
+                }
 
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
 
                 // delete application
+                m_processIndex.remove(processIterator->getName());
+                removeFromProcessTerminationMonitor(*processIterator);
                 processIterator = m_processList.erase(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
@@ -729,8 +965,60 @@ void ProcessManager::monitorProcesses() noexcept
     }
 }
 
+bool ProcessManager::isProcessTerminationMonitoringAvailable() const noexcept
+{
+    return m_processTerminationMonitor.isAvailable();
+}
+
+void ProcessManager::monitorProcessTerminations(const units::Duration timeout) noexcept
+{
+    // the wait is done without a lock in order to not block the registration and the runtime messages
+    auto terminatedProcesses = m_processTerminationMonitor.wait(timeout);
+    if (terminatedProcesses.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
+    for (const auto pid : terminatedProcesses)
+    {
+        // all processes with this pid are removed, e.g. multiple runtimes in the same process
+        auto processIterator = m_processList.begin();
+        while (processIterator != m_processList.end())
+        {
+            if (processIterator->getPid() == pid && processIterator->isMonitored())
+            {
+                IOX_LOG(WARN) << "Application " << processIterator->getName() << " with PID " << pid
+                              << " terminated without unregistering --> removing it";
+                constexpr TerminationFeedback FEEDBACK{TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS};
+                removeProcessAndDeleteRespectiveSharedMemoryObjects(processIterator, FEEDBACK);
+                continue; // processIterator points to the element after the removed one
+            }
+            ++processIterator;
+        }
+
+        // the pidfd of a terminated process stays readable; it must also be removed if the process was already
+        // removed in the meantime, e.g. by an unregistration which raced with the wait
+        m_processTerminationMonitor.remove(pid);
+    }
+}
+
+void ProcessManager::removeFromProcessTerminationMonitor(const Process& process) noexcept
+{
+    // multiple runtimes in the same process share the monitored pid
+    for (const auto& otherProcess : m_processList)
+    {
+        if (&otherProcess != &process && otherProcess.getPid() == process.getPid() && otherProcess.isMonitored())
+        {
+            return;
+        }
+    }
+    m_processTerminationMonitor.remove(process.getPid());
+}
+
 void ProcessManager::discoveryUpdate() noexcept
 {
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.doDiscovery();
 }
 
@@ -0,0 +1,178 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/pidfd.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+ProcessTerminationMonitor::ProcessTerminationMonitor() noexcept
+{
+    // kernels older than 5.3 and platforms other than Linux do not support pidfds; this is detected once with the pid
+    // of RouDi itself
+    auto ownPidFdCall = posix::posixCall(iox_pidfd_open)(getpid(), 0U)
+                            .failureReturnValue(-1)
+                            .suppressErrorMessagesForErrnos(ENOSYS)
+                            .evaluate();
+    if (ownPidFdCall.has_error())
+    {
+        IOX_LOG(INFO) << "pidfds are not supported; terminated processes are only detected by the heartbeat";
+        return;
+    }
+    closeFileDescriptor(ownPidFdCall->value);
+
+    posix::posixCall(iox_pidfd_monitor_create)()
+        .failureReturnValue(-1)
+        .evaluate()
+        .and_then([&](auto& r) { m_monitorFd = r.value; })
+        .or_else([&](auto&) {
+            IOX_LOG(WARN) << "Unable to create the pidfd monitor; terminated processes are only detected by the "
+                             "heartbeat";
+        });
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept
+{
+    clear();
+    closeFileDescriptor(m_monitorFd);
+}
+
+bool ProcessTerminationMonitor::isAvailable() const noexcept
+{
+    return m_monitorFd != INVALID_FD;
+}
+
+bool ProcessTerminationMonitor::add(const uint32_t pid) noexcept
+{
+    if (!isAvailable())
+    {
+        return false;
+    }
+
+    for (const auto& monitoredProcess : m_monitoredProcesses)
+    {
+        // e.g. multiple runtimes in the same process
+        if (monitoredProcess.pid == pid)
+        {
+            return true;
+        }
+    }
+
+    if (m_monitoredProcesses.size() == m_monitoredProcesses.capacity())
+    {
+        return false;
+    }
+
+    auto pidFdCall = posix::posixCall(iox_pidfd_open)(static_cast<pid_t>(pid), 0U)
+                         .failureReturnValue(-1)
+                         .suppressErrorMessagesForErrnos(ESRCH)
+                         .evaluate();
+    if (pidFdCall.has_error())
+    {
+        return false;
+    }
+    const int32_t pidFd = pidFdCall->value;
+
+    auto addCall =
+        posix::posixCall(iox_pidfd_monitor_add)(m_monitorFd, pidFd, pid).failureReturnValue(-1).evaluate();
+    if (addCall.has_error())
+    {
+        closeFileDescriptor(pidFd);
+        return false;
+    }
+
+    m_monitoredProcesses.emplace_back(MonitoredProcess{pid, pidFd});
+    return true;
+}
+
+void ProcessTerminationMonitor::remove(const uint32_t pid) noexcept
+{
+    for (auto iter = m_monitoredProcesses.begin(); iter != m_monitoredProcesses.end(); ++iter)
+    {
+        if (iter->pid == pid)
+        {
+            closeFileDescriptor(iter->pidFd);
+            m_monitoredProcesses.erase(iter);
+            return;
+        }
+    }
+}
+
+void ProcessTerminationMonitor::clear() noexcept
+{
+    for (const auto& monitoredProcess : m_monitoredProcesses)
+    {
+        closeFileDescriptor(monitoredProcess.pidFd);
+    }
+    m_monitoredProcesses.clear();
+}
+
+ProcessTerminationMonitor::TerminatedProcesses_t
+ProcessTerminationMonitor::wait(const units::Duration timeout) noexcept
+{
+    TerminatedProcesses_t terminatedProcesses;
+
+    if (isAvailable())
+    {
+        std::array<uint32_t, MAX_PROCESS_NUMBER> pids{};
+        const auto timeoutInMilliseconds =
+            std::min(timeout.toMilliseconds(), static_cast<uint64_t>(std::numeric_limits<int>::max()));
+        auto waitCall = posix::posixCall(iox_pidfd_monitor_wait)(m_monitorFd,
+                                                                 pids.data(),
+                                                                 static_cast<int>(MAX_PROCESS_NUMBER),
+                                                                 static_cast<int>(timeoutInMilliseconds))
+                            .failureReturnValue(-1)
+                            .ignoreErrnos(EINTR)
+                            .evaluate();
+        if (!waitCall.has_error())
+        {
+            for (int32_t i = 0; i < waitCall->value; ++i)
+            {
+                terminatedProcesses.emplace_back(pids[static_cast<uint64_t>(i)]);
+            }
+        }
+        return terminatedProcesses;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout.toMilliseconds()));
+    return terminatedProcesses;
+}
+
+void ProcessTerminationMonitor::closeFileDescriptor(const int32_t fd) noexcept
+{
+    if (fd == INVALID_FD)
+    {
+        return;
+    }
+
+    // closing a pidfd also removes it from the monitor
+    posix::posixCall(iox_close)(fd).failureReturnValue(-1).evaluate().or_else(
+        [](auto& r) { IOX_LOG(ERROR) << "Unable to close file descriptor: " << r.getHumanReadableErrnum(); });
+}
+
+} // namespace roudi
+} // namespace iox
@@ -21,10 +21,12 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
 
 namespace iox
@@ -39,24 +41,24 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
+    , m_numberOfRuntimeMessagesThreads(
+          algorithm::minVal(algorithm::maxVal(roudiStartupParameters.m_numberOfRuntimeMessagesThreads, 1U),
+                            MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS))
 {
     if (internal::isCompiledOn32BitSystem())
     {
         IOX_LOG(WARN) << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -67,6 +69,13 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
     posix::setThreadName(m_monitoringAndDiscoveryThread.native_handle(), "Mon+Discover");
 
+    // the heartbeat is still checked by the 'Mon+Discover' thread for processes which cannot be monitored otherwise
+    if (m_monitoringMode == roudi::MonitoringMode::ON && m_prcMgr.isProcessTerminationMonitoringAvailable())
+    {
+        m_processTerminationMonitoringThread = std::thread(&RouDi::monitorProcessTerminations, this);
+        posix::setThreadName(m_processTerminationMonitoringThread.native_handle(), "Mon+Terminate");
+    }
+
     if (roudiStartupParameters.m_runtimesMessagesThreadStart == RuntimeMessagesThreadStart::IMMEDIATE)
     {
         startProcessRuntimeMessagesThread();
@@ -80,8 +89,17 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
-    m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
-    posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
+    // all threads receive from the same IPC channel; each message is handled by exactly one of them
+    m_roudiIpcInterface.emplace(IPC_CHANNEL_ROUDI_NAME);
+
+    // the logger is intentionally not used, to ensure that this message is always printed
+    std::cout << "RouDi is ready for clients" << std::endl;
+
+    for (uint32_t i = 0U; i < m_numberOfRuntimeMessagesThreads; ++i)
+    {
+        m_handleRuntimeMessageThreads.emplace_back(&RouDi::processRuntimeMessages, this);
+        posix::setThreadName(m_handleRuntimeMessageThreads.back().native_handle(), "IPC-msg-process");
+    }
 }
 
 void RouDi::shutdown() noexcept
@@ -97,16 +115,22 @@ void RouDi::shutdown() noexcept
         m_monitoringAndDiscoveryThread.join();
         IOX_LOG(DEBUG) << "...'Mon+Discover' thread joined.";
     }
+    if (m_processTerminationMonitoringThread.joinable())
+    {
+        IOX_LOG(DEBUG) << "Joining 'Mon+Terminate' thread...";
+        m_processTerminationMonitoringThread.join();
+        IOX_LOG(DEBUG) << "...'Mon+Terminate' thread joined.";
+    }
 
     if (m_killProcessesInDestructor)
     {
         deadline_timer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -119,27 +143,32 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
     // Postpone the IpcChannelThread in order to receive TERMINATION
     m_runHandleRuntimeMessageThread = false;
 
-    if (m_handleRuntimeMessageThread.joinable())
+    for (auto& handleRuntimeMessageThread : m_handleRuntimeMessageThreads)
     {
-        IOX_LOG(DEBUG) << "Joining 'IPC-msg-process' thread...";
-        m_handleRuntimeMessageThread.join();
-        IOX_LOG(DEBUG) << "...'IPC-msg-process' thread joined.";
+        if (handleRuntimeMessageThread.joinable())
+        {
+            IOX_LOG(DEBUG) << "Joining 'IPC-msg-process' thread...";
+            handleRuntimeMessageThread.join();
+            IOX_LOG(DEBUG) << "...'IPC-msg-process' thread joined.";
+        }
     }
+    m_handleRuntimeMessageThreads.clear();
+    m_roudiIpcInterface.reset();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -149,28 +178,54 @@ void RouDi::cyclicUpdateHook() noexcept
 
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
+    popo::ConditionListener discoveryListener(m_portManager->getDiscoveryConditionVariableData());
+    deadline_timer fallbackDiscoveryTimer(DISCOVERY_FALLBACK_INTERVAL);
+    bool isDiscoveryRequested{true};
+
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        // on a state change the ports mark themselves in the dirty port lists and notify the discovery condition
+        // variable; a notified discovery run only processes the marked ports. The periodic fallback run is the safety
+        // net for lost notifications and processes all ports, it also takes care of everything which is not marked,
+        // like interfaces, nodes and condition variables. It is not postponed by notified runs, otherwise a steady
+        // stream of notifications would suppress it
+        const bool isFallbackDiscoveryDue = fallbackDiscoveryTimer.hasExpired();
+        if (isFallbackDiscoveryDue)
+        {
+            m_prcMgr.requestFullDiscovery();
+            fallbackDiscoveryTimer.reset();
+        }
+
+        if (isDiscoveryRequested || isFallbackDiscoveryDue)
+        {
+            m_prcMgr.run();
+        }
+        else
+        {
+            m_prcMgr.monitorProcesses();
+        }
 
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        isDiscoveryRequested = !discoveryListener.timedWait(DISCOVERY_INTERVAL).empty();
     }
 }
 
-void RouDi::processRuntimeMessages() noexcept
+void RouDi::monitorProcessTerminations() noexcept
 {
-    runtime::IpcInterfaceCreator roudiIpcInterface{IPC_CHANNEL_ROUDI_NAME};
-
-    // the logger is intentionally not used, to ensure that this message is always printed
-    std::cout << "RouDi is ready for clients" << std::endl;
+    while (m_runMonitoringAndDiscoveryThread)
+    {
+        m_prcMgr.monitorProcessTerminations(DISCOVERY_INTERVAL);
+    }
+}
 
+void RouDi::processRuntimeMessages() noexcept
+{
     while (m_runHandleRuntimeMessageThread)
     {
         // read RouDi's IPC channel
         runtime::IpcMessage message;
-        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
+        if (m_roudiIpcInterface->timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
             auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
             RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
@@ -192,6 +247,91 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
     return serializationVersionInfo;
 }
 
+bool RouDi::parseCreatePortsMessage(const runtime::IpcMessage& message, runtime::PortBatch& portBatch) noexcept
+{
+    using PortType = runtime::PortBatch::PortType;
+    // each port consists of its type followed by the serialized service description, options and port config info;
+    // a condition variable consists only of its type
+    constexpr uint32_t NUMBER_OF_PORT_ELEMENTS{3U};
+
+    uint32_t index{2U};
+    while (index < message.getNumberOfElements())
+    {
+        std::underlying_type<PortType>::type portType{0U};
+        if (!cxx::convert::fromString(message.getElementAtIndex(index).c_str(), portType))
+        {
+            return false;
+        }
+        ++index;
+
+        if (static_cast<PortType>(portType) == PortType::CONDITION_VARIABLE)
+        {
+            portBatch.addConditionVariables(1U);
+            continue;
+        }
+
+        if (index + NUMBER_OF_PORT_ELEMENTS > message.getNumberOfElements())
+        {
+            return false;
+        }
+        auto service = capro::ServiceDescription::deserialize(cxx::Serialization(message.getElementAtIndex(index)));
+        if (service.has_error())
+        {
+            return false;
+        }
+        cxx::Serialization options(message.getElementAtIndex(index + 1U));
+        runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(index + 2U))};
+        index += NUMBER_OF_PORT_ELEMENTS;
+
+        switch (static_cast<PortType>(portType))
+        {
+        case PortType::PUBLISHER:
+        {
+            auto publisherOptions = popo::PublisherOptions::deserialize(options);
+            if (publisherOptions.has_error())
+            {
+                return false;
+            }
+            portBatch.addPublisher(service.value(), publisherOptions.value(), portConfigInfo);
+            break;
+        }
+        case PortType::SUBSCRIBER:
+        {
+            auto subscriberOptions = popo::SubscriberOptions::deserialize(options);
+            if (subscriberOptions.has_error())
+            {
+                return false;
+            }
+            portBatch.addSubscriber(service.value(), subscriberOptions.value(), portConfigInfo);
+            break;
+        }
+        case PortType::CLIENT:
+        {
+            auto clientOptions = popo::ClientOptions::deserialize(options);
+            if (clientOptions.has_error())
+            {
+                return false;
+            }
+            portBatch.addClient(service.value(), clientOptions.value(), portConfigInfo);
+            break;
+        }
+        case PortType::SERVER:
+        {
+            auto serverOptions = popo::ServerOptions::deserialize(options);
+            if (serverOptions.has_error())
+            {
+                return false;
+            }
+            portBatch.addServer(service.value(), serverOptions.value(), portConfigInfo);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
 void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
@@ -252,7 +392,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -289,7 +429,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -326,7 +466,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -362,7 +502,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -375,7 +515,34 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CLAIM_MANIFEST_PORTS:
+    {
+        if (message.getNumberOfElements() != 2)
+        {
+            IOX_LOG(ERROR) << "Wrong number of parameters for \"IpcMessageType::CLAIM_MANIFEST_PORTS\" from \""
+                           << runtimeName << "\"received!";
+        }
+        else
+        {
+            m_prcMgr.claimManifestPortsForProcess(runtimeName);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        runtime::PortBatch portBatch;
+        if (!parseCreatePortsMessage(message, portBatch))
+        {
+            IOX_LOG(ERROR) << "Deserialization of the ports of \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                           << "\" failed when '" << message.getMessage() << "' was provided";
+        }
+        else
+        {
+            m_prcMgr.addPortsForProcess(runtimeName, portBatch);
         }
         break;
     }
@@ -391,7 +558,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, into<lossy<NodeName_t>>(message.getElementAtIndex(3)));
         }
         break;
@@ -406,15 +573,10 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
-    case runtime::IpcMessageType::KEEPALIVE:
-    {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
-        break;
-    }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
     {
         if (message.getNumberOfElements() != 2)
@@ -425,10 +587,15 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
+    case runtime::IpcMessageType::KEEPALIVE:
+    {
+        // sent by runtimes from before the heartbeat; there is nothing to do since they are monitored by the heartbeat
+        break;
+    }
     case runtime::IpcMessageType::TERMINATION:
     {
         if (message.getNumberOfElements() != 2)
@@ -438,7 +605,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -446,7 +613,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(ERROR) << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -461,13 +628,13 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    static std::atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::IpcMessageErrorHandler() noexcept
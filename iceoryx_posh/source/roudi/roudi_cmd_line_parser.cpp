@@ -37,10 +37,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-messages-threads", required_argument, nullptr, 't'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:t:";
     int32_t index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -73,6 +74,17 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-t, --runtime-messages-threads <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which receive and answer the"
+                      << std::endl;
+            std::cout << "                                  messages of the applications, e.g. their registration."
+                      << std::endl;
+            std::cout << "                                  The ports are still created by one thread at a time."
+                      << std::endl;
+            std::cout << "                                  <UINT> [1, "
+                      << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS << "]" << std::endl;
+            std::cout << "                                  default = '"
+                      << roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGES_THREADS << "'" << std::endl;
 
             m_run = false;
             break;
@@ -166,6 +178,23 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 't':
+        {
+            uint32_t numberOfRuntimeMessagesThreads{0U};
+            if (!cxx::convert::fromString(optarg, numberOfRuntimeMessagesThreads)
+                || numberOfRuntimeMessagesThreads == 0U
+                || numberOfRuntimeMessagesThreads > roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS)
+            {
+                IOX_LOG(ERROR) << "The number of runtime messages threads must be in the range of [1, "
+                               << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS << "]";
+                m_run = false;
+            }
+            else
+            {
+                m_numberOfRuntimeMessagesThreads = numberOfRuntimeMessagesThreads;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -217,6 +246,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                                 m_logLevel,
                                                 m_compatibilityCheckLevel,
                                                 m_processKillDelay,
+                                                m_numberOfRuntimeMessagesThreads,
                                                 m_uniqueRouDiId,
                                                 m_run,
                                                 iox::roudi::ConfigFilePathString_t("")});
@@ -169,6 +169,82 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
              mempoolConfig});
     }
 
+    auto publishers = parsedFile->get_table_array("publisher");
+    auto subscribers = parsedFile->get_table_array("subscriber");
+    const uint64_t numberOfManifestPorts = (publishers ? publishers->get().size() : 0U)
+                                           + (subscribers ? subscribers->get().size() : 0U);
+    if (numberOfManifestPorts > iox::MAX_NUMBER_OF_MANIFEST_PORTS)
+    {
+        return iox::error<iox::roudi::RouDiConfigFileParseError>(
+            iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED);
+    }
+
+    auto parseManifestPorts =
+        [&](const std::shared_ptr<cpptoml::table_array>& ports,
+            const ManifestPortEntry::PortType portType) -> iox::expected<iox::roudi::RouDiConfigFileParseError> {
+        if (!ports)
+        {
+            return iox::success<>();
+        }
+
+        for (auto port : *ports)
+        {
+            auto runtimeName = port->get_as<std::string>("runtime");
+            if (!runtimeName)
+            {
+                return iox::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::MANIFEST_PORT_WITHOUT_RUNTIME_NAME);
+            }
+
+            auto service = port->get_as<std::string>("service");
+            auto instance = port->get_as<std::string>("instance");
+            auto event = port->get_as<std::string>("event");
+            if (!service || !instance || !event)
+            {
+                return iox::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION);
+            }
+
+            ManifestPortEntry entry;
+            entry.m_portType = portType;
+            entry.m_runtimeName = RuntimeName_t(iox::TruncateToCapacity, runtimeName->c_str(), runtimeName->size());
+            entry.m_serviceDescription = capro::ServiceDescription(
+                capro::IdString_t(iox::TruncateToCapacity, service->c_str(), service->size()),
+                capro::IdString_t(iox::TruncateToCapacity, instance->c_str(), instance->size()),
+                capro::IdString_t(iox::TruncateToCapacity, event->c_str(), event->size()));
+
+            auto nodeName = port->get_as<std::string>("node").value_or(*runtimeName);
+            auto node = NodeName_t(iox::TruncateToCapacity, nodeName.c_str(), nodeName.size());
+            if (portType == ManifestPortEntry::PortType::PUBLISHER)
+            {
+                entry.m_publisherOptions.nodeName = node;
+                entry.m_publisherOptions.historyCapacity =
+                    port->get_as<uint64_t>("history_capacity").value_or(entry.m_publisherOptions.historyCapacity);
+            }
+            else
+            {
+                entry.m_subscriberOptions.nodeName = node;
+                entry.m_subscriberOptions.queueCapacity =
+                    port->get_as<uint64_t>("queue_capacity").value_or(entry.m_subscriberOptions.queueCapacity);
+                entry.m_subscriberOptions.historyRequest =
+                    port->get_as<uint64_t>("history_request").value_or(entry.m_subscriberOptions.historyRequest);
+            }
+            parsedConfig.m_manifestPorts.emplace_back(entry);
+        }
+
+        return iox::success<>();
+    };
+
+    auto manifestParseResult = parseManifestPorts(publishers, ManifestPortEntry::PortType::PUBLISHER);
+    if (!manifestParseResult.has_error())
+    {
+        manifestParseResult = parseManifestPorts(subscribers, ManifestPortEntry::PortType::SUBSCRIBER);
+    }
+    if (manifestParseResult.has_error())
+    {
+        return iox::error<iox::roudi::RouDiConfigFileParseError>(manifestParseResult.get_error());
+    }
+
     return iox::success<iox::RouDiConfig_t>(parsedConfig);
 }
 } // namespace config
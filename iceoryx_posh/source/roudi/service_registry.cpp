@@ -21,55 +21,191 @@ namespace iox
 {
 namespace roudi
 {
-ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
-    : serviceDescription(serviceDescription)
+namespace
+{
+bool isMatching(const capro::ServiceDescription& serviceDescription,
+                const optional<capro::IdString_t>& service,
+                const optional<capro::IdString_t>& instance,
+                const optional<capro::IdString_t>& event) noexcept
 {
+    bool match = (service) ? (serviceDescription.getServiceIDString() == *service) : true;
+    match &= (instance) ? (serviceDescription.getInstanceIDString() == *instance) : true;
+    match &= (event) ? (serviceDescription.getEventIDString() == *event) : true;
+    return match;
 }
+} // namespace
 
-expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
-                                                      ReferenceCounter_t ServiceDescriptionEntry::*count)
+constexpr uint32_t ServiceRegistry::HashIndex::BUCKET_COUNT;
+constexpr uint64_t ServiceRegistryDelta::MAX_DELTAS_BETWEEN_SNAPSHOTS;
+constexpr uint64_t ServiceRegistryDelta::HISTORY_CAPACITY;
+constexpr uint64_t ServiceRegistryDelta::SUBSCRIBER_QUEUE_CAPACITY;
+constexpr uint32_t ServiceRegistryDelta::MAX_SUBSCRIBERS;
+
+ServiceRegistry::HashIndex::HashIndex() noexcept
 {
-    auto index = findIndex(serviceDescription);
-    if (index != NO_INDEX)
+    for (auto& bucket : m_buckets)
     {
-        // multiple entries with the same service descripion are possible
-        // and we just increase the count in this case (multi-set semantics)
-        // entry exists, increment counter
-        auto& entry = m_serviceDescriptions[index];
-        ((*entry).*count)++;
-        return success<>();
+        bucket = NO_INDEX;
     }
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        m_next[i] = NO_INDEX;
+        m_previous[i] = NO_INDEX;
+    }
+}
 
-    // entry does not exist, find a free slot if it exists
+uint32_t ServiceRegistry::HashIndex::bucket(const uint64_t hash) noexcept
+{
+    return static_cast<uint32_t>(hash % BUCKET_COUNT);
+}
+
+void ServiceRegistry::HashIndex::insert(const uint64_t hash, const uint32_t index) noexcept
+{
+    auto& head = m_buckets[bucket(hash)];
+
+    // keep the chain ordered by position
+    uint32_t previous = NO_INDEX;
+    uint32_t current = head;
+    while (current != NO_INDEX && current < index)
+    {
+        previous = current;
+        current = m_next[current];
+    }
+
+    m_previous[index] = previous;
+    m_next[index] = current;
+    if (current != NO_INDEX)
+    {
+        m_previous[current] = index;
+    }
+    if (previous != NO_INDEX)
+    {
+        m_next[previous] = index;
+    }
+    else
+    {
+        head = index;
+    }
+}
+
+void ServiceRegistry::HashIndex::remove(const uint64_t hash, const uint32_t index) noexcept
+{
+    const auto previous = m_previous[index];
+    const auto next = m_next[index];
 
+    if (next != NO_INDEX)
+    {
+        m_previous[next] = previous;
+    }
+    if (previous != NO_INDEX)
+    {
+        m_next[previous] = next;
+    }
+    else
+    {
+        m_buckets[bucket(hash)] = next;
+    }
+
+    m_previous[index] = NO_INDEX;
+    m_next[index] = NO_INDEX;
+}
+
+uint32_t ServiceRegistry::HashIndex::first(const uint64_t hash) const noexcept
+{
+    return m_buckets[bucket(hash)];
+}
+
+uint32_t ServiceRegistry::HashIndex::next(const uint32_t index) const noexcept
+{
+    return m_next[index];
+}
+
+ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
+    : serviceDescription(serviceDescription)
+{
+}
+
+void ServiceRegistry::emplaceAt(const uint32_t index,
+                                const capro::ServiceDescription& serviceDescription,
+                                ReferenceCounter_t ServiceDescriptionEntry::*count) noexcept
+{
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+
+    capro::IdStringHash hashString;
+    m_serviceDescriptionIndex.insert(capro::ServiceDescriptionHash()(serviceDescription), index);
+    m_serviceIndex.insert(hashString(serviceDescription.getServiceIDString()), index);
+    m_instanceIndex.insert(hashString(serviceDescription.getInstanceIDString()), index);
+    m_eventIndex.insert(hashString(serviceDescription.getEventIDString()), index);
+}
+
+void ServiceRegistry::resetAt(const uint32_t index) noexcept
+{
+    auto& entry = m_serviceDescriptions[index];
+    const auto& serviceDescription = entry->serviceDescription;
+
+    capro::IdStringHash hashString;
+    m_serviceDescriptionIndex.remove(capro::ServiceDescriptionHash()(serviceDescription), index);
+    m_serviceIndex.remove(hashString(serviceDescription.getServiceIDString()), index);
+    m_instanceIndex.remove(hashString(serviceDescription.getInstanceIDString()), index);
+    m_eventIndex.remove(hashString(serviceDescription.getEventIDString()), index);
+
+    entry.reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = index;
+}
+
+uint32_t ServiceRegistry::acquireFreeIndex() noexcept
+{
     // fast path to a free slot (which was occupied by previously removed entry),
     // prefer to fill entries close to the front
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
+        auto index = m_freeIndex;
         m_freeIndex = NO_INDEX;
-        return success<>();
+        return index;
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t i = 0U; i < m_serviceDescriptions.size(); ++i)
     {
-        if (!entry)
+        if (!m_serviceDescriptions[i])
         {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            return success<>();
+            return i;
         }
     }
 
     // append new entry at the end (the size only grows up to capacity)
     if (m_serviceDescriptions.emplace_back())
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
+        return static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
+    }
+
+    return NO_INDEX;
+}
+
+expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
+                                                      ReferenceCounter_t ServiceDescriptionEntry::*count)
+{
+    auto index = findIndex(serviceDescription);
+    if (index != NO_INDEX)
+    {
+        // multiple entries with the same service descripion are possible
+        // and we just increase the count in this case (multi-set semantics)
+        // entry exists, increment counter
+        auto& entry = m_serviceDescriptions[index];
+        ((*entry).*count)++;
+        ++m_generation;
+        return success<>();
+    }
+
+    // entry does not exist, find a free slot if it exists
+    index = acquireFreeIndex();
+    if (index != NO_INDEX)
+    {
+        emplaceAt(index, serviceDescription, count);
+        ++m_generation;
         return success<>();
     }
 
@@ -99,10 +235,9 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                resetAt(index);
             }
+            ++m_generation;
         }
     }
 }
@@ -118,10 +253,9 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                resetAt(index);
             }
+            ++m_generation;
         }
     }
 }
@@ -131,10 +265,8 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        resetAt(index);
+        ++m_generation;
     }
 }
 
@@ -143,25 +275,55 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    // use the most specific index which is available for the search
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+    }
+    else if (service)
+    {
+        findInIndex(m_serviceIndex, *service, service, instance, event, callable);
+    }
+    else if (instance)
+    {
+        findInIndex(m_instanceIndex, *instance, service, instance, event, callable);
+    }
+    else if (event)
+    {
+        findInIndex(m_eventIndex, *event, service, instance, event, callable);
+    }
+    else
+    {
+        forEach(callable);
+    }
+}
 
-            if (match)
-            {
-                callable(*entry);
-            }
+void ServiceRegistry::findInIndex(const HashIndex& index,
+                                  const capro::IdString_t& key,
+                                  const optional<capro::IdString_t>& service,
+                                  const optional<capro::IdString_t>& instance,
+                                  const optional<capro::IdString_t>& event,
+                                  function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    for (auto i = index.first(capro::IdStringHash()(key)); i != NO_INDEX; i = index.next(i))
+    {
+        // the chain can contain entries with a colliding hash
+        auto& entry = m_serviceDescriptions[i];
+        if (entry && isMatching(entry->serviceDescription, service, instance, event))
+        {
+            callable(*entry);
         }
     }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    for (auto i = m_serviceDescriptionIndex.first(capro::ServiceDescriptionHash()(serviceDescription)); i != NO_INDEX;
+         i = m_serviceDescriptionIndex.next(i))
     {
         auto& entry = m_serviceDescriptions[i];
         if (entry && entry->serviceDescription == serviceDescription)
@@ -183,5 +345,59 @@ void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)>
     }
 }
 
+uint64_t ServiceRegistry::generation() const noexcept
+{
+    return m_generation;
+}
+
+bool ServiceRegistry::apply(const ServiceRegistryDelta& delta) noexcept
+{
+    if (delta.generation <= m_generation)
+    {
+        // the change is already contained, e.g. in the snapshot this registry was copied from
+        return true;
+    }
+    if (delta.generation != m_generation + 1U)
+    {
+        return false;
+    }
+
+    const auto& serviceDescription = delta.entry.serviceDescription;
+    auto index = findIndex(serviceDescription);
+    if (delta.entry.publisherCount == 0U && delta.entry.serverCount == 0U)
+    {
+        if (index != NO_INDEX)
+        {
+            resetAt(index);
+        }
+    }
+    else
+    {
+        if (index == NO_INDEX)
+        {
+            index = acquireFreeIndex();
+            if (index == NO_INDEX)
+            {
+                // cannot happen since the registry which created the delta has the same capacity
+                return false;
+            }
+            emplaceAt(index, serviceDescription, &ServiceDescriptionEntry::publisherCount);
+        }
+        auto& entry = m_serviceDescriptions[index];
+        entry->publisherCount = delta.entry.publisherCount;
+        entry->serverCount = delta.entry.serverCount;
+    }
+
+    m_generation = delta.generation;
+    return true;
+}
+
+ServiceRegistryDelta::ServiceRegistryDelta(const uint64_t generation,
+                                           const ServiceRegistry::ServiceDescriptionEntry& entry) noexcept
+    : generation(generation)
+    , entry(entry)
+{
+}
+
 } // namespace roudi
 } // namespace iox
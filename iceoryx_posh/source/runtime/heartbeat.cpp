@@ -0,0 +1,52 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+
+#include <chrono>
+
+namespace iox
+{
+namespace runtime
+{
+Heartbeat::Heartbeat() noexcept
+    : m_timestampOfLastBeat(millisecondsSinceEpoch())
+{
+}
+
+void Heartbeat::beat() noexcept
+{
+    m_timestampOfLastBeat.store(millisecondsSinceEpoch(), std::memory_order_relaxed);
+}
+
+uint64_t Heartbeat::elapsedMillisecondsSinceLastBeat() const noexcept
+{
+    // the last beat is loaded before the current time is taken; a beat after this load therefore never leads to an
+    // underflow
+    auto timestampOfLastBeat = m_timestampOfLastBeat.load(std::memory_order_relaxed);
+    auto now = millisecondsSinceEpoch();
+    return (now > timestampOfLastBeat) ? now - timestampOfLastBeat : 0U;
+}
+
+uint64_t Heartbeat::millisecondsSinceEpoch() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+} // namespace runtime
+} // namespace iox
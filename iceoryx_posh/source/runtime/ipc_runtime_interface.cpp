@@ -145,13 +145,6 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     }
 }
 
-bool IpcRuntimeInterface::sendKeepalive() noexcept
-{
-    return (m_sendKeepalive) ? m_RoudiIpcInterface.send(
-               {IpcMessageTypeToString(IpcMessageType::KEEPALIVE), into<std::string>(m_runtimeName)})
-                             : true;
-}
-
 UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOffset() const noexcept
 {
     cxx::Ensures(m_segmentManagerAddressOffset.has_value()
@@ -159,6 +152,11 @@ UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOf
     return m_segmentManagerAddressOffset.value();
 }
 
+optional<UntypedRelativePointer::offset_t> IpcRuntimeInterface::getHeartbeatAddressOffset() const noexcept
+{
+    return m_heartbeatAddressOffset;
+}
+
 bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     if (!m_RoudiIpcInterface.send(msg))
@@ -226,7 +224,7 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -241,7 +239,14 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 int64_t receivedTimestamp{0U};
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+                bool isMonitored{false};
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), isMonitored);
+                if (isMonitored)
+                {
+                    UntypedRelativePointer::offset_t heartbeatOffset{0U};
+                    cxx::convert::fromString(receiveBuffer.getElementAtIndex(6U).c_str(), heartbeatOffset);
+                    m_heartbeatAddressOffset.emplace(heartbeatOffset);
+                }
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
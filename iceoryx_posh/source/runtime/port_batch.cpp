@@ -0,0 +1,98 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortBatch& PortBatch::addPublisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({PortType::PUBLISHER,
+                service,
+                Options_t(in_place_type<popo::PublisherOptions>(), publisherOptions),
+                portConfigInfo});
+}
+
+PortBatch& PortBatch::addSubscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add({PortType::SUBSCRIBER,
+                service,
+                Options_t(in_place_type<popo::SubscriberOptions>(), subscriberOptions),
+                portConfigInfo});
+}
+
+PortBatch& PortBatch::addClient(const capro::ServiceDescription& service,
+                                const popo::ClientOptions& clientOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add(
+        {PortType::CLIENT, service, Options_t(in_place_type<popo::ClientOptions>(), clientOptions), portConfigInfo});
+}
+
+PortBatch& PortBatch::addServer(const capro::ServiceDescription& service,
+                                const popo::ServerOptions& serverOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept
+{
+    return add(
+        {PortType::SERVER, service, Options_t(in_place_type<popo::ServerOptions>(), serverOptions), portConfigInfo});
+}
+
+PortBatch& PortBatch::addConditionVariables(const uint64_t count) noexcept
+{
+    for (uint64_t i = 0U; i < count; ++i)
+    {
+        add({PortType::CONDITION_VARIABLE, {}, {}, {}});
+    }
+    return *this;
+}
+
+const PortBatch::Entries_t& PortBatch::entries() const noexcept
+{
+    return m_entries;
+}
+
+uint64_t PortBatch::size() const noexcept
+{
+    return m_entries.size();
+}
+
+bool PortBatch::empty() const noexcept
+{
+    return m_entries.empty();
+}
+
+PortBatch& PortBatch::add(Entry&& entry) noexcept
+{
+    if (m_entries.size() == m_entries.capacity())
+    {
+        // the port is not lost, it is requested from RouDi when it is created
+        IOX_LOG(WARN) << "The port batch is full, a port with service description '" << entry.service
+                      << "' is not created with the batch.";
+        return *this;
+    }
+    m_entries.emplace_back(std::move(entry));
+    return *this;
+}
+
+} // namespace runtime
+} // namespace iox
@@ -31,6 +31,58 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+// a pre-created port is only handed out when it has the same options as a port which is created with a request
+bool hasOptions(const PublisherPortUserType::MemberType_t& port,
+                const popo::PublisherOptions& options,
+                const RuntimeName_t& runtimeName) noexcept
+{
+    const auto& portOptions = port.m_options;
+    // the publisher options are sent unmodified to RouDi while the manifest uses the runtime name as default node name
+    const bool hasNodeName = portOptions.nodeName == options.nodeName
+                             || (options.nodeName.empty() && portOptions.nodeName == runtimeName);
+    return hasNodeName && portOptions.historyCapacity == options.historyCapacity
+           && portOptions.offerOnCreate == options.offerOnCreate
+           && portOptions.subscriberTooSlowPolicy == options.subscriberTooSlowPolicy
+           && portOptions.publishTimestamp == options.publishTimestamp;
+}
+
+bool hasOptions(const SubscriberPortUserType::MemberType_t& port, const popo::SubscriberOptions& options) noexcept
+{
+    const auto& portOptions = port.m_options;
+    return portOptions.queueCapacity == options.queueCapacity && portOptions.historyRequest == options.historyRequest
+           && portOptions.nodeName == options.nodeName && portOptions.subscribeOnCreate == options.subscribeOnCreate
+           && portOptions.queueFullPolicy == options.queueFullPolicy
+           && portOptions.requiresPublisherHistorySupport == options.requiresPublisherHistorySupport
+           && portOptions.userHeaderFilter == options.userHeaderFilter
+           && portOptions.decimationFactor == options.decimationFactor
+           && portOptions.minimumDeliveryInterval == options.minimumDeliveryInterval;
+}
+
+bool hasOptions(const popo::ClientPortUser::MemberType_t& port, const popo::ClientOptions& options) noexcept
+{
+    popo::ClientOptions portOptions;
+    portOptions.responseQueueCapacity = port.m_chunkReceiverData.m_queue.capacity();
+    portOptions.nodeName = port.m_nodeName;
+    portOptions.connectOnCreate = port.m_connectRequested.load(std::memory_order_relaxed);
+    portOptions.responseQueueFullPolicy = port.m_chunkReceiverData.m_queueFullPolicy;
+    portOptions.serverTooSlowPolicy = port.m_chunkSenderData.m_consumerTooSlowPolicy;
+    return portOptions == options;
+}
+
+bool hasOptions(const popo::ServerPortUser::MemberType_t& port, const popo::ServerOptions& options) noexcept
+{
+    popo::ServerOptions portOptions;
+    portOptions.requestQueueCapacity = port.m_chunkReceiverData.m_queue.capacity();
+    portOptions.nodeName = port.m_nodeName;
+    portOptions.offerOnCreate = port.m_offeringRequested.load(std::memory_order_relaxed);
+    portOptions.requestQueueFullPolicy = port.m_chunkReceiverData.m_queueFullPolicy;
+    portOptions.clientTooSlowPolicy = port.m_chunkSenderData.m_consumerTooSlowPolicy;
+    return portOptions == options;
+}
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const RuntimeLocation location) noexcept
     : PoshRuntime(name)
     , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME, *name.value(), runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
@@ -44,6 +96,15 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const Runt
                                                  m_ipcChannelInterface.getSegmentId(),
                                                  m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
+    , m_heartbeat([&]() -> Heartbeat* {
+        auto heartbeatAddressOffset = m_ipcChannelInterface.getHeartbeatAddressOffset();
+        if (!heartbeatAddressOffset.has_value())
+        {
+            return nullptr;
+        }
+        return RelativePointer<Heartbeat>::getPtr(segment_id_t{m_ipcChannelInterface.getSegmentId()},
+                                                  heartbeatAddressOffset.value());
+    }())
 {
 }
 
@@ -75,11 +136,37 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
+template <typename PortData, uint64_t Capacity, typename OptionsPredicate>
+PortData* PoshRuntimeImpl::takePreCreatedPort(vector<PortData*, Capacity>& preCreatedPorts,
+                                              const capro::ServiceDescription& service,
+                                              const OptionsPredicate& hasRequestedOptions) noexcept
+{
+    std::lock_guard<posix::mutex> lock(m_preCreatedPortsMutex);
+    for (auto iter = preCreatedPorts.begin(); iter != preCreatedPorts.end(); ++iter)
+    {
+        auto port = *iter;
+        if (port->m_serviceDescription == service && hasRequestedOptions(*port))
+        {
+            preCreatedPorts.erase(iter);
+            return port;
+        }
+    }
+    return nullptr;
+}
+
 PublisherPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
 {
+    auto preCreatedPublisher = takePreCreatedPort(m_preCreatedPublishers, service, [&](const auto& port) {
+        return hasOptions(port, publisherOptions, m_appName);
+    });
+    if (preCreatedPublisher != nullptr)
+    {
+        return preCreatedPublisher;
+    }
+
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
 
@@ -193,33 +280,13 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+    auto options = adjustSubscriberOptions(service, subscriberOptions);
 
-    auto options = subscriberOptions;
-    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested queue capacity " << options.queueCapacity
-                      << " exceeds the maximum possible one for this subscriber"
-                      << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.queueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (0U == options.queueCapacity)
-    {
-        IOX_LOG(WARN) << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.queueCapacity = 1U;
-    }
-
-    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
-    {
-        IOX_LOG(WARN) << "Requested historyRequest for " << service
-                      << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
-        options.historyRequest = subscriberOptions.queueCapacity;
-    }
-
-    if (options.nodeName.empty())
+    auto preCreatedSubscriber = takePreCreatedPort(
+        m_preCreatedSubscribers, service, [&](const auto& port) { return hasOptions(port, options); });
+    if (preCreatedSubscriber != nullptr)
     {
-        options.nodeName = m_appName;
+        return preCreatedSubscriber;
     }
 
     IpcMessage sendBuffer;
@@ -303,20 +370,13 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = clientOptions;
-    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested response queue capacity " << options.responseQueueCapacity
-                      << " exceeds the maximum possible one for this client"
-                      << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.responseQueueCapacity == 0U)
+    auto options = adjustClientOptions(clientOptions);
+
+    auto preCreatedClient = takePreCreatedPort(
+        m_preCreatedClients, service, [&](const auto& port) { return hasOptions(port, options); });
+    if (preCreatedClient != nullptr)
     {
-        IOX_LOG(WARN) << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.responseQueueCapacity = 1U;
+        return preCreatedClient;
     }
 
     IpcMessage sendBuffer;
@@ -407,20 +467,13 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
                                                                          const popo::ServerOptions& serverOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = serverOptions;
-    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN) << "Requested request queue capacity " << options.requestQueueCapacity
-                      << " exceeds the maximum possible one for this server"
-                      << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.requestQueueCapacity == 0U)
+    auto options = adjustServerOptions(serverOptions);
+
+    auto preCreatedServer = takePreCreatedPort(
+        m_preCreatedServers, service, [&](const auto& port) { return hasOptions(port, options); });
+    if (preCreatedServer != nullptr)
     {
-        IOX_LOG(WARN) << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
-                      << " the capacity is set to 1";
-        options.requestQueueCapacity = 1U;
+        return preCreatedServer;
     }
 
     IpcMessage sendBuffer;
@@ -616,6 +669,16 @@ PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer)
 
 popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
 {
+    {
+        std::lock_guard<posix::mutex> lock(m_preCreatedPortsMutex);
+        if (!m_preCreatedConditionVariables.empty())
+        {
+            auto conditionVariable = m_preCreatedConditionVariables.back();
+            m_preCreatedConditionVariables.pop_back();
+            return conditionVariable;
+        }
+    }
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
 
@@ -649,6 +712,277 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+uint64_t PoshRuntimeImpl::claimManifestPorts() noexcept
+{
+    constexpr uint32_t NUMBER_OF_HEADER_ELEMENTS{4U};
+    uint64_t numberOfClaimedPorts{0U};
+    bool hasMore{true};
+    while (hasMore)
+    {
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CLAIM_MANIFEST_PORTS) << m_appName;
+
+        IpcMessage receiveBuffer;
+        if (!sendRequestToRouDi(sendBuffer, receiveBuffer)
+            || receiveBuffer.getNumberOfElements() < NUMBER_OF_HEADER_ELEMENTS
+            || stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+                   != IpcMessageType::CLAIM_MANIFEST_PORTS_ACK)
+        {
+            IOX_LOG(ERROR) << "Claiming the ports of the manifest got wrong response from IPC channel :'"
+                           << receiveBuffer.getMessage() << "'";
+            break;
+        }
+
+        segment_id_underlying_t segmentId{0U};
+        uint64_t numberOfPublishers{0U};
+        hasMore = false;
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), segmentId);
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), hasMore);
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), numberOfPublishers);
+
+        std::lock_guard<posix::mutex> lock(m_preCreatedPortsMutex);
+        for (uint32_t i = NUMBER_OF_HEADER_ELEMENTS; i < receiveBuffer.getNumberOfElements(); ++i)
+        {
+            UntypedRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(i).c_str(), offset);
+            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
+            if (i - NUMBER_OF_HEADER_ELEMENTS < numberOfPublishers)
+            {
+                m_preCreatedPublishers.emplace_back(reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr));
+            }
+            else
+            {
+                m_preCreatedSubscribers.emplace_back(
+                    reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr));
+            }
+            ++numberOfClaimedPorts;
+        }
+    }
+
+    IOX_LOG(DEBUG) << "Claimed " << numberOfClaimedPorts << " ports of the manifest";
+    return numberOfClaimedPorts;
+}
+
+uint64_t PoshRuntimeImpl::createPorts(const PortBatch& portBatch) noexcept
+{
+    const auto& entries = portBatch.entries();
+    uint64_t numberOfCreatedPorts{0U};
+    uint64_t nextEntry{0U};
+    while (nextEntry < entries.size())
+    {
+        // put as many ports into one request as fit into a message and its response
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+        const uint64_t firstEntry{nextEntry};
+        while (nextEntry < entries.size() && nextEntry - firstEntry < MAX_CREATED_PORTS_PER_MESSAGE)
+        {
+            auto port = serializePortOfBatch(entries[nextEntry]);
+            if (sendBuffer.getMessage().size() + port.getMessage().size()
+                    + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE
+                > APP_MESSAGE_SIZE)
+            {
+                break;
+            }
+            for (uint32_t i = 0U; i < port.getNumberOfElements(); ++i)
+            {
+                sendBuffer << port.getElementAtIndex(i);
+            }
+            ++nextEntry;
+        }
+
+        if (nextEntry == firstEntry)
+        {
+            IOX_LOG(WARN) << "The port with service description '" << entries[nextEntry].service
+                          << "' exceeds the message size and is not created with the batch.";
+            ++nextEntry;
+            continue;
+        }
+
+        numberOfCreatedPorts += requestPortsOfBatchFromRoudi(sendBuffer, entries, firstEntry, nextEntry - firstEntry);
+    }
+
+    IOX_LOG(DEBUG) << "Created " << numberOfCreatedPorts << " of " << entries.size() << " ports of the batch";
+    return numberOfCreatedPorts;
+}
+
+uint64_t PoshRuntimeImpl::requestPortsOfBatchFromRoudi(const IpcMessage& sendBuffer,
+                                                       const PortBatch::Entries_t& entries,
+                                                       const uint64_t firstEntry,
+                                                       const uint64_t numberOfEntries) noexcept
+{
+    // the header is followed by the success flag and either the offset of the port or the error for each port
+    constexpr uint32_t NUMBER_OF_HEADER_ELEMENTS{2U};
+    constexpr uint32_t NUMBER_OF_ELEMENTS_PER_PORT{2U};
+
+    const uint64_t numberOfResponseElements{NUMBER_OF_HEADER_ELEMENTS + NUMBER_OF_ELEMENTS_PER_PORT * numberOfEntries};
+
+    IpcMessage receiveBuffer;
+    if (!sendRequestToRouDi(sendBuffer, receiveBuffer)
+        || receiveBuffer.getNumberOfElements() != numberOfResponseElements
+        || stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str()) != IpcMessageType::CREATE_PORTS_ACK)
+    {
+        IOX_LOG(ERROR) << "Request of a port batch got wrong response from IPC channel :'"
+                       << receiveBuffer.getMessage() << "'";
+        return 0U;
+    }
+
+    segment_id_underlying_t segmentId{0U};
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), segmentId);
+
+    uint64_t numberOfCreatedPorts{0U};
+    std::lock_guard<posix::mutex> lock(m_preCreatedPortsMutex);
+    for (uint64_t i = 0U; i < numberOfEntries; ++i)
+    {
+        const auto& entry = entries[firstEntry + i];
+        const auto resultIndex = static_cast<uint32_t>(NUMBER_OF_HEADER_ELEMENTS + NUMBER_OF_ELEMENTS_PER_PORT * i);
+        bool isCreated{false};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(resultIndex).c_str(), isCreated);
+        if (!isCreated)
+        {
+            IOX_LOG(WARN) << "The port with service description '" << entry.service
+                          << "' of the batch could not be created, error: "
+                          << receiveBuffer.getElementAtIndex(resultIndex + 1U)
+                          << "; it is requested again when it is created.";
+            continue;
+        }
+
+        UntypedRelativePointer::offset_t offset{0U};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(resultIndex + 1U).c_str(), offset);
+        auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
+        switch (entry.portType)
+        {
+        case PortBatch::PortType::PUBLISHER:
+            m_preCreatedPublishers.emplace_back(reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr));
+            break;
+        case PortBatch::PortType::SUBSCRIBER:
+            m_preCreatedSubscribers.emplace_back(reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr));
+            break;
+        case PortBatch::PortType::CLIENT:
+            m_preCreatedClients.emplace_back(reinterpret_cast<popo::ClientPortUser::MemberType_t*>(ptr));
+            break;
+        case PortBatch::PortType::SERVER:
+            m_preCreatedServers.emplace_back(reinterpret_cast<popo::ServerPortUser::MemberType_t*>(ptr));
+            break;
+        case PortBatch::PortType::CONDITION_VARIABLE:
+            m_preCreatedConditionVariables.emplace_back(reinterpret_cast<popo::ConditionVariableData*>(ptr));
+            break;
+        }
+        ++numberOfCreatedPorts;
+    }
+    return numberOfCreatedPorts;
+}
+
+IpcMessage PoshRuntimeImpl::serializePortOfBatch(const PortBatch::Entry& entry) const noexcept
+{
+    IpcMessage port;
+    port << cxx::convert::toString(static_cast<std::underlying_type<PortBatch::PortType>::type>(entry.portType));
+
+    switch (entry.portType)
+    {
+    case PortBatch::PortType::PUBLISHER:
+        port << static_cast<cxx::Serialization>(entry.service).toString()
+             << entry.options.get<popo::PublisherOptions>()->serialize().toString();
+        break;
+    case PortBatch::PortType::SUBSCRIBER:
+        port << static_cast<cxx::Serialization>(entry.service).toString()
+             << adjustSubscriberOptions(entry.service, *entry.options.get<popo::SubscriberOptions>())
+                    .serialize()
+                    .toString();
+        break;
+    case PortBatch::PortType::CLIENT:
+        port << static_cast<cxx::Serialization>(entry.service).toString()
+             << adjustClientOptions(*entry.options.get<popo::ClientOptions>()).serialize().toString();
+        break;
+    case PortBatch::PortType::SERVER:
+        port << static_cast<cxx::Serialization>(entry.service).toString()
+             << adjustServerOptions(*entry.options.get<popo::ServerOptions>()).serialize().toString();
+        break;
+    case PortBatch::PortType::CONDITION_VARIABLE:
+        // a condition variable has no further properties
+        return port;
+    }
+    port << static_cast<cxx::Serialization>(entry.portConfigInfo).toString();
+    return port;
+}
+
+popo::SubscriberOptions
+PoshRuntimeImpl::adjustSubscriberOptions(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = subscriberOptions;
+    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested queue capacity " << options.queueCapacity
+                      << " exceeds the maximum possible one for this subscriber"
+                      << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.queueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.queueCapacity)
+    {
+        IOX_LOG(WARN) << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.queueCapacity = 1U;
+    }
+
+    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
+    {
+        IOX_LOG(WARN) << "Requested historyRequest for " << service
+                      << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
+        options.historyRequest = subscriberOptions.queueCapacity;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    return options;
+}
+
+popo::ClientOptions PoshRuntimeImpl::adjustClientOptions(const popo::ClientOptions& clientOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested response queue capacity " << options.responseQueueCapacity
+                      << " exceeds the maximum possible one for this client"
+                      << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.responseQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN) << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.responseQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
+popo::ServerOptions PoshRuntimeImpl::adjustServerOptions(const popo::ServerOptions& serverOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested request queue capacity " << options.requestQueueCapacity
+                      << " exceeds the maximum possible one for this server"
+                      << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.requestQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN) << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                      << " the capacity is set to 1";
+        options.requestQueueCapacity = 1U;
+    }
+
+    return options;
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     // runtime must be thread safe
@@ -656,12 +990,12 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
 }
 
-// this is the callback for the m_keepAliveTimer
-void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
+// this is the callback for the m_keepAliveTask
+void PoshRuntimeImpl::beatHeartbeatAndHandleShutdownPreparation() noexcept
 {
-    if (!m_ipcChannelInterface.sendKeepalive())
+    if (m_heartbeat != nullptr)
     {
-        IOX_LOG(WARN) << "Error in sending keep alive";
+        m_heartbeat->beat();
     }
 
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
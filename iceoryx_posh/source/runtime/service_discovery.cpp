@@ -29,9 +29,24 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
-    });
+
+    // the snapshot is held until the deltas are processed but only copied if the deltas cannot be applied
+    optional<popo::Sample<const roudi::ServiceRegistry>> snapshot;
+    m_serviceRegistrySubscriber.take().and_then(
+        [&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
+            snapshot.emplace(std::move(serviceRegistrySample));
+        });
+
+    m_serviceRegistry.update(snapshot.has_value() ? snapshot->get() : nullptr,
+                             [&](const ServiceRegistryMirror::DeltaCallback_t& applyDelta) {
+                                 bool hasDelta{false};
+                                 m_serviceRegistryDeltaSubscriber.take().and_then(
+                                     [&](popo::Sample<const roudi::ServiceRegistryDelta>& delta) {
+                                         hasDelta = true;
+                                         applyDelta(*delta);
+                                     });
+                                 return hasDelta;
+                             });
 }
 
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
@@ -46,7 +61,7 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
     {
     case popo::MessagingPattern::PUB_SUB:
     {
-        m_serviceRegistry->find(
+        m_serviceRegistry.registry().find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.publisherCount > 0)
                 {
@@ -57,7 +72,7 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
     }
     case popo::MessagingPattern::REQ_RES:
     {
-        m_serviceRegistry->find(
+        m_serviceRegistry.registry().find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.serverCount > 0)
                 {
@@ -80,7 +95,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +112,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +125,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryDeltaSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryDeltaSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -0,0 +1,68 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/service_registry_mirror.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+void ServiceRegistryMirror::update(const roudi::ServiceRegistry* const snapshot, const TakeDelta_t& takeDelta) noexcept
+{
+    if (!m_isSynchronized)
+    {
+        synchronize(snapshot);
+    }
+
+    auto applyDelta = [&](const roudi::ServiceRegistryDelta& delta) {
+        // without a snapshot the deltas are discarded, the next snapshot contains them
+        if (m_isSynchronized && !m_registry->apply(delta))
+        {
+            // a delta was lost; the snapshot can only be used if it already contains the lost delta
+            m_isSynchronized = false;
+            synchronize(snapshot);
+            m_isSynchronized = m_isSynchronized && m_registry->apply(delta);
+        }
+    };
+
+    bool hasDelta{true};
+    while (hasDelta)
+    {
+        hasDelta = takeDelta(applyDelta);
+    }
+}
+
+void ServiceRegistryMirror::synchronize(const roudi::ServiceRegistry* const snapshot) noexcept
+{
+    if (snapshot != nullptr && snapshot->generation() >= m_registry->generation())
+    {
+        *m_registry = *snapshot;
+        m_isSynchronized = true;
+    }
+}
+
+bool ServiceRegistryMirror::isSynchronized() const noexcept
+{
+    return m_isSynchronized;
+}
+
+const roudi::ServiceRegistry& ServiceRegistryMirror::registry() const noexcept
+{
+    return *m_registry;
+}
+
+} // namespace runtime
+} // namespace iox
@@ -0,0 +1,495 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/untyped_client_impl.hpp"
+#include "iceoryx_posh/internal/popo/untyped_server_impl.hpp"
+#include "iceoryx_posh/internal/popo/untyped_subscriber_impl.hpp"
+#include "iceoryx_posh/popo/coroutine_executor.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "iceoryx_posh/testing/mocks/posh_runtime_mock.hpp"
+#include "mocks/client_mock.hpp"
+#include "mocks/server_mock.hpp"
+#include "mocks/subscriber_mock.hpp"
+#include "test.hpp"
+
+#include <deque>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+enum class FakePortState : StateEnumIdentifier
+{
+    HAS_DATA
+};
+
+class FakePort
+{
+  public:
+    iox::expected<uint64_t, ChunkReceiveResult> take() noexcept
+    {
+        if (m_error)
+        {
+            return iox::error<ChunkReceiveResult>(*m_error);
+        }
+        if (m_data.empty())
+        {
+            return iox::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+        }
+        const auto value = m_data.front();
+        m_data.pop_front();
+        return iox::success<uint64_t>(value);
+    }
+
+    void push(const uint64_t value) noexcept
+    {
+        m_data.push_back(value);
+        m_stateHandle.trigger();
+    }
+
+    void enableState(TriggerHandle&& handle, const FakePortState) noexcept
+    {
+        m_stateHandle = std::move(handle);
+    }
+
+    void disableState(const FakePortState) noexcept
+    {
+        m_stateHandle.reset();
+    }
+
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+    {
+        if (m_stateHandle.getUniqueId() == uniqueTriggerId)
+        {
+            m_stateHandle.invalidate();
+        }
+    }
+
+    WaitSetIsConditionSatisfiedCallback getCallbackForIsStateConditionSatisfied(const FakePortState) const noexcept
+    {
+        return WaitSetIsConditionSatisfiedCallback(iox::in_place, *this, &FakePort::hasData);
+    }
+
+    bool hasData() const noexcept
+    {
+        return !m_data.empty();
+    }
+
+    bool isAttached() const noexcept
+    {
+        return m_stateHandle.isValid();
+    }
+
+    std::deque<uint64_t> m_data;
+    iox::optional<ChunkReceiveResult> m_error;
+    TriggerHandle m_stateHandle;
+};
+
+template <uint64_t Capacity>
+class TestCoroutineExecutor : public CoroutineExecutor<Capacity>
+{
+  public:
+    explicit TestCoroutineExecutor(ConditionVariableData& condVarData) noexcept
+        : CoroutineExecutor<Capacity>(condVarData)
+    {
+    }
+};
+
+template <uint64_t Capacity>
+CoroutineTask consume(CoroutineExecutor<Capacity>& executor,
+                      FakePort& port,
+                      const uint64_t numberOfValues,
+                      std::vector<uint64_t>& receivedValues)
+{
+    for (uint64_t i = 0U; i < numberOfValues; ++i)
+    {
+        auto value = co_await executor.take(port, FakePortState::HAS_DATA);
+        EXPECT_FALSE(value.has_error());
+        receivedValues.emplace_back(value.value());
+    }
+}
+
+CoroutineTask produce(FakePort& port, const uint64_t value)
+{
+    port.push(value);
+    co_return;
+}
+
+template <uint64_t Capacity, typename Port, typename Result>
+CoroutineTask takeOnce(CoroutineExecutor<Capacity>& executor, Port& port, iox::optional<Result>& result)
+{
+    result.emplace(co_await executor.take(port));
+}
+
+/// @brief Stands in for the counterpart of a mocked port which delivers data and notifies the condition variable
+class MockPortNotifier
+{
+  public:
+    void setConditionVariable(ConditionVariableData& condVarData, const uint64_t notificationIndex) noexcept
+    {
+        m_condVarData = &condVarData;
+        m_notificationIndex = notificationIndex;
+    }
+
+    void unsetConditionVariable() noexcept
+    {
+        m_condVarData = nullptr;
+    }
+
+    void deliver() noexcept
+    {
+        m_hasNewData = true;
+        EXPECT_THAT(m_condVarData, Ne(nullptr));
+        if (m_condVarData != nullptr)
+        {
+            ConditionNotifier(*m_condVarData, m_notificationIndex).notify();
+        }
+    }
+
+    bool isAttached() const noexcept
+    {
+        return m_condVarData != nullptr;
+    }
+
+    ConditionVariableData* m_condVarData{nullptr};
+    uint64_t m_notificationIndex{0U};
+    bool m_hasNewData{false};
+};
+
+CoroutineTask deliver(MockPortNotifier& notifier)
+{
+    notifier.deliver();
+    co_return;
+}
+
+class CoroutineExecutor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    static constexpr uint64_t CAPACITY{8U};
+
+    ConditionVariableData m_condVarData{"Schlummerle"};
+    TestCoroutineExecutor<CAPACITY> m_sut{m_condVarData};
+    std::vector<uint64_t> m_receivedValues;
+
+    Watchdog m_watchdog{2_s};
+};
+
+TEST_F(CoroutineExecutor_test, RunExecutesSpawnedTasksUntilTheyFinished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3fe4094f-adc4-4f56-bd0b-25fd6f01d738");
+    FakePort port;
+    ASSERT_FALSE(m_sut.spawn(produce(port, 42U)).has_error());
+    EXPECT_THAT(m_sut.numberOfTasks(), Eq(1U));
+    EXPECT_FALSE(port.hasData());
+
+    m_sut.run();
+
+    EXPECT_THAT(m_sut.numberOfTasks(), Eq(0U));
+    ASSERT_THAT(port.m_data.size(), Eq(1U));
+    EXPECT_THAT(port.m_data.front(), Eq(42U));
+}
+
+TEST_F(CoroutineExecutor_test, AwaitingAvailableDataDoesNotSuspendTheTask)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "986c6789-babf-4afe-93f2-a7c1f665e5c1");
+    FakePort port;
+    port.push(7U);
+    port.push(13U);
+    ASSERT_FALSE(m_sut.spawn(consume(m_sut, port, 2U, m_receivedValues)).has_error());
+
+    m_sut.run();
+
+    EXPECT_THAT(m_receivedValues, ElementsAre(7U, 13U));
+    EXPECT_FALSE(port.isAttached());
+}
+
+TEST_F(CoroutineExecutor_test, SuspendedTaskIsResumedWhenDataArrives)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce125731-d2b6-4900-b164-deaa5bc57f2a");
+    FakePort port;
+    ASSERT_FALSE(m_sut.spawn(consume(m_sut, port, 1U, m_receivedValues)).has_error());
+    ASSERT_FALSE(m_sut.spawn(produce(port, 73U)).has_error());
+
+    m_sut.run();
+
+    EXPECT_THAT(m_receivedValues, ElementsAre(73U));
+    EXPECT_THAT(m_sut.numberOfTasks(), Eq(0U));
+    EXPECT_FALSE(port.isAttached());
+}
+
+TEST_F(CoroutineExecutor_test, ManyTasksAreMultiplexedOnOneThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f73b026f-452f-42fb-a56c-00e16730225e");
+    constexpr uint64_t NUMBER_OF_CONSUMERS{CAPACITY / 2U};
+    std::vector<FakePort> ports(NUMBER_OF_CONSUMERS);
+    std::vector<std::vector<uint64_t>> receivedValues(NUMBER_OF_CONSUMERS);
+    for (uint64_t i = 0U; i < NUMBER_OF_CONSUMERS; ++i)
+    {
+        ASSERT_FALSE(m_sut.spawn(consume(m_sut, ports[i], 1U, receivedValues[i])).has_error());
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_CONSUMERS; ++i)
+    {
+        ASSERT_FALSE(m_sut.spawn(produce(ports[NUMBER_OF_CONSUMERS - 1U - i], i)).has_error());
+    }
+
+    m_sut.run();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CONSUMERS; ++i)
+    {
+        EXPECT_THAT(receivedValues[i], ElementsAre(NUMBER_OF_CONSUMERS - 1U - i));
+    }
+}
+
+TEST_F(CoroutineExecutor_test, SpawnFailsWhenTheTaskCapacityIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1906da5-31a7-4932-a3c3-f90cf5994dc0");
+    FakePort port;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_FALSE(m_sut.spawn(produce(port, i)).has_error());
+    }
+
+    auto result = m_sut.spawn(produce(port, CAPACITY));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(CoroutineExecutorError::TASK_CAPACITY_EXCEEDED));
+    EXPECT_THAT(m_sut.numberOfTasks(), Eq(CAPACITY));
+}
+
+TEST_F(CoroutineExecutor_test, TakeErrorOtherThanNoDataResumesTheTaskWithTheError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a038d915-9da2-42ce-8237-612a0356dd24");
+    FakePort port;
+    port.m_error.emplace(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    iox::optional<ChunkReceiveResult> receivedError;
+    auto task = [](CoroutineExecutor<CAPACITY>& executor,
+                   FakePort& port,
+                   iox::optional<ChunkReceiveResult>& receivedError) -> CoroutineTask {
+        auto value = co_await executor.take(port, FakePortState::HAS_DATA);
+        if (value.has_error())
+        {
+            receivedError.emplace(value.get_error());
+        }
+    };
+    ASSERT_FALSE(m_sut.spawn(task(m_sut, port, receivedError)).has_error());
+
+    m_sut.run();
+
+    ASSERT_TRUE(receivedError.has_value());
+    EXPECT_THAT(*receivedError, Eq(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+}
+
+TEST_F(CoroutineExecutor_test, StopLetsRunReturnAndUnfinishedTasksAreDestroyedWithTheExecutor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f984a70-b79a-40f5-a64f-f040aae3302b");
+    FakePort port;
+    {
+        ConditionVariableData condVarData{"Schlafmuetze"};
+        TestCoroutineExecutor<CAPACITY> sut{condVarData};
+        auto stopper = [](CoroutineExecutor<CAPACITY>& executor) -> CoroutineTask {
+            executor.stop();
+            co_return;
+        };
+        ASSERT_FALSE(sut.spawn(consume(sut, port, 1U, m_receivedValues)).has_error());
+        ASSERT_FALSE(sut.spawn(stopper(sut)).has_error());
+
+        sut.run();
+
+        EXPECT_THAT(sut.numberOfTasks(), Eq(1U));
+        EXPECT_TRUE(port.isAttached());
+    }
+
+    EXPECT_FALSE(port.isAttached());
+    EXPECT_TRUE(m_receivedValues.empty());
+}
+
+template <typename Base>
+class WithMockPort : public Base
+{
+  public:
+    using Base::Base;
+    using Base::port;
+};
+
+using SubscriberWithMockPort = WithMockPort<UntypedSubscriberImpl<BaseSubscriber<MockSubscriberPortUser>>>;
+using ClientWithMockPort = WithMockPort<UntypedClientImpl<BaseClient<MockClientPortUser>>>;
+using ServerWithMockPort = WithMockPort<UntypedServerImpl<BaseServer<MockServerPortUser>>>;
+
+class CoroutineExecutorWithPorts_test : public CoroutineExecutor_test
+{
+  public:
+    void SetUp() override
+    {
+        CoroutineExecutor_test::SetUp();
+
+        EXPECT_CALL(*m_mockRuntime, getMiddlewareSubscriber(_, _, _)).WillRepeatedly(Return(&m_subscriberPortData));
+        EXPECT_CALL(*m_mockRuntime, getMiddlewareClient(_, _, _)).WillRepeatedly(Return(&m_clientPortData));
+        EXPECT_CALL(*m_mockRuntime, getMiddlewareServer(_, _, _)).WillRepeatedly(Return(&m_serverPortData));
+        m_subscriber.emplace(m_sd, SubscriberOptions());
+        m_client.emplace(m_sd, ClientOptions());
+        m_server.emplace(m_sd, ServerOptions());
+
+        EXPECT_CALL(m_subscriber->port(), setConditionVariable)
+            .WillRepeatedly([&](auto& condVarData, const auto notificationIndex) {
+                m_notifier.setConditionVariable(condVarData, notificationIndex);
+                return true;
+            });
+        EXPECT_CALL(m_subscriber->port(), unsetConditionVariable).WillRepeatedly([&] {
+            m_notifier.unsetConditionVariable();
+            return true;
+        });
+        EXPECT_CALL(m_subscriber->port(), hasNewChunks).WillRepeatedly([&] { return m_notifier.m_hasNewData; });
+        EXPECT_CALL(m_subscriber->port(), destroy).Times(1);
+
+        EXPECT_CALL(m_client->port(), setConditionVariable)
+            .WillRepeatedly([&](auto& condVarData, const auto notificationIndex) {
+                m_notifier.setConditionVariable(condVarData, notificationIndex);
+            });
+        EXPECT_CALL(m_client->port(), unsetConditionVariable).WillRepeatedly([&] {
+            m_notifier.unsetConditionVariable();
+        });
+        EXPECT_CALL(m_client->port(), hasNewResponses).WillRepeatedly([&] { return m_notifier.m_hasNewData; });
+        EXPECT_CALL(m_client->port(), destroy).Times(1);
+
+        EXPECT_CALL(m_server->port(), setConditionVariable)
+            .WillRepeatedly([&](auto& condVarData, const auto notificationIndex) {
+                m_notifier.setConditionVariable(condVarData, notificationIndex);
+            });
+        EXPECT_CALL(m_server->port(), unsetConditionVariable).WillRepeatedly([&] {
+            m_notifier.unsetConditionVariable();
+        });
+        EXPECT_CALL(m_server->port(), hasNewRequests).WillRepeatedly([&] { return m_notifier.m_hasNewData; });
+        EXPECT_CALL(m_server->port(), destroy).Times(1);
+    }
+
+    void TearDown() override
+    {
+        m_subscriber.reset();
+        m_client.reset();
+        m_server.reset();
+    }
+
+    iox::RuntimeName_t m_runtimeName{"Tausendfuessler"};
+    std::unique_ptr<PoshRuntimeMock> m_mockRuntime = PoshRuntimeMock::create(m_runtimeName);
+    iox::capro::ServiceDescription m_sd{"Schnecke", "Igel", "Maulwurf"};
+    iox::mepoo::MemoryManager m_memoryManager;
+    SubscriberPortData m_subscriberPortData{
+        m_sd, m_runtimeName, iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer, SubscriberOptions()};
+    ClientPortData m_clientPortData{m_sd, m_runtimeName, ClientOptions(), &m_memoryManager};
+    ServerPortData m_serverPortData{m_sd, m_runtimeName, ServerOptions(), &m_memoryManager};
+
+    iox::optional<SubscriberWithMockPort> m_subscriber;
+    iox::optional<ClientWithMockPort> m_client;
+    iox::optional<ServerWithMockPort> m_server;
+    MockPortNotifier m_notifier;
+};
+
+TEST_F(CoroutineExecutorWithPorts_test, TaskAwaitingSubscriberIsResumedWithTheSampleWhenTheSubscriberReceivesData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66e6d7f2-5555-436e-bc15-e79ac22dbf92");
+    ChunkMock<uint64_t> chunk;
+    const iox::expected<const iox::mepoo::ChunkHeader*, ChunkReceiveResult> noChunk =
+        iox::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    const iox::expected<const iox::mepoo::ChunkHeader*, ChunkReceiveResult> receivedChunk =
+        iox::success<const iox::mepoo::ChunkHeader*>(chunk.chunkHeader());
+    EXPECT_CALL(m_subscriber->port(), tryGetChunk).WillOnce(Return(noChunk)).WillOnce(Return(receivedChunk));
+
+    iox::optional<iox::expected<const void*, ChunkReceiveResult>> result;
+    ASSERT_FALSE(m_sut.spawn(takeOnce(m_sut, *m_subscriber, result)).has_error());
+    ASSERT_FALSE(m_sut.spawn(deliver(m_notifier)).has_error());
+
+    m_sut.run();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_FALSE(result->has_error());
+    EXPECT_THAT(result->value(), Eq(chunk.chunkHeader()->userPayload()));
+    EXPECT_FALSE(m_notifier.isAttached());
+}
+
+TEST_F(CoroutineExecutorWithPorts_test, TaskAwaitingClientIsResumedWithTheResponseWhenTheClientReceivesAResponse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d28ad14-0ee3-442d-9ac6-a2a54b138ca7");
+    ChunkMock<uint64_t, ResponseHeader> response;
+    const iox::expected<const ResponseHeader*, ChunkReceiveResult> noResponse =
+        iox::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    const iox::expected<const ResponseHeader*, ChunkReceiveResult> receivedResponse =
+        iox::success<const ResponseHeader*>(response.userHeader());
+    EXPECT_CALL(m_client->port(), getResponse).WillOnce(Return(noResponse)).WillOnce(Return(receivedResponse));
+
+    iox::optional<iox::expected<const void*, ChunkReceiveResult>> result;
+    ASSERT_FALSE(m_sut.spawn(takeOnce(m_sut, *m_client, result)).has_error());
+    ASSERT_FALSE(m_sut.spawn(deliver(m_notifier)).has_error());
+
+    m_sut.run();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_FALSE(result->has_error());
+    EXPECT_THAT(result->value(), Eq(response.sample()));
+    EXPECT_FALSE(m_notifier.isAttached());
+}
+
+TEST_F(CoroutineExecutorWithPorts_test, TaskAwaitingServerIsResumedWithTheRequestWhenTheServerReceivesARequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b1f7c85-4a5a-45d5-9aed-bfc1d3db5457");
+    ChunkMock<uint64_t, RequestHeader> request;
+    const iox::expected<const RequestHeader*, ServerRequestResult> noRequest =
+        iox::error<ServerRequestResult>(ServerRequestResult::NO_PENDING_REQUESTS);
+    const iox::expected<const RequestHeader*, ServerRequestResult> receivedRequest =
+        iox::success<const RequestHeader*>(request.userHeader());
+    EXPECT_CALL(m_server->port(), getRequest).WillOnce(Return(noRequest)).WillOnce(Return(receivedRequest));
+
+    iox::optional<iox::expected<const void*, ServerRequestResult>> result;
+    ASSERT_FALSE(m_sut.spawn(takeOnce(m_sut, *m_server, result)).has_error());
+    ASSERT_FALSE(m_sut.spawn(deliver(m_notifier)).has_error());
+
+    m_sut.run();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_FALSE(result->has_error());
+    EXPECT_THAT(result->value(), Eq(request.sample()));
+    EXPECT_FALSE(m_notifier.isAttached());
+}
+
+TEST_F(CoroutineExecutorWithPorts_test, TaskAwaitingServerWhichDoesNotOfferIsResumedWithTheErrorWithoutSuspending)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f90c0736-7739-4e7e-adeb-571e6354cb2e");
+    const iox::expected<const RequestHeader*, ServerRequestResult> notOffered =
+        iox::error<ServerRequestResult>(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER);
+    EXPECT_CALL(m_server->port(), getRequest).WillOnce(Return(notOffered));
+    EXPECT_CALL(m_server->port(), setConditionVariable).Times(0);
+
+    iox::optional<iox::expected<const void*, ServerRequestResult>> result;
+    ASSERT_FALSE(m_sut.spawn(takeOnce(m_sut, *m_server, result)).has_error());
+
+    m_sut.run();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(result->has_error());
+    EXPECT_THAT(result->get_error(), Eq(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER));
+    EXPECT_THAT(m_sut.numberOfTasks(), Eq(0U));
+}
+
+} // namespace
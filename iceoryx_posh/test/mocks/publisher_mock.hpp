@@ -59,6 +59,8 @@ class MockPublisherPortUser
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
+    MOCK_CONST_METHOD0(getSendIntervalHistogram, iox::popo::Histogram());
+    MOCK_METHOD1(setSendIntervalHistogramEnabled, void(const bool));
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
     MOCK_CONST_METHOD0(isOffered, bool());
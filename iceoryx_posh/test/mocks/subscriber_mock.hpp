@@ -56,9 +56,15 @@ class MockSubscriberPortUser
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
     MOCK_METHOD0(hasLostChunksSinceLastCall, bool());
+    MOCK_CONST_METHOD0(getLostChunksCount, uint64_t());
+    MOCK_CONST_METHOD0(getMaximumQueueFillLevel, uint64_t());
+    MOCK_CONST_METHOD0(getReceivedChunksCount, uint64_t());
     MOCK_METHOD2(setConditionVariable, bool(iox::popo::ConditionVariableData&, uint64_t));
     MOCK_METHOD0(isConditionVariableSet, bool());
     MOCK_METHOD0(unsetConditionVariable, bool());
+    MOCK_CONST_METHOD0(getLatencyHistogram, iox::popo::Histogram());
+    MOCK_CONST_METHOD0(getQueueDepthHistogram, iox::popo::Histogram());
+    MOCK_METHOD1(setQueueDepthHistogramEnabled, void(const bool));
     MOCK_METHOD0(destroy, void());
     MOCK_CONST_METHOD0(getUniqueID, iox::popo::UniquePortId());
 };
@@ -452,6 +452,26 @@ TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
     EXPECT_THAT(loggerMock.logs[0].message, StrEq(SERVICE_DESCRIPTION_AS_STRING));
 }
 
+TEST_F(ServiceDescription_test, HashOfEqualServiceDescriptionsIsEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd2a1c6b-1d3c-4d96-a0d5-b159677cb69d");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2(
+        "TestService", "TestInstance", "TestEvent", {5U, 6U, 7U, 8U}, Interfaces::SOMEIP);
+
+    ASSERT_TRUE(serviceDescription1 == serviceDescription2);
+    EXPECT_THAT(ServiceDescriptionHash()(serviceDescription1), Eq(ServiceDescriptionHash()(serviceDescription2)));
+}
+
+TEST_F(ServiceDescription_test, HashOfServiceDescriptionsWithShiftedStringBoundariesDiffers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92035ccf-37f3-4b67-a603-5ad7633ca97e");
+    ServiceDescription serviceDescription1("ab", "c", "d");
+    ServiceDescription serviceDescription2("a", "bc", "d");
+
+    EXPECT_THAT(ServiceDescriptionHash()(serviceDescription1), Ne(ServiceDescriptionHash()(serviceDescription2)));
+}
+
 /// END SERVICEDESCRIPTION TESTS
 
 } // namespace
@@ -52,12 +52,14 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(sut.chunkSize(), Eq(CHUNK_SIZE));
 
     // deliberately used a magic number to make the test fail when CHUNK_HEADER_VERSION changes
-    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(1U));
+    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(iox::build::IOX_PUBLISH_TIMESTAMPS ? 2U : 1U));
 
     EXPECT_THAT(sut.originId(), Eq(iox::popo::UniquePortId(iox::popo::InvalidPortId)));
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_THAT(sut.publishTimestamp(), Eq(0U));
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -85,13 +87,17 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
         uint16_t userHeaderId{0};
         uint64_t originId{0U};
         uint64_t sequenceNumber{0U};
+#if IOX_POSH_PUBLISH_TIMESTAMPS
+        uint64_t publishTimestamp{0U};
+#endif
         uint32_t userHeaderSize{0U};
         uint32_t userPayloadSize{0U};
         uint32_t userPayloadAlignment{0U};
         uint32_t userPayloadOffset{0U};
     };
 
-    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{1U};
+    // the layout without the publish timestamp must stay the one of version 1
+    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{iox::build::IOX_PUBLISH_TIMESTAMPS ? 2U : 1U};
     EXPECT_THAT(ChunkHeader::CHUNK_HEADER_VERSION, Eq(EXPECTED_CHUNK_HEADER_VERSION));
 
     EXPECT_THAT(sizeof(ChunkHeader), Eq(sizeof(ExpectedChunkHeaderLayout)));
@@ -119,6 +125,9 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(chunkHeaderVersion);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderId);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(sequenceNumber);
+#if IOX_POSH_PUBLISH_TIMESTAMPS
+    IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(publishTimestamp);
+#endif
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadAlignment);
@@ -0,0 +1,104 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_reclamation_report.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkReclamationReport_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({SMALL_CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        mempoolConfig.addMemPool({LARGE_CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+    }
+
+    SharedChunk getChunk(const uint32_t userPayloadSize)
+    {
+        auto chunkSettings = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        EXPECT_FALSE(chunkSettings.has_error());
+        auto chunk = memoryManager.getChunk(chunkSettings.value());
+        EXPECT_FALSE(chunk.has_error());
+        return chunk.value();
+    }
+
+    static constexpr uint32_t SMALL_CHUNK_SIZE{32U};
+    static constexpr uint32_t LARGE_CHUNK_SIZE{128U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
+    static constexpr uint64_t MEMORY_SIZE{100000U};
+
+    std::vector<uint8_t> memory = std::vector<uint8_t>(MEMORY_SIZE);
+    iox::BumpAllocator allocator{memory.data(), MEMORY_SIZE};
+    MemoryManager memoryManager;
+    ChunkReclamationReport sut;
+};
+
+TEST_F(ChunkReclamationReport_test, InitiallyNoChunksAreCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fa91ff1d-bb78-4095-9998-e6173bc36445");
+    EXPECT_THAT(sut.numberOfChunks(), Eq(0U));
+    EXPECT_TRUE(sut.memPools().empty());
+}
+
+TEST_F(ChunkReclamationReport_test, InvalidChunkIsNotCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08e7d397-f4fd-4bf1-8c43-9e9f8569b638");
+    sut.count(SharedChunk());
+
+    EXPECT_THAT(sut.numberOfChunks(), Eq(0U));
+    EXPECT_TRUE(sut.memPools().empty());
+}
+
+TEST_F(ChunkReclamationReport_test, ChunksAreCountedPerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd918d24-bcfe-49fb-a5da-daa1e1037773");
+    sut.count(getChunk(8U));
+    sut.count(getChunk(LARGE_CHUNK_SIZE - 8U));
+    sut.count(getChunk(16U));
+
+    EXPECT_THAT(sut.numberOfChunks(), Eq(3U));
+    ASSERT_THAT(sut.memPools().size(), Eq(2U));
+    EXPECT_THAT(sut.memPools()[0].chunkSize, Eq(memoryManager.getMemPoolInfo(0U).m_chunkSize));
+    EXPECT_THAT(sut.memPools()[0].numberOfChunks, Eq(2U));
+    EXPECT_THAT(sut.memPools()[1].chunkSize, Eq(memoryManager.getMemPoolInfo(1U).m_chunkSize));
+    EXPECT_THAT(sut.memPools()[1].numberOfChunks, Eq(1U));
+}
+
+TEST_F(ChunkReclamationReport_test, ClearRemovesAllCountedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d34703c6-0f24-4d4f-81b8-666db8e1ff85");
+    sut.count(getChunk(8U));
+    sut.count(getChunk(LARGE_CHUNK_SIZE - 8U));
+
+    sut.clear();
+
+    EXPECT_THAT(sut.numberOfChunks(), Eq(0U));
+    EXPECT_TRUE(sut.memPools().empty());
+}
+
+} // namespace
@@ -66,6 +66,28 @@ class ChunkDistributor_test : public Test
         *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
         return SharedChunk(chunkMgmt);
     }
+    SharedChunk allocateChunkWithUserHeader(uint64_t value, uint32_t userHeaderValue)
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        auto chunk = mempool.getChunk();
+
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE / 2U,
+                                                         iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                         sizeof(userHeaderValue),
+                                                         alignof(uint32_t));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        *static_cast<uint32_t*>(chunkHeader->userHeader()) = userHeaderValue;
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+        return SharedChunk(chunkMgmt);
+    }
     uint32_t getSharedChunkValue(const SharedChunk& chunk)
     {
         return *static_cast<uint32_t*>(chunk.getUserPayload());
@@ -823,4 +845,180 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesSkipsQueuesWhoseFilterRejectsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3adfa6db-f0a0-4165-a313-98e74dd77a9e");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto unfilteredQueueData = this->getChunkQueueData();
+    auto filteredQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(filteredQueueData->m_userHeaderFilter.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint32_t{42U})
+                     .has_error());
+    ASSERT_FALSE(sut.tryAddQueue(unfilteredQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(filteredQueueData.get()).has_error());
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(13U, 73U));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> unfilteredQueue(unfilteredQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> filteredQueue(filteredQueueData.get());
+    EXPECT_THAT(unfilteredQueue.size(), Eq(1U));
+    EXPECT_THAT(filteredQueue.size(), Eq(0U));
+    EXPECT_FALSE(filteredQueue.hasLostChunks());
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDeliversToQueuesWhoseFilterAcceptsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e8f1f16-a8c7-492a-85a4-8a2891e16004");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(queueData->m_userHeaderFilter.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint32_t{42U})
+                     .has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(13U, 73U)), Eq(0U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(4451U, 42U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(1U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4451U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddSkipsChunksRejectedByTheFilter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8e0c0bf-889f-4996-9c9a-586f8114bd2a");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 42U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 73U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(3U, 42U));
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(queueData->m_userHeaderFilter.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint32_t{42U})
+                     .has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 3U).has_error());
+
+    EXPECT_THAT(queue.size(), Eq(2U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1U));
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDeliversOnlyEveryNthChunkToDecimatedQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79ee561a-1ed4-4981-a98e-63e38fb04fda");
+    constexpr uint64_t DECIMATION_FACTOR{3U};
+    constexpr uint64_t NUMBER_OF_CHUNKS{7U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_decimationFactor = DECIMATION_FACTOR;
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    uint64_t numberOfDeliveries{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        numberOfDeliveries += sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+    EXPECT_THAT(numberOfDeliveries, Eq(3U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_THAT(queue.size(), Eq(3U));
+    for (uint64_t expectedValue = 0U; expectedValue < NUMBER_OF_CHUNKS; expectedValue += DECIMATION_FACTOR)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+    EXPECT_FALSE(queue.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, DueChunkLostDueToAFullQueueDoesNotConsumeTheDecimationSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3bcaecdf-3ed5-4554-b673-9fbf40b70707");
+    constexpr uint64_t DECIMATION_FACTOR{2U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                             VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    queueData->m_decimationFactor = DECIMATION_FACTOR;
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(0U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    // due but rejected by the full queue
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    EXPECT_TRUE(queue.hasLostChunks());
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(0U));
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(3U));
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDiscardsChunksArrivingWithinMinimumDeliveryInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7129402e-add5-4de6-82cf-fe8441d2d45d");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto throttledQueueData = this->getChunkQueueData();
+    throttledQueueData->m_minimumDeliveryIntervalInNanoseconds =
+        iox::units::Duration::fromSeconds(3600U).toNanoseconds();
+    auto unthrottledQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(throttledQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(unthrottledQueueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1U)), Eq(2U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(2U)), Eq(1U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(3U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> throttledQueue(throttledQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> unthrottledQueue(unthrottledQueueData.get());
+    EXPECT_THAT(unthrottledQueue.size(), Eq(3U));
+    ASSERT_THAT(throttledQueue.size(), Eq(1U));
+    auto maybeSharedChunk = throttledQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDeliversAgainAfterMinimumDeliveryIntervalHasPassed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1ae2426-bbc0-4642-82a3-79f2e791770c");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_minimumDeliveryIntervalInNanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(this->BLOCKING_DURATION).count() / 2U;
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1U)), Eq(1U));
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(2U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(2U));
+}
+
 } // namespace
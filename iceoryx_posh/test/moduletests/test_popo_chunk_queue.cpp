@@ -179,6 +179,48 @@ TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, PushRecordsQueueDepthInHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4f0c3d2-6e1b-4b8a-9d57-3c2e8f1b6a90");
+    if (iox::build::IOX_MAX_PORT_HISTOGRAMS == 0U)
+    {
+        GTEST_SKIP() << "This test requires a -DIOX_MAX_PORT_HISTOGRAMS greater than 0 cmake argument";
+    }
+    this->m_chunkData.m_queueDepthHistogramEnabled = true;
+    constexpr uint64_t NUMBER_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+
+    const auto histogram = this->m_chunkData.m_queueDepthHistogram.snapshot();
+    EXPECT_THAT(histogram.totalCount(), Eq(NUMBER_CHUNKS));
+    /// @note size not implemented on FIFO
+    if (this->m_variantQueueType != iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer)
+    {
+        for (uint64_t depth = 1U; depth <= NUMBER_CHUNKS; ++depth)
+        {
+            EXPECT_THAT(histogram.count(Histogram::bucketIndex(depth)), Eq(1U));
+        }
+    }
+}
+
+TYPED_TEST(ChunkQueue_test, PushDoesNotRecordQueueDepthWhenHistogramIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "80e4c036-0eb2-4ffd-bc61-851f30022c2e");
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(this->m_chunkData.m_queueDepthHistogram.snapshot().totalCount(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueue_test, InitialCountersAreZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f19d3a6-5c2e-4b80-a4d1-3e6b8c0f2a97");
+    EXPECT_THAT(this->m_popper.getLostChunksCount(), Eq(0U));
+    EXPECT_THAT(this->m_popper.getMaximumFillLevel(), Eq(0U));
+    EXPECT_THAT(this->m_popper.getReceivedChunksCount(), Eq(0U));
+}
+
 TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler)
 {
     ::testing::Test::RecordProperty("TEST_ID", "597f1da3-6f64-4254-9e41-0c4776746a14");
@@ -328,6 +370,32 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, RejectedPushDoesNotChangeCountersAndHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69fcf94e-60ec-46b1-8552-924337bfc453");
+    this->m_chunkData.m_queueDepthHistogramEnabled = true;
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    // a blocking producer retries the push of the same chunk as long as the queue is full
+    constexpr uint64_t NUMBER_OF_RETRIES{3U};
+    auto chunk = this->allocateChunk();
+    for (uint64_t i = 0U; i < NUMBER_OF_RETRIES; ++i)
+    {
+        EXPECT_FALSE(this->m_pusher.push(chunk));
+    }
+
+    EXPECT_THAT(this->m_popper.getReceivedChunksCount(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    EXPECT_THAT(this->m_popper.getMaximumFillLevel(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    if (iox::build::IOX_MAX_PORT_HISTOGRAMS > 0U)
+    {
+        EXPECT_THAT(this->m_chunkData.m_queueDepthHistogram.snapshot().totalCount(),
+                    Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    }
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -392,6 +460,25 @@ TYPED_TEST(ChunkQueueSoFi_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueSoFi_test, OverflowingPushCountsTheNewChunkOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6237beaa-0f9d-4099-893d-2c3d6fe3f1e8");
+    this->m_chunkData.m_queueDepthHistogramEnabled = true;
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    EXPECT_FALSE(this->m_pusher.push(this->allocateChunk()));
+
+    EXPECT_THAT(this->m_popper.getReceivedChunksCount(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY + 1U));
+    EXPECT_THAT(this->m_popper.getMaximumFillLevel(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    if (iox::build::IOX_MAX_PORT_HISTOGRAMS > 0U)
+    {
+        EXPECT_THAT(this->m_chunkData.m_queueDepthHistogram.snapshot().totalCount(),
+                    Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY + 1U));
+    }
+}
 
 TYPED_TEST(ChunkQueueSoFi_test, InitialNoLostChunks)
 {
@@ -416,4 +503,29 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TYPED_TEST(ChunkQueueSoFi_test, LostChunksCountIsNotResetAfterRead)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b7d5c1e-93f4-4e2a-8c61-f5a2d7e9b314");
+    this->m_pusher.lostAChunk();
+    this->m_pusher.lostAChunk();
+    this->m_popper.hasLostChunks();
+
+    EXPECT_THAT(this->m_popper.getLostChunksCount(), Eq(2U));
+}
+
+TYPED_TEST(ChunkQueueSoFi_test, MaximumFillLevelIsKeptAfterPop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2c64a9b-1f07-4d35-b8e0-7a3f9c5d1e62");
+    constexpr uint64_t NUMBER_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+    this->m_popper.clear();
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(this->m_popper.getMaximumFillLevel(), Eq(NUMBER_CHUNKS));
+    EXPECT_THAT(this->m_popper.getReceivedChunksCount(), Eq(NUMBER_CHUNKS + 1U));
+}
+
 } // namespace
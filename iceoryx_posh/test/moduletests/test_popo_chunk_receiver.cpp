@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
@@ -235,6 +236,55 @@ TEST_F(ChunkReceiver_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getChunkWithPublishTimestampRecordsLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7656d50e-2358-46ac-976d-2b37389baec8");
+    if (!iox::build::IOX_PUBLISH_TIMESTAMPS)
+    {
+        GTEST_SKIP() << "This test requires the -DPUBLISH_TIMESTAMPS=ON cmake argument";
+    }
+
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+    ChunkSenderData_t chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    chunkSenderData.m_publishTimestampEnabled = true;
+    iox::popo::ChunkSender<ChunkSenderData_t> chunkSender{&chunkSenderData};
+    ASSERT_FALSE(chunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+
+    auto maybeChunkHeader = chunkSender.tryAllocate(iox::popo::UniquePortId(),
+                                                    sizeof(DummySample),
+                                                    alignof(DummySample),
+                                                    iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                    iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    chunkSender.send(*maybeChunkHeader);
+
+    auto maybeReceivedChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeReceivedChunkHeader.has_error());
+    m_chunkReceiver.release(*maybeReceivedChunkHeader);
+    chunkSender.releaseAll();
+
+    EXPECT_THAT(m_chunkReceiver.getLatencyHistogram().totalCount(), Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, getChunkWithoutPublishTimestampDoesNotRecordLatency)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12dd2424-3fe2-4d0c-9125-08318cc38baa");
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        m_chunkQueuePusher.push(sharedChunk);
+
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkReceiver.getLatencyHistogram().totalCount(), Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, asStringLiteralConvertsChunkReceiveResultValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5cbbda34-8a22-4eab-a8b6-20da345c1707");
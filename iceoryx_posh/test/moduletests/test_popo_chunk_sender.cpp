@@ -359,6 +359,105 @@ TEST_F(ChunkSender_test, sendOneWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendWithPublishTimestampEnabledSetsPublishTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf0d763a-1edc-4072-960c-608200c2b59c");
+    if (!iox::build::IOX_PUBLISH_TIMESTAMPS)
+    {
+        GTEST_SKIP() << "This test requires the -DPUBLISH_TIMESTAMPS=ON cmake argument";
+    }
+    m_chunkSenderData.m_publishTimestampEnabled = true;
+
+    const auto timestampBeforeSend = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(iox::mepoo::BaseClock_t::now().time_since_epoch())
+            .count());
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->publishTimestamp(), Eq(0U));
+
+    m_chunkSender.send(*maybeChunkHeader);
+
+    const auto timestampAfterSend = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(iox::mepoo::BaseClock_t::now().time_since_epoch())
+            .count());
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Ge(timestampBeforeSend));
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Le(timestampAfterSend));
+}
+
+TEST_F(ChunkSender_test, sendWithPublishTimestampDisabledDoesNotSetPublishTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "72f157fc-5a79-4226-a1b3-17b5fd90fc2b");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSender.send(*maybeChunkHeader);
+
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT((*lastChunk)->publishTimestamp(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendWithPublishTimestampEnabledRecordsSendInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3b9e2a1-47c6-4f0e-8a5d-2b1c9e7f3a48");
+    if (!iox::build::IOX_PUBLISH_TIMESTAMPS)
+    {
+        GTEST_SKIP() << "This test requires the -DPUBLISH_TIMESTAMPS=ON cmake argument";
+    }
+    if (iox::build::IOX_MAX_PORT_HISTOGRAMS == 0U)
+    {
+        GTEST_SKIP() << "This test requires a -DIOX_MAX_PORT_HISTOGRAMS greater than 0 cmake argument";
+    }
+    m_chunkSenderData.m_publishTimestampEnabled = true;
+    m_chunkSender.setSendIntervalHistogramEnabled(true);
+
+    constexpr uint64_t NUMBER_OF_SENDS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENDS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    // the first send has no predecessor and therefore no interval
+    EXPECT_THAT(m_chunkSender.getSendIntervalHistogram().totalCount(), Eq(NUMBER_OF_SENDS - 1U));
+}
+
+TEST_F(ChunkSender_test, sendWithSendIntervalHistogramDisabledDoesNotRecordSendInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "33ee8305-15cb-466c-adb5-b5c2e86c569b");
+    m_chunkSenderData.m_publishTimestampEnabled = true;
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSender.getSendIntervalHistogram().totalCount(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendWithPublishTimestampDisabledDoesNotRecordSendInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e8a1f47-c2d0-4b93-a6e1-0f7d3c9b2e85");
+    m_chunkSender.setSendIntervalHistogramEnabled(true);
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSender.getSendIntervalHistogram().totalCount(), Eq(0U));
+}
+
 TEST_F(ChunkSender_test, sendMultipleWithReceiver)
 {
     ::testing::Test::RecordProperty("TEST_ID", "07e6a360-f5ae-4cd9-9bee-54b3c31c3390");
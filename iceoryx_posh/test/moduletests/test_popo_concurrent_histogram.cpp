@@ -0,0 +1,78 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/concurrent_histogram.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+TEST(ConcurrentHistogram_test, SnapshotOfNewHistogramIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ed8a373-d4c9-404a-928e-69e711a1af23");
+    ConcurrentHistogram sut;
+
+    EXPECT_THAT(sut.snapshot().totalCount(), Eq(0U));
+}
+
+TEST(ConcurrentHistogram_test, SnapshotContainsRecordedValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd599059-ed3b-4edc-97fe-1f67cb3c37c8");
+    ConcurrentHistogram sut;
+    sut.record(1U);
+    sut.record(1U);
+    sut.record(4711U);
+
+    const auto histogram = sut.snapshot();
+    EXPECT_THAT(histogram.totalCount(), Eq(3U));
+    EXPECT_THAT(histogram.count(Histogram::bucketIndex(1U)), Eq(2U));
+    EXPECT_THAT(histogram.count(Histogram::bucketIndex(4711U)), Eq(1U));
+}
+
+TEST(ConcurrentHistogram_test, ConcurrentRecordingDoesNotLoseValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dc09a09-ef7c-43ae-8076-533c622bb2c1");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t VALUES_PER_THREAD{10000U};
+    ConcurrentHistogram sut;
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&] {
+            for (uint64_t value = 0U; value < VALUES_PER_THREAD; ++value)
+            {
+                sut.record(value);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto histogram = sut.snapshot();
+    EXPECT_THAT(histogram.totalCount(), Eq(NUMBER_OF_THREADS * VALUES_PER_THREAD));
+    EXPECT_THAT(histogram.count(Histogram::bucketIndex(0U)), Eq(NUMBER_OF_THREADS));
+}
+
+} // namespace
@@ -21,11 +21,14 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/notification_socket.hpp"
 #include "iox/algorithm.hpp"
 #include "test.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <poll.h>
 #include <thread>
 #include <type_traits>
 
@@ -58,6 +61,12 @@ class ConditionVariable_test : public Test
         m_watchdog.watchAndActOnFailure([&] { std::terminate(); });
     }
 
+    static bool isReadable(const int32_t fd)
+    {
+        pollfd pollFd{fd, POLLIN, 0};
+        return poll(&pollFd, 1U, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+    }
+
     Watchdog m_watchdog{m_timeToWait};
 };
 
@@ -494,4 +503,138 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, SpinningIsDisabledByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d9d7533-d360-42f7-933a-673a408100a6");
+    EXPECT_THAT(m_waiter.getSpinDuration(), Eq(iox::units::Duration::zero()));
+}
+
+TEST_F(ConditionVariable_test, SetSpinDurationIsReturnedByGetSpinDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e91ed38-5991-4e4d-be8c-74ba82002ab2");
+    m_waiter.setSpinDuration(42_us);
+    EXPECT_THAT(m_waiter.getSpinDuration(), Eq(42_us));
+}
+
+TEST_F(ConditionVariable_test, WaitWithSpinningDetectsNotificationWithoutSemaphorePost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "848f7ef5-79df-4a27-89f2-cfa18f1f7d83");
+    constexpr Type_t EVENT_INDEX{3U};
+    m_waiter.setSpinDuration(m_timeToWait);
+
+    Barrier isThreadStarted(1U);
+    std::thread notifier([&] {
+        isThreadStarted.notify();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // a notification without a semaphore post would block a non spinning wait forever
+        m_condVarData.m_activeNotifications[EVENT_INDEX].store(true, std::memory_order_release);
+        m_condVarData.m_wasNotified.store(true, std::memory_order_relaxed);
+    });
+    isThreadStarted.wait();
+
+    auto indices = m_waiter.wait();
+    notifier.join();
+
+    ASSERT_THAT(indices.size(), Eq(1U));
+    EXPECT_THAT(indices[0U], Eq(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithLongerSpinDurationReturnsAfterTimeToWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edbdde83-4aec-41fb-8071-a3f01f51d19a");
+    m_waiter.setSpinDuration(m_timeToWait);
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(m_waiter.timedWait(10_ms).empty());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(elapsed, Lt(std::chrono::milliseconds(m_timingTestTime.toMilliseconds())));
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpSpinningWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f7753e3-6ca4-4582-85b4-5a987919af23");
+    m_waiter.setSpinDuration(m_timeToWait);
+
+    Barrier isThreadStarted(1U);
+    std::thread destroyer([&] {
+        isThreadStarted.notify();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_waiter.destroy();
+    });
+    isThreadStarted.wait();
+
+    EXPECT_TRUE(m_waiter.wait().empty());
+    destroyer.join();
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsNotReadableWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02b9b167-bf5c-4de8-9f9e-21c868ac4f8d");
+    auto fd = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+
+    EXPECT_FALSE(isReadable(fd.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsReadableAfterNotifyUntilTheNotificationsAreCollected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46af53fe-27f7-4b5e-ba62-ede558978c26");
+    constexpr Type_t EVENT_INDEX{7U};
+    auto fd = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+
+    m_notifiers[EVENT_INDEX].notify();
+    m_notifiers[EVENT_INDEX].notify();
+    EXPECT_TRUE(isReadable(fd.value()));
+
+    auto indices = m_waiter.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(indices.size(), Eq(1U));
+    EXPECT_THAT(indices[0U], Eq(EVENT_INDEX));
+    EXPECT_FALSE(isReadable(fd.value()));
+}
+
+TEST_F(ConditionVariable_test, FileDescriptorIsCreatedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "50f483f3-115e-46ac-85a4-6053f1975e9f");
+    auto fd = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+
+    auto sameFd = m_waiter.getFileDescriptor();
+    ASSERT_FALSE(sameFd.has_error());
+    EXPECT_THAT(sameFd.value(), Eq(fd.value()));
+}
+
+TEST_F(ConditionVariable_test, DestroyedNotificationSocketIsUnregisteredFromConditionVariableData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32df3eeb-c6d9-4e10-a795-417c17239548");
+    {
+        auto sut = NotificationSocket::create(m_condVarData);
+        ASSERT_FALSE(sut.has_error());
+        EXPECT_THAT(m_condVarData.m_notificationSocketId.load(),
+                    Ne(ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID));
+    }
+
+    EXPECT_THAT(m_condVarData.m_notificationSocketId.load(), Eq(ConditionVariableData::INVALID_NOTIFICATION_SOCKET_ID));
+    // notifying without a registered socket must be harmless
+    m_signaler.notify();
+    EXPECT_TRUE(m_waiter.wasNotified());
+}
+
+TEST_F(ConditionVariable_test, NotificationSocketsOfDifferentConditionVariablesAreIndependent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e82077b-e2f8-4ca3-a2ce-c50ae69c1856");
+    ConditionVariableData otherCondVarData{m_runtimeName};
+    ConditionListener otherWaiter{otherCondVarData};
+    auto fd = m_waiter.getFileDescriptor();
+    auto otherFd = otherWaiter.getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+    ASSERT_FALSE(otherFd.has_error());
+
+    ConditionNotifier(otherCondVarData, 0U).notify();
+
+    EXPECT_FALSE(isReadable(fd.value()));
+    EXPECT_TRUE(isReadable(otherFd.value()));
+}
+
 } // namespace
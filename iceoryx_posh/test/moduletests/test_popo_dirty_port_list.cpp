@@ -0,0 +1,108 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/dirty_port_list.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+std::vector<uint64_t> collectAll(DirtyPortList& sut)
+{
+    std::vector<uint64_t> indices;
+    sut.collect([&](const uint64_t index) { indices.push_back(index); });
+    return indices;
+}
+
+TEST(DirtyPortList_test, CollectOnNewListReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15ce9b47-0403-4d30-aff1-45c74d1bdb82");
+    DirtyPortList sut;
+
+    EXPECT_THAT(collectAll(sut), IsEmpty());
+}
+
+TEST(DirtyPortList_test, CollectReturnsMarkedIndicesInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e03bef5d-c95e-42e8-a28b-19ca0bf65f6d");
+    DirtyPortList sut;
+    sut.mark(DirtyPortList::CAPACITY - 1U);
+    sut.mark(3U);
+    sut.mark(0U);
+
+    EXPECT_THAT(collectAll(sut), ElementsAre(0U, 3U, DirtyPortList::CAPACITY - 1U));
+}
+
+TEST(DirtyPortList_test, IndexMarkedMultipleTimesIsCollectedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c749839-c799-4e77-a5bc-bcd7148c762f");
+    DirtyPortList sut;
+    sut.mark(7U);
+    sut.mark(7U);
+
+    EXPECT_THAT(collectAll(sut), ElementsAre(7U));
+}
+
+TEST(DirtyPortList_test, CollectRemovesTheMarks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94b4fe39-1715-41dc-bc68-2040587b0e52");
+    DirtyPortList sut;
+    sut.mark(1U);
+    collectAll(sut);
+
+    EXPECT_THAT(collectAll(sut), IsEmpty());
+}
+
+TEST(DirtyPortList_test, MarkWithIndexOutOfRangeIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fa7d731-b966-40d5-871e-7b5b6680e17d");
+    DirtyPortList sut;
+    sut.mark(DirtyPortList::CAPACITY);
+
+    EXPECT_THAT(collectAll(sut), IsEmpty());
+}
+
+TEST(DirtyPortList_test, ConcurrentMarkingDoesNotLoseIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b31b8cc3-bd1c-41fb-afef-941b68c147e1");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    DirtyPortList sut;
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&, i] {
+            for (uint64_t index = i; index < DirtyPortList::CAPACITY; index += NUMBER_OF_THREADS)
+            {
+                sut.mark(index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(collectAll(sut).size(), Eq(DirtyPortList::CAPACITY));
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/histogram.hpp"
+
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+TEST(Histogram_test, ValuesSmallerThanSubBucketCountHaveTheirOwnBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77e2d27f-e659-422b-bba8-0a8f915bb260");
+    for (uint32_t value = 0U; value < Histogram::SUB_BUCKET_COUNT; ++value)
+    {
+        EXPECT_THAT(Histogram::bucketIndex(value), Eq(value));
+    }
+}
+
+TEST(Histogram_test, PowerOfTwoRangesAreSplitIntoSubBuckets)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edc0a1a9-0f91-4dfd-a206-b3521ce2589c");
+    // the range [32, 64) is split into 16 buckets with a width of 2
+    EXPECT_THAT(Histogram::bucketIndex(32U), Eq(32U));
+    EXPECT_THAT(Histogram::bucketIndex(33U), Eq(32U));
+    EXPECT_THAT(Histogram::bucketIndex(34U), Eq(33U));
+    EXPECT_THAT(Histogram::bucketIndex(63U), Eq(47U));
+    EXPECT_THAT(Histogram::bucketIndex(64U), Eq(48U));
+}
+
+TEST(Histogram_test, BucketBoundsAreContiguousAndMapToTheirBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6161004-342d-46d5-b152-4db003599bbf");
+    EXPECT_THAT(Histogram::bucketLowerBound(0U), Eq(0U));
+    for (uint32_t i = 0U; i < Histogram::BUCKET_COUNT; ++i)
+    {
+        EXPECT_THAT(Histogram::bucketIndex(Histogram::bucketLowerBound(i)), Eq(i));
+        EXPECT_THAT(Histogram::bucketIndex(Histogram::bucketUpperBound(i)), Eq(i));
+        if (i + 1U < Histogram::BUCKET_COUNT)
+        {
+            EXPECT_THAT(Histogram::bucketLowerBound(i + 1U), Eq(Histogram::bucketUpperBound(i) + 1U));
+        }
+    }
+    EXPECT_THAT(Histogram::bucketUpperBound(Histogram::BUCKET_COUNT - 1U), Eq(Histogram::MAX_TRACKABLE_VALUE));
+}
+
+TEST(Histogram_test, ValuesLargerThanMaxTrackableValueAreCountedInLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9573b0d9-dbbc-4e4a-a88a-6b3f27f73a1c");
+    Histogram sut;
+    sut.record(Histogram::MAX_TRACKABLE_VALUE + 1U);
+    sut.record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_THAT(sut.count(Histogram::BUCKET_COUNT - 1U), Eq(2U));
+    EXPECT_THAT(sut.totalCount(), Eq(2U));
+}
+
+TEST(Histogram_test, CountOfBucketOutOfBoundsIsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fc5036a-e8aa-4861-b31f-95838771ccdd");
+    Histogram sut;
+    sut.record(Histogram::MAX_TRACKABLE_VALUE);
+
+    EXPECT_THAT(sut.count(Histogram::BUCKET_COUNT), Eq(0U));
+}
+
+TEST(Histogram_test, ValueAtPercentileOfEmptyHistogramIsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ecc82bb1-e977-4c28-a636-29b59a7e87cb");
+    Histogram sut;
+
+    EXPECT_THAT(sut.totalCount(), Eq(0U));
+    EXPECT_THAT(sut.valueAtPercentile(50.0), Eq(0U));
+}
+
+TEST(Histogram_test, ValueAtPercentileReturnsUpperBoundOfBucketContainingThePercentile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5474d2c0-0778-4972-a12f-4131d9cf7f68");
+    constexpr uint64_t NUMBER_OF_VALUES{1000U};
+    Histogram sut;
+    for (uint64_t value = 1U; value <= NUMBER_OF_VALUES; ++value)
+    {
+        sut.record(value);
+    }
+
+    EXPECT_THAT(sut.totalCount(), Eq(NUMBER_OF_VALUES));
+    EXPECT_THAT(sut.valueAtPercentile(50.0), Eq(Histogram::bucketUpperBound(Histogram::bucketIndex(500U))));
+    EXPECT_THAT(sut.valueAtPercentile(99.0), Eq(Histogram::bucketUpperBound(Histogram::bucketIndex(990U))));
+    EXPECT_THAT(sut.valueAtPercentile(100.0),
+                Eq(Histogram::bucketUpperBound(Histogram::bucketIndex(NUMBER_OF_VALUES))));
+}
+
+TEST(Histogram_test, ValueAtPercentileHasBoundedRelativeError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ecdbb8a-64b7-4e79-bac3-676a8641ff04");
+    constexpr uint64_t VALUE{123456789U};
+    Histogram sut;
+    sut.record(VALUE);
+
+    const auto reportedValue = sut.valueAtPercentile(99.9);
+    EXPECT_THAT(reportedValue, Ge(VALUE));
+    EXPECT_THAT(reportedValue - VALUE, Le(VALUE / Histogram::SUB_BUCKET_COUNT));
+}
+
+TEST(Histogram_test, ValueAtPercentileOutOfRangeIsClamped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eecfa7ef-73aa-4e7d-b709-8bb69c607844");
+    Histogram sut;
+    sut.record(2U);
+    sut.record(1000U);
+
+    EXPECT_THAT(sut.valueAtPercentile(-1.0), Eq(2U));
+    EXPECT_THAT(sut.valueAtPercentile(200.0), Eq(Histogram::bucketUpperBound(Histogram::bucketIndex(1000U))));
+}
+
+} // namespace
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_hoofs/testing/testing_logger.hpp"
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -134,8 +135,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const uint64_t numberOfWorkerThreads = 0U) noexcept
+        : Listener(data, numberOfWorkerThreads)
     {
     }
 };
@@ -157,6 +158,7 @@ iox::concurrent::smart_lock<std::vector<EventAndSutPair_t>> g_toBeDetached;
 std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_triggerCallbackArg;
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
 iox::optional<iox::posix::UnnamedSemaphore> g_callbackBlocker;
+iox::concurrent::smart_lock<std::vector<SimpleEventClass*>> g_callbackOrder;
 
 class Listener_test : public Test
 {
@@ -180,6 +182,11 @@ class Listener_test : public Test
         ++(*userType);
     }
 
+    static void recordCallbackOrder(SimpleEventClass* const event) noexcept
+    {
+        g_callbackOrder->emplace_back(event);
+    }
+
     static void attachCallback(SimpleEventClass* const) noexcept
     {
         for (auto& e : g_toBeAttached.getCopy())
@@ -200,6 +207,13 @@ class Listener_test : public Test
         }
     }
 
+    static void blockAndThenDetachAndAttachCallback(SimpleEventClass* const) noexcept
+    {
+        IOX_DISCARD_RESULT(g_callbackBlocker->wait());
+        detachCallback(nullptr);
+        attachCallback(nullptr);
+    }
+
     static void notifyAndThenDetachStoepselCallback(SimpleEventClass* const) noexcept
     {
         for (auto& e : g_toBeDetached.getCopy())
@@ -223,6 +237,7 @@ class Listener_test : public Test
         g_triggerCallbackRuntimeInMs = 0U;
         g_toBeAttached->clear();
         g_toBeDetached->clear();
+        g_callbackOrder->clear();
     };
 
     void activateTriggerCallbackBlocker() noexcept
@@ -333,6 +348,14 @@ TEST_F(Listener_test, IsEmptyWhenConstructed)
     EXPECT_THAT(m_sut->size(), Eq(0U));
 }
 
+TEST_F(Listener_test, SetSpinDurationIsReturnedByGetSpinDuration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34031f80-6d4e-43f2-9479-99e952f55c30");
+    EXPECT_THAT(m_sut->getSpinDuration(), Eq(iox::units::Duration::zero()));
+    m_sut->setSpinDuration(73_us);
+    EXPECT_THAT(m_sut->getSpinDuration(), Eq(73_us));
+}
+
 TEST_F(Listener_test, AttachingWithoutEnumIfEnoughSpaceAvailableWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42f0fdf5-9218-4f50-927a-8bcad4e7065f");
@@ -1238,4 +1261,162 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN worker threads
+//////////////////////////////////
+TEST_F(Listener_test, CallbacksOfDifferentEventsAreExecutedConcurrentlyByWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29bf93cc-29bf-43c0-9dd2-01e3ea8c38e8");
+    constexpr uint64_t NUMBER_OF_WORKER_THREADS{2U};
+    m_sut.emplace(m_condVarData, NUMBER_OF_WORKER_THREADS);
+    activateTriggerCallbackBlocker();
+
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<1U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // both callbacks are blocked at the same time
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_count.load(), Eq(1U));
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_source.load(), Eq(&fuu));
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_source.load(), Eq(&bar));
+
+    unblockTriggerCallback(NUMBER_OF_WORKER_THREADS);
+}
+
+TEST_F(Listener_test, CallbackOfOneEventIsNotExecutedConcurrentlyByWorkerThreadsButRepeatedWhenNotifiedMeanwhile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8a13ba6-53d1-4f9e-817c-fb0508a5a9bd");
+    constexpr uint64_t NUMBER_OF_WORKER_THREADS{4U};
+    m_sut.emplace(m_condVarData, NUMBER_OF_WORKER_THREADS);
+    activateTriggerCallbackBlocker();
+
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // the notifications during the execution of the callback result in exactly one more execution
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(2U));
+
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(2U));
+}
+
+TEST_F(Listener_test, ScheduledCallbackOfDetachedEventIsNotExecutedForEventAttachedToTheSameIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9141515b-22aa-4928-92bb-c1f9e46b90a3");
+    m_sut.emplace(m_condVarData, 1U);
+    activateTriggerCallbackBlocker();
+
+    SimpleEventClass blocker;
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(
+        m_sut->attachEvent(blocker, createNotificationCallback(blockAndThenDetachAndAttachCallback)).has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(triggerCallback<1U>))
+                     .has_error());
+    g_toBeDetached->push_back({&fuu, &*m_sut});
+    g_toBeAttached->push_back({&bar, &*m_sut});
+
+    // the only worker is blocked, therefore the callback of fuu is still scheduled when the callback of the blocker
+    // detaches fuu and attaches bar
+    blocker.triggerNoEventType();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(0U));
+    EXPECT_THAT(g_triggerCallbackArg[1U].m_count.load(), Eq(0U));
+
+    // releases the worker in case the callback of bar was executed nevertheless
+    unblockTriggerCallback(1U);
+}
+
+TEST_F(Listener_test, RequestingMoreWorkerThreadsThanSupportedIsLimitedWithAWarning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a4e5b35-8ef5-45d8-be34-d9c4aa00d45b");
+    m_sut.emplace(m_condVarData, iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER + 1U);
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(
+        iox::log::LogLevel::WARN, [&](const auto& logMessages) {
+            ASSERT_THAT(logMessages.size(), Eq(1U));
+            EXPECT_THAT(logMessages[0], HasSubstr("worker threads"));
+        });
+}
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+//////////////////////////////////
+// BEGIN priorities
+//////////////////////////////////
+TEST_F(Listener_test, CallbacksOfEventsWhichOccurTogetherAreExecutedInTheOrderOfTheirPriority)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2601f8d-83b5-4165-90ce-162b5ca75ad9");
+    activateTriggerCallbackBlocker();
+
+    SimpleEventClass blocker;
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    SimpleEventClass baz;
+    ASSERT_FALSE(m_sut->attachEvent(blocker, createNotificationCallback(triggerCallback<0U>)).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(fuu, createNotificationCallback(recordCallbackOrder), 1U).has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(recordCallbackOrder),
+                                   3U)
+                     .has_error());
+    ASSERT_FALSE(m_sut->attachEvent(baz, createNotificationCallback(recordCallbackOrder), 2U).has_error());
+
+    // the events are notified while the Listener is blocked, therefore they are handled together afterwards
+    blocker.triggerNoEventType();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerNoEventType();
+    bar.triggerStoepsel();
+    baz.triggerNoEventType();
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    EXPECT_THAT(g_callbackOrder.getCopy(), ElementsAre(&bar, &baz, &fuu));
+}
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
@@ -222,7 +222,13 @@ TEST_F(ListenerWaitsetAttachments_test, ServiceDiscoveryDestructorCallsTriggerRe
                                       RUNTIME_NAME,
                                       VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
                                       SubscriberOptions());
-    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&subscriberData));
+    SubscriberPortData deltaSubscriberData({SERVICE, INSTANCE, EVENT},
+                                           RUNTIME_NAME,
+                                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                           SubscriberOptions());
+    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&subscriberData))
+        .WillOnce(Return(&deltaSubscriberData));
 
     optional<iox::runtime::ServiceDiscovery> serviceDiscovery;
     serviceDiscovery.emplace();
@@ -32,6 +32,7 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.publishTimestamp = true;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +47,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.publishTimestamp, Ne(defaultOptions.publishTimestamp));
+            EXPECT_THAT(roundTripOptions.publishTimestamp, Eq(testOptions.publishTimestamp));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +70,10 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr bool PUBLISH_TIMESTAMP{false};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(
+        HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY, PUBLISH_TIMESTAMP);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -34,6 +34,11 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    ASSERT_FALSE(
+        testOptions.userHeaderFilter.addCondition(4U, iox::popo::UserHeaderFieldComparison::LESS, uint32_t{1337U})
+            .has_error());
+    testOptions.decimationFactor = 10U;
+    testOptions.minimumDeliveryInterval = iox::units::Duration::fromMilliseconds(100U);
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +58,15 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.userHeaderFilter, Ne(defaultOptions.userHeaderFilter));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter, Eq(testOptions.userHeaderFilter));
+
+            EXPECT_THAT(roundTripOptions.decimationFactor, Ne(defaultOptions.decimationFactor));
+            EXPECT_THAT(roundTripOptions.decimationFactor, Eq(testOptions.decimationFactor));
+
+            EXPECT_THAT(roundTripOptions.minimumDeliveryInterval, Ne(defaultOptions.minimumDeliveryInterval));
+            EXPECT_THAT(roundTripOptions.minimumDeliveryInterval, Eq(testOptions.minimumDeliveryInterval));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
@@ -0,0 +1,290 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/duration.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public iox::popo::Listener
+{
+  public:
+    ListenerTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+class Timer_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_callbackCounter = 0U;
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    static std::atomic<uint64_t> m_callbackCounter;
+    static void callback(Timer*)
+    {
+        ++m_callbackCounter;
+    }
+
+    static constexpr units::Duration SHORT_INTERVAL{10_ms};
+    static constexpr units::Duration LONG_INTERVAL{1_h};
+    static constexpr units::Duration MAX_WAIT_TIME{1_s};
+
+    Watchdog m_watchdog{10_s};
+    ConditionVariableData m_condVar{"Zeitgeist"};
+    WaitSetTest m_waitSet{m_condVar};
+    TimerScheduler m_timerScheduler;
+};
+
+std::atomic<uint64_t> Timer_test::m_callbackCounter{0U};
+constexpr units::Duration Timer_test::SHORT_INTERVAL;
+constexpr units::Duration Timer_test::LONG_INTERVAL;
+constexpr units::Duration Timer_test::MAX_WAIT_TIME;
+
+TEST_F(Timer_test, IsNotRunningWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "503f0fb5-3038-46b3-8df7-fe01aab7494d");
+    Timer sut(m_timerScheduler, LONG_INTERVAL, TimerMode::ONE_SHOT);
+
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_FALSE(sut.hasTriggered());
+    EXPECT_THAT(sut.getInterval(), Eq(LONG_INTERVAL));
+    EXPECT_THAT(sut.getMode(), Eq(TimerMode::ONE_SHOT));
+    EXPECT_THAT(m_timerScheduler.size(), Eq(0U));
+}
+
+TEST_F(Timer_test, IsRunningAfterStartAndNotRunningAfterStop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6df95d2-3116-4ba1-a49f-bf5c43686079");
+    Timer sut(m_timerScheduler, LONG_INTERVAL, TimerMode::PERIODIC);
+
+    ASSERT_FALSE(sut.start().has_error());
+    EXPECT_TRUE(sut.isRunning());
+    EXPECT_THAT(m_timerScheduler.size(), Eq(1U));
+
+    sut.stop();
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_THAT(m_timerScheduler.size(), Eq(0U));
+}
+
+TEST_F(Timer_test, RestartingRunningTimerDoesNotOccupyAdditionalSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "798d5ff1-a856-4831-b464-8010897626d1");
+    Timer sut(m_timerScheduler, LONG_INTERVAL, TimerMode::ONE_SHOT);
+
+    ASSERT_FALSE(sut.start().has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    EXPECT_TRUE(sut.isRunning());
+    EXPECT_THAT(m_timerScheduler.size(), Eq(1U));
+}
+
+TEST_F(Timer_test, DestroyingRunningTimerRemovesItFromTimerScheduler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c33dfc5-44dc-4e8d-b8a3-724b7236384f");
+    {
+        Timer sut(m_timerScheduler, LONG_INTERVAL, TimerMode::PERIODIC);
+        ASSERT_FALSE(sut.start().has_error());
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        EXPECT_THAT(m_waitSet.size(), Eq(1U));
+    }
+
+    EXPECT_THAT(m_timerScheduler.size(), Eq(0U));
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+}
+
+TEST_F(Timer_test, StartingPeriodicTimerWithZeroIntervalFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8858f19c-1138-4e8c-9621-d5a22e8eeef0");
+    Timer sut(m_timerScheduler, units::Duration::zero(), TimerMode::PERIODIC);
+
+    auto result = sut.start();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimerError::ZERO_PERIOD));
+    EXPECT_FALSE(sut.isRunning());
+}
+
+TEST_F(Timer_test, StartingMoreTimersThanTheTimerSchedulerCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3d51c9b-15fb-488f-b294-7b6f25a5eec7");
+    std::vector<std::unique_ptr<Timer>> timers;
+    for (uint64_t i = 0U; i < TimerScheduler::capacity(); ++i)
+    {
+        timers.emplace_back(new Timer(m_timerScheduler, LONG_INTERVAL, TimerMode::ONE_SHOT));
+        ASSERT_FALSE(timers.back()->start().has_error());
+    }
+
+    Timer sut(m_timerScheduler, LONG_INTERVAL, TimerMode::ONE_SHOT);
+    auto result = sut.start();
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(TimerError::TIMER_SCHEDULER_FULL));
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_FALSE(timers.front()->start().has_error());
+}
+
+TEST_F(Timer_test, OneShotTimerAttachedToWaitSetTriggersOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e73b5cd-736a-47d0-b853-9f131d42e7e0");
+    Timer sut(m_timerScheduler, SHORT_INTERVAL, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut, 42U).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    auto notifications = m_waitSet.timedWait(MAX_WAIT_TIME);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&sut));
+    EXPECT_THAT(notifications[0U]->getNotificationId(), Eq(42U));
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_TRUE(m_waitSet.timedWait(10 * SHORT_INTERVAL).empty());
+}
+
+TEST_F(Timer_test, PeriodicTimerAttachedToWaitSetTriggersRepeatedly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cdf6f30c-407b-40fe-be31-9fb81bb75520");
+    constexpr uint64_t NUMBER_OF_PERIODS{5U};
+    Timer sut(m_timerScheduler, SHORT_INTERVAL, TimerMode::PERIODIC);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PERIODS; ++i)
+    {
+        auto notifications = m_waitSet.timedWait(MAX_WAIT_TIME);
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&sut));
+    }
+    EXPECT_TRUE(sut.isRunning());
+}
+
+TEST_F(Timer_test, StoppedTimerDoesNotTrigger)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "967260b9-6f5f-4729-8503-4194732af9e8");
+    Timer sut(m_timerScheduler, SHORT_INTERVAL, TimerMode::PERIODIC);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+    sut.stop();
+
+    EXPECT_TRUE(m_waitSet.timedWait(10 * SHORT_INTERVAL).empty());
+    EXPECT_FALSE(sut.hasTriggered());
+}
+
+TEST_F(Timer_test, TimerWithMaximumIntervalNeverTriggersAndDoesNotDelayOtherTimers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "999f948d-75cc-4d5c-8d67-50b932906683");
+    Timer sut(m_timerScheduler, units::Duration::max(), TimerMode::PERIODIC);
+    Timer shortTimer(m_timerScheduler, SHORT_INTERVAL, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(m_waitSet.attachEvent(shortTimer).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+    ASSERT_FALSE(shortTimer.start().has_error());
+
+    auto notificationVector = m_waitSet.timedWait(MAX_WAIT_TIME);
+    ASSERT_THAT(notificationVector.size(), Eq(1U));
+    EXPECT_TRUE(notificationVector[0U]->doesOriginateFrom(&shortTimer));
+    EXPECT_TRUE(m_waitSet.timedWait(10 * SHORT_INTERVAL).empty());
+    EXPECT_FALSE(sut.hasTriggered());
+    EXPECT_TRUE(sut.isRunning());
+}
+
+TEST_F(Timer_test, RestartedOneShotTimerActsAsWatchdogAndTriggersOnlyWhenNotRestartedWithinInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32dd9dde-f269-4e92-97d0-1e59bbd1b64e");
+    constexpr units::Duration WATCHDOG_INTERVAL{200_ms};
+    constexpr units::Duration SAMPLE_INTERVAL{50_ms};
+    Timer sut(m_timerScheduler, WATCHDOG_INTERVAL, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    // simulates samples which arrive more frequently than the watchdog interval
+    constexpr uint64_t NUMBER_OF_SAMPLES{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        EXPECT_TRUE(m_waitSet.timedWait(SAMPLE_INTERVAL).empty());
+        ASSERT_FALSE(sut.start().has_error());
+    }
+
+    auto notifications = m_waitSet.timedWait(MAX_WAIT_TIME);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&sut));
+}
+
+TEST_F(Timer_test, TimerAttachedToListenerCallsCallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7ca7518-4048-445f-95a5-17818b7fa5b0");
+    constexpr uint64_t NUMBER_OF_PERIODS{3U};
+    ConditionVariableData listenerCondVar{"Zeitlupe"};
+    ListenerTest listener{listenerCondVar};
+    Timer sut(m_timerScheduler, SHORT_INTERVAL, TimerMode::PERIODIC);
+    ASSERT_FALSE(listener.attachEvent(sut, createNotificationCallback(Timer_test::callback)).has_error());
+    ASSERT_FALSE(sut.start().has_error());
+
+    while (m_callbackCounter.load() < NUMBER_OF_PERIODS)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    sut.stop();
+
+    EXPECT_THAT(m_callbackCounter.load(), Ge(NUMBER_OF_PERIODS));
+}
+
+TEST_F(Timer_test, TimersOfOneTimerSchedulerTriggerIndependently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfade547-a2cf-404f-bac9-e4ff57af7ab0");
+    Timer shortTimer(m_timerScheduler, SHORT_INTERVAL, TimerMode::ONE_SHOT);
+    Timer longTimer(m_timerScheduler, LONG_INTERVAL, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(shortTimer).has_error());
+    ASSERT_FALSE(m_waitSet.attachEvent(longTimer).has_error());
+    ASSERT_FALSE(longTimer.start().has_error());
+    ASSERT_FALSE(shortTimer.start().has_error());
+
+    auto notifications = m_waitSet.timedWait(MAX_WAIT_TIME);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&shortTimer));
+    EXPECT_TRUE(longTimer.isRunning());
+}
+
+} // namespace
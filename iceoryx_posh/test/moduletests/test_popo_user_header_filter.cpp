@@ -0,0 +1,216 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+struct TestUserHeader
+{
+    uint8_t priority{0U};
+    uint16_t channel{0U};
+    uint32_t flags{0U};
+    uint64_t timestamp{0U};
+};
+
+class UserHeaderFilter_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE,
+                                                         iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                         sizeof(TestUserHeader),
+                                                         alignof(TestUserHeader));
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        chunkHeader = new (storage) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+        userHeader = new (chunkHeader->userHeader()) TestUserHeader();
+
+        auto chunkSettingsWithoutUserHeaderResult =
+            ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsWithoutUserHeaderResult.has_error());
+        chunkHeaderWithoutUserHeader =
+            new (storageWithoutUserHeader) ChunkHeader(CHUNK_SIZE, chunkSettingsWithoutUserHeaderResult.value());
+    }
+
+    static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+    static constexpr uint32_t CHUNK_SIZE{1024U};
+    alignas(ChunkHeader) uint8_t storage[CHUNK_SIZE];
+    alignas(ChunkHeader) uint8_t storageWithoutUserHeader[CHUNK_SIZE];
+    ChunkHeader* chunkHeader{nullptr};
+    ChunkHeader* chunkHeaderWithoutUserHeader{nullptr};
+    TestUserHeader* userHeader{nullptr};
+
+    UserHeaderFilter sut;
+};
+
+TEST_F(UserHeaderFilter_test, FilterWithoutConditionsMatchesEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "24bc283a-e444-4645-b33e-640492dc7859");
+    EXPECT_FALSE(sut.hasConditions());
+    EXPECT_TRUE(sut.matches(*chunkHeader));
+    EXPECT_TRUE(sut.matches(*chunkHeaderWithoutUserHeader));
+}
+
+TEST_F(UserHeaderFilter_test, AddingConditionWithInvalidFieldSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f997a45d-e55e-4fbe-8bb8-cdafdfbd0ba0");
+    auto result = sut.addCondition(0U, 3U, UserHeaderFieldComparison::EQUAL, 0U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(UserHeaderFilterError::INVALID_FIELD_SIZE));
+    EXPECT_FALSE(sut.hasConditions());
+}
+
+TEST_F(UserHeaderFilter_test, AddingMoreThanMaxConditionsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c499d595-b07b-4ff4-b5a6-a2b94edcabf5");
+    for (uint64_t i = 0U; i < UserHeaderFilter::MAX_CONDITIONS; ++i)
+    {
+        EXPECT_FALSE(sut.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint8_t{0U}).has_error());
+    }
+
+    auto result = sut.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint8_t{0U});
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(UserHeaderFilterError::TOO_MANY_CONDITIONS));
+}
+
+TEST_F(UserHeaderFilter_test, EqualConditionMatchesOnlyEqualField)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b98ed545-b736-4dac-992b-0ec29dcd21ef");
+    ASSERT_FALSE(sut.addCondition(offsetof(TestUserHeader, channel), UserHeaderFieldComparison::EQUAL, uint16_t{42U})
+                     .has_error());
+
+    userHeader->channel = 42U;
+    EXPECT_TRUE(sut.matches(*chunkHeader));
+    userHeader->channel = 13U;
+    EXPECT_FALSE(sut.matches(*chunkHeader));
+}
+
+TEST_F(UserHeaderFilter_test, OrderingComparisonsAreEvaluatedCorrectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f70913fd-9313-423f-a159-17ba9d37dc32");
+    constexpr uint32_t OFFSET{offsetof(TestUserHeader, flags)};
+    constexpr uint32_t REFERENCE{100U};
+    userHeader->flags = REFERENCE;
+
+    auto evaluate = [&](const UserHeaderFieldComparison comparison) {
+        UserHeaderFilter filter;
+        EXPECT_FALSE(filter.addCondition(OFFSET, comparison, REFERENCE).has_error());
+        return filter.matches(*chunkHeader);
+    };
+
+    EXPECT_FALSE(evaluate(UserHeaderFieldComparison::NOT_EQUAL));
+    EXPECT_FALSE(evaluate(UserHeaderFieldComparison::LESS));
+    EXPECT_TRUE(evaluate(UserHeaderFieldComparison::LESS_OR_EQUAL));
+    EXPECT_FALSE(evaluate(UserHeaderFieldComparison::GREATER));
+    EXPECT_TRUE(evaluate(UserHeaderFieldComparison::GREATER_OR_EQUAL));
+
+    userHeader->flags = REFERENCE + 1U;
+    EXPECT_TRUE(evaluate(UserHeaderFieldComparison::NOT_EQUAL));
+    EXPECT_FALSE(evaluate(UserHeaderFieldComparison::LESS));
+    EXPECT_FALSE(evaluate(UserHeaderFieldComparison::LESS_OR_EQUAL));
+    EXPECT_TRUE(evaluate(UserHeaderFieldComparison::GREATER));
+    EXPECT_TRUE(evaluate(UserHeaderFieldComparison::GREATER_OR_EQUAL));
+}
+
+TEST_F(UserHeaderFilter_test, AllConditionsMustBeFulfilledForAMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae5360c3-2b3f-448f-babc-9a4e28883fac");
+    ASSERT_FALSE(
+        sut.addCondition(offsetof(TestUserHeader, priority), UserHeaderFieldComparison::GREATER, uint8_t{2U})
+            .has_error());
+    ASSERT_FALSE(
+        sut.addCondition(offsetof(TestUserHeader, timestamp), UserHeaderFieldComparison::LESS, uint64_t{1000U})
+            .has_error());
+
+    userHeader->priority = 3U;
+    userHeader->timestamp = 999U;
+    EXPECT_TRUE(sut.matches(*chunkHeader));
+
+    userHeader->timestamp = 1000U;
+    EXPECT_FALSE(sut.matches(*chunkHeader));
+
+    userHeader->priority = 2U;
+    userHeader->timestamp = 999U;
+    EXPECT_FALSE(sut.matches(*chunkHeader));
+}
+
+TEST_F(UserHeaderFilter_test, ConditionOnFieldOutsideOfUserHeaderDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2454793e-61f1-4371-b1fd-58e9d269c654");
+    ASSERT_FALSE(
+        sut.addCondition(sizeof(TestUserHeader) - 4U, UserHeaderFieldComparison::EQUAL, uint64_t{0U}).has_error());
+
+    EXPECT_FALSE(sut.matches(*chunkHeader));
+}
+
+TEST_F(UserHeaderFilter_test, ConditionOnChunkWithoutUserHeaderDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c142a34-c73f-4416-95fe-c3658eea1f3b");
+    ASSERT_FALSE(sut.addCondition(0U, UserHeaderFieldComparison::EQUAL, uint8_t{0U}).has_error());
+
+    EXPECT_FALSE(sut.matches(*chunkHeaderWithoutUserHeader));
+}
+
+TEST_F(UserHeaderFilter_test, SerializationRoundTripIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "193634e9-5ad3-448e-9bd2-57dfaf184f58");
+    ASSERT_FALSE(sut.addCondition(offsetof(TestUserHeader, channel), UserHeaderFieldComparison::NOT_EQUAL, uint16_t{7U})
+                     .has_error());
+    ASSERT_FALSE(sut.addCondition(offsetof(TestUserHeader, timestamp),
+                                  UserHeaderFieldComparison::GREATER_OR_EQUAL,
+                                  uint64_t{0xFFFFFFFFFFFFU})
+                     .has_error());
+
+    UserHeaderFilter::deserialize(sut.serialize())
+        .and_then([&](auto& roundTripFilter) { EXPECT_THAT(roundTripFilter, Eq(sut)); })
+        .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of UserHeaderFilter failed!"; });
+}
+
+TEST_F(UserHeaderFilter_test, DeserializingTooManyConditionsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e5c6712-adab-45ce-83a8-0377a888088d");
+    const auto serialized = iox::cxx::Serialization::create(UserHeaderFilter::MAX_CONDITIONS + 1U);
+    UserHeaderFilter::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+TEST_F(UserHeaderFilter_test, DeserializingInvalidComparisonFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49171704-5eba-4815-a042-59f0e7987cc4");
+    constexpr uint64_t NUMBER_OF_CONDITIONS{1U};
+    constexpr uint32_t OFFSET{0U};
+    constexpr uint32_t SIZE{1U};
+    constexpr std::underlying_type_t<UserHeaderFieldComparison> COMPARISON{111U};
+    constexpr uint64_t VALUE{0U};
+    const auto serialized = iox::cxx::Serialization::create(NUMBER_OF_CONDITIONS, OFFSET, SIZE, COMPARISON, VALUE);
+    UserHeaderFilter::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+} // namespace
@@ -27,6 +27,8 @@
 
 #include <chrono>
 #include <memory>
+#include <poll.h>
+#include <set>
 #include <thread>
 
 namespace
@@ -1174,6 +1176,69 @@ TEST_F(WaitSet_test, TimedWaitReturnsNothingWhenNothingTriggered)
     ASSERT_THAT(triggerVector.size(), Eq(0U));
 }
 
+TEST_F(WaitSet_test, WaitWithSpinningReturnsTheTriggeredConditionWithoutTheSpinDurationElapsing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ec16d02-b897-4212-9ac8-3298e4f4b826");
+    m_sut->setSpinDuration(10_s);
+    EXPECT_THAT(m_sut->getSpinDuration(), Eq(10_s));
+
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0U].trigger();
+    });
+
+    auto triggerVector = m_sut->wait();
+    t.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+}
+
+TEST_F(WaitSet_test, FileDescriptorBecomesReadableWhenAnEventIsTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64cca7d1-c56b-4d52-bfc1-7ae0f4323c53");
+    auto isReadable = [](const int32_t fd) {
+        pollfd pollFd{fd, POLLIN, 0};
+        return poll(&pollFd, 1U, 0) == 1;
+    };
+    auto fd = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+    EXPECT_FALSE(isReadable(fd.value()));
+
+    m_simpleEvents[0U].trigger();
+    ASSERT_TRUE(isReadable(fd.value()));
+
+    auto triggerVector = m_sut->timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(5U));
+    EXPECT_FALSE(isReadable(fd.value()));
+}
+
+TEST_F(WaitSet_test, FileDescriptorStaysReadableWhileNotificationsAreLeftDueToTheLimit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3b96075-aa10-4418-bf29-b1db7d49de46");
+    auto isReadable = [](const int32_t fd) {
+        pollfd pollFd{fd, POLLIN, 0};
+        return poll(&pollFd, 1U, 0) == 1;
+    };
+    auto fd = m_sut->getFileDescriptor();
+    ASSERT_FALSE(fd.has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 5U).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[1U], 6U).has_error());
+
+    m_simpleEvents[0U].trigger();
+    m_simpleEvents[1U].trigger();
+
+    iox::vector<const NotificationInfo*, 1U> notificationInfos;
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::zero(), notificationInfos), Eq(1U));
+    EXPECT_TRUE(isReadable(fd.value()));
+
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::zero(), notificationInfos), Eq(1U));
+    EXPECT_FALSE(isReadable(fd.value()));
+}
+
 void WaitReturnsTheOneTriggeredCondition(WaitSet_test* test,
                                          const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
@@ -1705,6 +1770,179 @@ TEST_F(WaitSet_test, MixingEventAndStateBasedTriggerHandlesEventTriggeresWithWai
     EXPECT_TRUE(doesNotificationInfoVectorContain(eventVector, 8171, m_simpleEvents[1]));
 }
 
+TEST_F(WaitSet_test, WaitWithProvidedVectorStoresAtMostItsCapacityAndReturnsTheRemainingNotificationsLater)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "651a4d2e-f514-444e-8468-e42e55d75866");
+    constexpr uint64_t NUMBER_OF_EVENTS{5U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i).has_error());
+        m_simpleEvents[i].trigger();
+    }
+
+    iox::vector<const NotificationInfo*, 2U> eventVector;
+    std::set<uint64_t> notificationIds;
+    auto collectNotificationIds = [&] {
+        for (const auto* notificationInfo : eventVector)
+        {
+            notificationIds.insert(notificationInfo->getNotificationId());
+        }
+    };
+
+    EXPECT_THAT(m_sut->wait(eventVector), Eq(2U));
+    EXPECT_THAT(eventVector.size(), Eq(2U));
+    collectNotificationIds();
+    EXPECT_THAT(m_sut->wait(eventVector), Eq(2U));
+    EXPECT_THAT(eventVector.size(), Eq(2U));
+    collectNotificationIds();
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::fromMilliseconds(1), eventVector), Eq(1U));
+    EXPECT_THAT(eventVector.size(), Eq(1U));
+    collectNotificationIds();
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::fromMilliseconds(1), eventVector), Eq(0U));
+    EXPECT_TRUE(eventVector.empty());
+
+    EXPECT_THAT(notificationIds, ElementsAre(0U, 1U, 2U, 3U, 4U));
+}
+
+TEST_F(WaitSet_test, ContinuouslyTriggeredConditionDoesNotStarveTheRemainingNotificationsWhenTheNumberIsLimited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22a4ec88-bc6d-4cd3-adb5-05e6cf2dd202");
+    constexpr uint64_t NUMBER_OF_EVENTS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i).has_error());
+        m_simpleEvents[i].trigger();
+    }
+
+    // the event which is processed first is triggered again before every wait
+    iox::vector<const NotificationInfo*, 1U> eventVector;
+    ASSERT_THAT(m_sut->wait(eventVector), Eq(1U));
+    const auto continuouslyTriggeredId = eventVector[0U]->getNotificationId();
+    std::set<uint64_t> notificationIds{continuouslyTriggeredId};
+    for (uint64_t i = 1U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        m_simpleEvents[continuouslyTriggeredId].trigger();
+        ASSERT_THAT(m_sut->wait(eventVector), Eq(1U));
+        notificationIds.insert(eventVector[0U]->getNotificationId());
+    }
+
+    EXPECT_THAT(notificationIds, ElementsAre(0U, 1U, 2U));
+}
+
+TEST_F(WaitSet_test, WaitWithCallbackIsCalledForEveryTriggeredCondition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12028cf5-b2db-4d1d-b547-72fade8fb753");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 3431).has_error());
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[1], 8171).has_error());
+    m_simpleEvents[1].m_autoResetTrigger = false;
+    m_simpleEvents[0].trigger();
+    m_simpleEvents[1].trigger();
+
+    std::set<uint64_t> notificationIds;
+    auto numberOfNotifications = m_sut->wait([&](const NotificationInfo& notificationInfo) {
+        const auto notificationId = notificationInfo.getNotificationId();
+        notificationIds.insert(notificationId);
+        EXPECT_TRUE(notificationInfo.doesOriginateFrom(&m_simpleEvents[(notificationId == 3431U) ? 0U : 1U]));
+    });
+
+    EXPECT_THAT(numberOfNotifications, Eq(2U));
+    EXPECT_THAT(notificationIds, ElementsAre(3431U, 8171U));
+}
+
+TEST_F(WaitSet_test, WaitWithCallbackHandsOutAtMostTheMaxNumberOfNotificationsAndTheRemainingOnesLater)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a9e0c3f-7763-4192-9537-3905a7921789");
+    constexpr uint64_t NUMBER_OF_EVENTS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i).has_error());
+        m_simpleEvents[i].trigger();
+    }
+
+    std::set<uint64_t> notificationIds;
+    auto collectNotificationId = [&](const NotificationInfo& notificationInfo) {
+        notificationIds.insert(notificationInfo.getNotificationId());
+    };
+
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        EXPECT_THAT(m_sut->wait(collectNotificationId, 1U), Eq(1U));
+        EXPECT_THAT(notificationIds.size(), Eq(i + 1U));
+    }
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::fromMilliseconds(1), collectNotificationId, 1U), Eq(0U));
+
+    EXPECT_THAT(notificationIds, ElementsAre(0U, 1U, 2U));
+}
+
+TEST_F(WaitSet_test, DetachingTheTriggeredConditionInTheWaitCallbackWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd6ceb24-5550-4f5f-b5cc-23d63607f419");
+    m_simpleEvents[0].m_autoResetTrigger = false;
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[0], 8171).has_error());
+    m_simpleEvents[0].trigger();
+
+    auto numberOfNotifications =
+        m_sut->wait([&](const NotificationInfo&) { m_sut->detachState(m_simpleEvents[0]); });
+
+    EXPECT_THAT(numberOfNotifications, Eq(1U));
+    EXPECT_THAT(m_sut->size(), Eq(0U));
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::fromMilliseconds(1)).size(), Eq(0U));
+}
+
+TEST_F(WaitSet_test, TriggeredConditionsAreReturnedInTheOrderOfTheirPriority)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4e326b2-a556-4865-ad3c-31533e4811f6");
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 0U, {}, 1U).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[1], 1U, {}, 3U).has_error());
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[2], 2U, {}).has_error());
+    ASSERT_FALSE(m_sut->attachState(m_simpleEvents[3], 3U, {}, 2U).has_error());
+    for (uint64_t i = 0U; i < 4U; ++i)
+    {
+        m_simpleEvents[i].m_autoResetTrigger = false;
+        m_simpleEvents[i].trigger();
+    }
+
+    auto eventVector = m_sut->wait();
+
+    ASSERT_THAT(eventVector.size(), Eq(4U));
+    EXPECT_THAT(eventVector[0]->getNotificationId(), Eq(1U));
+    EXPECT_THAT(eventVector[1]->getNotificationId(), Eq(3U));
+    EXPECT_THAT(eventVector[2]->getNotificationId(), Eq(0U));
+    EXPECT_THAT(eventVector[3]->getNotificationId(), Eq(2U));
+
+    // the non reset states are returned again in the order of their priority
+    eventVector = m_sut->timedWait(iox::units::Duration::fromMilliseconds(1));
+    ASSERT_THAT(eventVector.size(), Eq(2U));
+    EXPECT_THAT(eventVector[0]->getNotificationId(), Eq(3U));
+    EXPECT_THAT(eventVector[1]->getNotificationId(), Eq(2U));
+}
+
+TEST_F(WaitSet_test, WaitWithMaxNumberOfNotificationsHandsOutTheHighestPrioritiesFirst)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9276dd9-1c10-4a07-b4c4-178d61cea28f");
+    constexpr uint64_t NUMBER_OF_EVENTS{4U};
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        // the event with the lowest index has the highest priority
+        const auto priority = static_cast<NotificationPriority>(NUMBER_OF_EVENTS - i);
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], i, {}, priority).has_error());
+        m_simpleEvents[i].trigger();
+    }
+
+    std::vector<uint64_t> notificationIds;
+    auto collectNotificationId = [&](const NotificationInfo& notificationInfo) {
+        notificationIds.emplace_back(notificationInfo.getNotificationId());
+    };
+
+    for (uint64_t i = 0U; i < NUMBER_OF_EVENTS; ++i)
+    {
+        EXPECT_THAT(m_sut->wait(collectNotificationId, 1U), Eq(1U));
+    }
+    EXPECT_THAT(m_sut->timedWait(iox::units::Duration::fromMilliseconds(1), collectNotificationId), Eq(0U));
+
+    EXPECT_THAT(notificationIds, ElementsAre(0U, 1U, 2U, 3U));
+}
+
 TEST_F(WaitSet_test, WaitUnblocksAfterMarkForDestructionCall)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a7c0b153-65da-4603-bd82-5f5db5841a2b");
@@ -379,12 +379,17 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryDelta{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                              iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryDelta);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
+    internalServices.push_back(iox::roudi::IntrospectionPortHistogramService);
 
     // Added by ProcessManager
     internalServices.push_back(iox::roudi::IntrospectionMempoolService);
@@ -1131,6 +1136,154 @@ TEST(PoshRuntimeFactory_test, SetValidRuntimeFactorySucceeds)
     EXPECT_THAT(PoshRuntime::getInstance().getInstanceName().c_str(), StrEq(BRAIN_SLUG));
 }
 
+TEST_F(PoshRuntime_test, CreatePortsCreatesAllPortsOfTheBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4adce3e5-d2e3-42e5-a6ec-b7bb89f282b0");
+    const ServiceDescription publisherService{"Radar", "FrontLeft", "Object"};
+    const ServiceDescription subscriberService{"Vehicle", "Ego", "Speed"};
+    const ServiceDescription clientService{"Planner", "Ego", "Route"};
+    const ServiceDescription serverService{"Map", "Ego", "Tile"};
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 2U;
+
+    iox::runtime::PortBatch batch;
+    batch.addPublisher(publisherService, publisherOptions)
+        .addSubscriber(subscriberService)
+        .addClient(clientService)
+        .addServer(serverService)
+        .addConditionVariables(2U);
+
+    EXPECT_THAT(m_runtime->createPorts(batch), Eq(6U));
+
+    auto publisherPort = m_runtime->getMiddlewarePublisher(publisherService, publisherOptions);
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_THAT(publisherPort->m_chunkSenderData.m_historyCapacity, Eq(2U));
+    auto subscriberPort = m_runtime->getMiddlewareSubscriber(subscriberService);
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+    EXPECT_THAT(subscriberPort->m_serviceDescription, Eq(subscriberService));
+    auto clientPort = m_runtime->getMiddlewareClient(clientService);
+    ASSERT_THAT(clientPort, Ne(nullptr));
+    EXPECT_THAT(clientPort->m_serviceDescription, Eq(clientService));
+    auto serverPort = m_runtime->getMiddlewareServer(serverService);
+    ASSERT_THAT(serverPort, Ne(nullptr));
+    EXPECT_THAT(serverPort->m_serviceDescription, Eq(serverService));
+    auto firstConditionVariable = m_runtime->getMiddlewareConditionVariable();
+    auto secondConditionVariable = m_runtime->getMiddlewareConditionVariable();
+    EXPECT_THAT(firstConditionVariable, Ne(nullptr));
+    EXPECT_THAT(secondConditionVariable, Ne(nullptr));
+    EXPECT_THAT(firstConditionVariable, Ne(secondConditionVariable));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithMorePortsThanFitIntoOneMessageCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f11976db-475e-4196-b130-56341abdbfcd");
+    constexpr uint64_t NUMBER_OF_SUBSCRIBERS{3U * iox::MAX_CREATED_PORTS_PER_MESSAGE};
+    iox::runtime::PortBatch batch;
+    for (uint64_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        batch.addSubscriber(
+            {"Vehicle", "Ego", iox::capro::IdString_t(iox::TruncateToCapacity, std::to_string(i).c_str())});
+    }
+
+    EXPECT_THAT(m_runtime->createPorts(batch), Eq(NUMBER_OF_SUBSCRIBERS));
+
+    const iox::capro::IdString_t lastEvent{iox::TruncateToCapacity, std::to_string(NUMBER_OF_SUBSCRIBERS - 1U).c_str()};
+    auto subscriberPort = m_runtime->getMiddlewareSubscriber({"Vehicle", "Ego", lastEvent});
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsDoesNotCountPortsWhichCouldNotBeCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3d74c27-0776-4328-8e5b-fcde835b012d");
+    const ServiceDescription forbiddenService{
+        iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    iox::runtime::PortBatch batch;
+    batch.addPublisher(forbiddenService).addSubscriber({"Vehicle", "Ego", "Speed"});
+
+    EXPECT_THAT(m_runtime->createPorts(batch), Eq(1U));
+}
+
+TEST_F(PoshRuntime_test, PreCreatedSubscriberWithOtherOptionsIsNotReturnedButANewOneIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d3a0316-4546-4a16-a9b2-a83e7155e0b4");
+    const ServiceDescription subscriberService{"Vehicle", "Ego", "Speed"};
+    iox::popo::SubscriberOptions batchOptions;
+    batchOptions.queueCapacity = 2U;
+    iox::runtime::PortBatch batch;
+    batch.addSubscriber(subscriberService, batchOptions);
+    ASSERT_THAT(m_runtime->createPorts(batch), Eq(1U));
+
+    iox::popo::SubscriberOptions requestedOptions;
+    requestedOptions.queueCapacity = 3U;
+    auto requestedPort = m_runtime->getMiddlewareSubscriber(subscriberService, requestedOptions);
+    ASSERT_THAT(requestedPort, Ne(nullptr));
+    EXPECT_THAT(requestedPort->m_chunkReceiverData.m_queue.capacity(), Eq(3U));
+
+    // the pre-created port is still available for a call with its options
+    auto preCreatedPort = m_runtime->getMiddlewareSubscriber(subscriberService, batchOptions);
+    ASSERT_THAT(preCreatedPort, Ne(nullptr));
+    EXPECT_THAT(preCreatedPort->m_chunkReceiverData.m_queue.capacity(), Eq(2U));
+    EXPECT_THAT(preCreatedPort, Ne(requestedPort));
+}
+
+TEST_F(PoshRuntime_test, PreCreatedClientWithOtherNodeNameIsNotReturnedButANewOneIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "06bf51ee-476e-442f-9e6c-adbb5216d8e6");
+    const ServiceDescription clientService{"Planner", "Ego", "Route"};
+    iox::popo::ClientOptions batchOptions;
+    batchOptions.nodeName = "planner";
+    iox::runtime::PortBatch batch;
+    batch.addClient(clientService, batchOptions);
+    ASSERT_THAT(m_runtime->createPorts(batch), Eq(1U));
+
+    iox::popo::ClientOptions requestedOptions;
+    requestedOptions.nodeName = "router";
+    auto requestedPort = m_runtime->getMiddlewareClient(clientService, requestedOptions);
+    ASSERT_THAT(requestedPort, Ne(nullptr));
+    EXPECT_THAT(requestedPort->m_nodeName, Eq(requestedOptions.nodeName));
+
+    auto preCreatedPort = m_runtime->getMiddlewareClient(clientService, batchOptions);
+    ASSERT_THAT(preCreatedPort, Ne(nullptr));
+    EXPECT_THAT(preCreatedPort->m_nodeName, Eq(batchOptions.nodeName));
+    EXPECT_THAT(preCreatedPort, Ne(requestedPort));
+}
+
+TEST(PoshRuntimeManifest_test, ClaimedManifestPortsAreReturnedWithoutRequestingThemFromRouDi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "01e88635-4953-417d-a9af-882254e69e18");
+    const iox::RuntimeName_t runtimeName{"radar"};
+    const ServiceDescription publisherService{"Radar", "FrontLeft", "Object"};
+    const ServiceDescription subscriberService{"Vehicle", "Ego", "Speed"};
+
+    auto config = iox::RouDiConfig_t().setDefaults();
+    iox::config::ManifestPortEntry publisherEntry;
+    publisherEntry.m_portType = iox::config::ManifestPortEntry::PortType::PUBLISHER;
+    publisherEntry.m_runtimeName = runtimeName;
+    publisherEntry.m_serviceDescription = publisherService;
+    publisherEntry.m_publisherOptions.historyCapacity = 2U;
+    config.m_manifestPorts.emplace_back(publisherEntry);
+    iox::config::ManifestPortEntry subscriberEntry;
+    subscriberEntry.m_portType = iox::config::ManifestPortEntry::PortType::SUBSCRIBER;
+    subscriberEntry.m_runtimeName = runtimeName;
+    subscriberEntry.m_serviceDescription = subscriberService;
+    config.m_manifestPorts.emplace_back(subscriberEntry);
+    RouDiEnvironment roudiEnv{config};
+
+    auto& runtime = PoshRuntime::initRuntime(runtimeName);
+    EXPECT_THAT(runtime.claimManifestPorts(), Eq(2U));
+
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 2U;
+    auto publisherPort = runtime.getMiddlewarePublisher(publisherService, publisherOptions);
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_THAT(publisherPort->m_chunkSenderData.m_historyCapacity, Eq(2U));
+    auto subscriberPort = runtime.getMiddlewareSubscriber(subscriberService);
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+    EXPECT_THAT(subscriberPort->m_serviceDescription, Eq(subscriberService));
+
+    EXPECT_THAT(runtime.claimManifestPorts(), Eq(0U));
+}
+
 TEST(PoshRuntimeFactory_test, SetEmptyRuntimeFactoryFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "530ec778-b480-4a1e-8562-94f93cee2f5c");
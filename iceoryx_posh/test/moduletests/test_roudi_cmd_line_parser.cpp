@@ -36,7 +36,9 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
-           && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
+           && (lhs.processKillDelay == rhs.processKillDelay)
+           && (lhs.numberOfRuntimeMessagesThreads == rhs.numberOfRuntimeMessagesThreads)
+           && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
            && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
 }
 } // namespace config
@@ -346,6 +348,84 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsLongOptionLeadsToCorrectNumberOfThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcb4cb31-3e1c-446f-bd19-7a3493388b49");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-messages-threads";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessagesThreads, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsShortOptionLeadsToCorrectNumberOfThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1618324a-8331-4436-bd8a-19d8fb08166c");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-t";
+    char value[] = "2";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessagesThreads, 2U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsOptionOutOfBoundsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "851ecd9b-f76b-4831-a9f6-856460349a80");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-messages-threads";
+    char value[] = "17"; // MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessagesThreadsOptionWithZeroThreadsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63f5b26f-81c5-4f90-9547-449bd68feed0");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-t";
+    char value[] = "0";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
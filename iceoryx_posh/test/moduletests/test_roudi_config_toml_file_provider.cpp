@@ -103,6 +103,57 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
 #endif
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingManifestPortsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f1a6be4-5d2c-4b8e-9b61-3c7f2a9e84d5");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[publisher]]
+        runtime = "radar"
+        service = "Radar"
+        instance = "FrontLeft"
+        event = "Object"
+        history_capacity = 2
+
+        [[subscriber]]
+        runtime = "planner"
+        service = "Radar"
+        instance = "FrontLeft"
+        event = "Object"
+        node = "fusion"
+        queue_capacity = 16
+        history_request = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& manifestPorts = result.value().m_manifestPorts;
+    ASSERT_THAT(manifestPorts.size(), Eq(2U));
+    const iox::capro::ServiceDescription expectedService{"Radar", "FrontLeft", "Object"};
+
+    EXPECT_THAT(manifestPorts[0].m_portType, Eq(iox::config::ManifestPortEntry::PortType::PUBLISHER));
+    EXPECT_THAT(manifestPorts[0].m_runtimeName, Eq(iox::RuntimeName_t("radar")));
+    EXPECT_THAT(manifestPorts[0].m_serviceDescription, Eq(expectedService));
+    EXPECT_THAT(manifestPorts[0].m_publisherOptions.historyCapacity, Eq(2U));
+    EXPECT_THAT(manifestPorts[0].m_publisherOptions.nodeName, Eq(iox::NodeName_t("radar")));
+
+    EXPECT_THAT(manifestPorts[1].m_portType, Eq(iox::config::ManifestPortEntry::PortType::SUBSCRIBER));
+    EXPECT_THAT(manifestPorts[1].m_runtimeName, Eq(iox::RuntimeName_t("planner")));
+    EXPECT_THAT(manifestPorts[1].m_serviceDescription, Eq(expectedService));
+    EXPECT_THAT(manifestPorts[1].m_subscriberOptions.queueCapacity, Eq(16U));
+    EXPECT_THAT(manifestPorts[1].m_subscriberOptions.historyRequest, Eq(1U));
+    EXPECT_THAT(manifestPorts[1].m_subscriberOptions.nodeName, Eq(iox::NodeName_t("fusion")));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -186,6 +237,62 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+const std::string CONFIG_MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED = [] {
+    std::string config = R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+    )";
+    for (uint64_t i = 0; i <= iox::MAX_NUMBER_OF_MANIFEST_PORTS; ++i)
+    {
+        config.append("[[subscriber]]\n");
+        config.append("runtime = \"planner\"\n");
+        config.append("service = \"Radar\"\n");
+        config.append("instance = \"FrontLeft\"\n");
+        config.append("event = \"Object\"\n");
+    }
+
+    return config;
+}();
+
+constexpr const char* CONFIG_MANIFEST_PORT_WITHOUT_RUNTIME_NAME = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+
+    [[publisher]]
+    service = "Radar"
+    instance = "FrontLeft"
+    event = "Object"
+)";
+
+constexpr const char* CONFIG_MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+
+    [[subscriber]]
+    runtime = "planner"
+    service = "Radar"
+    event = "Object"
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -205,6 +312,12 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED,
+                                 CONFIG_MAX_NUMBER_OF_MANIFEST_PORTS_EXCEEDED},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MANIFEST_PORT_WITHOUT_RUNTIME_NAME,
+                                 CONFIG_MANIFEST_PORT_WITHOUT_RUNTIME_NAME},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION,
+                                 CONFIG_MANIFEST_PORT_WITHOUT_SERVICE_DESCRIPTION},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -35,6 +35,8 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortHistogramData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::updatePortHistograms;
 
     void sendThroughputData()
     {
@@ -48,6 +50,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortHistograms()
+    {
+        return this->m_publisherPortHistograms;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -64,6 +70,7 @@ class PortIntrospection_test : public Test
     void SetUp() override
     {
         ASSERT_THAT(m_introspectionAccess.registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                                std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection),
                                                                 std::move(m_mockPublisherPortUserIntrospection)),
                     Eq(true));
@@ -145,11 +152,13 @@ TEST_F(PortIntrospection_test, registerPublisherPort)
         new iox::roudi::PortIntrospection<MockPublisherPortUser, MockSubscriberPortUser>);
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection),
+                                                     std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection),
                                                      std::move(m_mockPublisherPortUserIntrospection)),
                 Eq(true));
 
     EXPECT_THAT(introspection->registerPublisherPort(std::move(m_mockPublisherPortUserIntrospection2),
+                                                     std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2),
                                                      std::move(m_mockPublisherPortUserIntrospection2)),
                 Eq(false));
@@ -443,6 +452,107 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, sendPortHistogramDataContainsAnEntryForEachPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c3f7b0e-2d59-4a8e-9f1c-8e4b5a7d2c61");
+    using Topic = iox::roudi::PortHistogramIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::capro::ServiceDescription publisherService("Laser", "Shark", "Pew");
+    iox::capro::ServiceDescription subscriberService("Laser", "Shark", "Pow");
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData publisherPortData(
+        publisherService, runtimeName, &memoryManager, iox::popo::PublisherOptions());
+    iox::popo::SubscriberPortData subscriberPortData{subscriberService,
+                                                     runtimeName,
+                                                     iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+    EXPECT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(true));
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendPortHistogramData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    EXPECT_THAT(chunk->sample()->m_publisherList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_subscriberList.size(), Eq(1U));
+
+    chunk->sample()->~PortHistogramIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, sendPortHistogramDataCountsThePortsBeyondTheCapacityAsOmitted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "283e21af-ea70-466f-91a6-c181c06efb69");
+    using Topic = iox::roudi::PortHistogramIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name"};
+    iox::capro::ServiceDescription service("Laser", "Shark", "Pew");
+    iox::mepoo::MemoryManager memoryManager;
+    const uint64_t capacity = chunk->sample()->m_publisherList.capacity();
+    std::vector<std::unique_ptr<iox::popo::PublisherPortData>> publisherPortData;
+    for (uint64_t i = 0U; i < capacity + 1U; ++i)
+    {
+        publisherPortData.emplace_back(new iox::popo::PublisherPortData(
+            service, runtimeName, &memoryManager, iox::popo::PublisherOptions()));
+        EXPECT_THAT(m_introspectionAccess.addPublisher(*publisherPortData.back()), Eq(true));
+    }
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.sendPortHistogramData();
+
+    EXPECT_THAT(chunk->sample()->m_publisherList.size(), Eq(capacity));
+    EXPECT_THAT(chunk->sample()->m_numberOfOmittedPorts, Eq(1U));
+
+    chunk->sample()->~PortHistogramIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, updatePortHistogramsDoesNotSendWithoutSubscribers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88c4f8c7-579c-4a9b-89a7-c70f8cc75d35");
+    ON_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), hasSubscribers()).WillByDefault(Return(false));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), tryAllocateChunk(_, _, _, _)).Times(0);
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), sendChunk(_)).Times(0);
+
+    m_introspectionAccess.updatePortHistograms();
+}
+
+TEST_F(PortIntrospection_test, updatePortHistogramsSendsWithSubscribers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6842e7ac-45b9-4727-bce4-5d6d8fcabdbe");
+    if (iox::roudi::MAX_PORT_HISTOGRAMS == 0U)
+    {
+        GTEST_SKIP() << "This test requires a -DIOX_MAX_PORT_HISTOGRAMS greater than 0 cmake argument";
+    }
+    using Topic = iox::roudi::PortHistogramIntrospectionFieldTopic;
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), hasSubscribers()).WillOnce(Return(true));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortHistograms().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.updatePortHistograms();
+
+    chunk->sample()->~PortHistogramIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
@@ -17,6 +17,7 @@
 
 #include "iceoryx_dust/cxx/std_string_support.hpp"
 #include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "test_roudi_portmanager_fixture.hpp"
 
 namespace iox_test_roudi_portmanager
@@ -61,6 +62,38 @@ TEST_F(PortManager_test, DoDiscoveryWithSingleShotPublisherFirst)
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, FullDiscoveryConnectsPortsWhoseDiscoveryRequestWasLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0f5aa2f-e8b8-4e27-a938-9a25ebf4c9e8");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    m_portManager->doDiscovery();
+
+    publisher.offer();
+    subscriber.subscribe();
+    // the marks of the ports are collected without processing them, like a discovery request which got lost
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    IOX_DISCARD_RESULT(portPool->getDirtyPublisherPortDataList());
+    IOX_DISCARD_RESULT(portPool->getDirtySubscriberPortDataList());
+    m_portManager->doDiscovery();
+    ASSERT_FALSE(publisher.hasSubscribers());
+
+    m_portManager->requestFullDiscovery();
+    m_portManager->doDiscovery();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithSingleShotSubscriberFirst)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bef1fc7f-3661-4dcc-98dd-fbf951ed275c");
@@ -387,6 +420,21 @@ TEST_F(PortManager_test, AcquiringOneMoreThanMaximumNumberOfSubscribersFails)
     }
 }
 
+TEST_F(PortManager_test, AcquiringPortHistogramSubscriberLimitsTheQueueCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ec4bf2d-74ba-481a-b5fd-f54351b35724");
+    SubscriberOptions subscriberOptions{PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY + 1U, 1U, iox::NodeName_t("node")};
+
+    auto maybeSubscriberPortData = m_portManager->acquireSubscriberPortData(
+        IntrospectionPortHistogramService, subscriberOptions, "schlomo", PortConfigInfo());
+    ASSERT_FALSE(maybeSubscriberPortData.has_error());
+
+    auto subscriberPortData = maybeSubscriberPortData.value();
+    EXPECT_THAT(subscriberPortData->m_chunkReceiverData.m_queue.capacity(),
+                Eq(PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY));
+    EXPECT_THAT(subscriberPortData->m_options.queueCapacity, Eq(PORT_HISTOGRAM_SUBSCRIBER_QUEUE_CAPACITY));
+}
+
 TEST_F(PortManager_test, AcquiringOneMoreThanMaximumNumberOfInterfacesFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "129706cc-18e5-4457-b314-d6b7ae347ea0");
@@ -1006,4 +1054,239 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+iox::config::ManifestPortEntry manifestPort(const iox::config::ManifestPortEntry::PortType portType,
+                                            const iox::RuntimeName_t& runtimeName,
+                                            const ServiceDescription& service)
+{
+    iox::config::ManifestPortEntry entry;
+    entry.m_portType = portType;
+    entry.m_runtimeName = runtimeName;
+    entry.m_serviceDescription = service;
+    return entry;
+}
+
+TEST_F(PortManager_test, AddingManifestPortsCreatesAndConnectsPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "abfc14b2-f87f-422f-b20a-676f916c3d5f");
+    const ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    iox::config::RouDiConfig::ManifestPorts_t manifestPorts;
+    manifestPorts.emplace_back(manifestPort(iox::config::ManifestPortEntry::PortType::PUBLISHER, "radar", service));
+    manifestPorts.emplace_back(manifestPort(iox::config::ManifestPortEntry::PortType::SUBSCRIBER, "planner", service));
+
+    m_portManager->addManifestPorts(manifestPorts, m_payloadDataSegmentMemoryManager);
+
+    auto radarPorts = m_portManager->claimManifestPorts("radar", m_payloadDataSegmentMemoryManager);
+    auto plannerPorts = m_portManager->claimManifestPorts("planner", m_payloadDataSegmentMemoryManager);
+    ASSERT_THAT(radarPorts.m_publishers.size(), Eq(1U));
+    EXPECT_THAT(radarPorts.m_subscribers.size(), Eq(0U));
+    EXPECT_FALSE(radarPorts.m_hasMore);
+    EXPECT_THAT(plannerPorts.m_publishers.size(), Eq(0U));
+    ASSERT_THAT(plannerPorts.m_subscribers.size(), Eq(1U));
+    EXPECT_FALSE(plannerPorts.m_hasMore);
+
+    PublisherPortUser publisher(radarPorts.m_publishers[0]);
+    SubscriberPortUser subscriber(plannerPorts.m_subscribers[0]);
+    EXPECT_THAT(publisher.getCaProServiceDescription(), Eq(service));
+    EXPECT_THAT(subscriber.getCaProServiceDescription(), Eq(service));
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, ManifestPortsAreClaimedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b92dcce-6fbd-4cc8-b186-bd77b823d8c5");
+    iox::config::RouDiConfig::ManifestPorts_t manifestPorts;
+    manifestPorts.emplace_back(
+        manifestPort(iox::config::ManifestPortEntry::PortType::PUBLISHER, m_runtimeName, getUniqueSD()));
+    manifestPorts.emplace_back(
+        manifestPort(iox::config::ManifestPortEntry::PortType::SUBSCRIBER, m_runtimeName, getUniqueSD()));
+    m_portManager->addManifestPorts(manifestPorts, m_payloadDataSegmentMemoryManager);
+
+    auto firstClaim = m_portManager->claimManifestPorts(m_runtimeName, m_payloadDataSegmentMemoryManager);
+    auto secondClaim = m_portManager->claimManifestPorts(m_runtimeName, m_payloadDataSegmentMemoryManager);
+
+    EXPECT_THAT(firstClaim.m_publishers.size(), Eq(1U));
+    EXPECT_THAT(firstClaim.m_subscribers.size(), Eq(1U));
+    EXPECT_THAT(secondClaim.m_publishers.size(), Eq(0U));
+    EXPECT_THAT(secondClaim.m_subscribers.size(), Eq(0U));
+    EXPECT_FALSE(secondClaim.m_hasMore);
+}
+
+TEST_F(PortManager_test, ClaimingMoreManifestPortsThanFitIntoOneMessageRequiresMultipleClaims)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbe51074-46d8-415b-8fdf-2dc7c8132f0c");
+    constexpr uint64_t NUMBER_OF_PORTS{iox::MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE + 1U};
+    iox::config::RouDiConfig::ManifestPorts_t manifestPorts;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        manifestPorts.emplace_back(
+            manifestPort(iox::config::ManifestPortEntry::PortType::SUBSCRIBER, m_runtimeName, getUniqueSD()));
+    }
+    m_portManager->addManifestPorts(manifestPorts, m_payloadDataSegmentMemoryManager);
+
+    auto firstClaim = m_portManager->claimManifestPorts(m_runtimeName, m_payloadDataSegmentMemoryManager);
+    EXPECT_THAT(firstClaim.m_subscribers.size(), Eq(iox::MAX_CLAIMED_MANIFEST_PORTS_PER_MESSAGE));
+    EXPECT_TRUE(firstClaim.m_hasMore);
+
+    auto secondClaim = m_portManager->claimManifestPorts(m_runtimeName, m_payloadDataSegmentMemoryManager);
+    EXPECT_THAT(secondClaim.m_subscribers.size(), Eq(1U));
+    EXPECT_FALSE(secondClaim.m_hasMore);
+}
+
+TEST_F(PortManager_test, ClaimingManifestPublisherWithoutAccessToItsSegmentDestroysIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "286f84c8-9926-43d9-beb0-f87e540c6b13");
+    const ServiceDescription service{"Radar", "FrontLeft", "Object"};
+    iox::config::RouDiConfig::ManifestPorts_t manifestPorts;
+    manifestPorts.emplace_back(manifestPort(iox::config::ManifestPortEntry::PortType::PUBLISHER, "radar", service));
+    m_portManager->addManifestPorts(manifestPorts, m_payloadDataSegmentMemoryManager);
+
+    auto radarPorts = m_portManager->claimManifestPorts("radar", nullptr);
+
+    EXPECT_THAT(radarPorts.m_publishers.size(), Eq(0U));
+    uint64_t publisherCount{0U};
+    m_portManager->serviceRegistry().find(
+        service.getServiceIDString(),
+        service.getInstanceIDString(),
+        service.getEventIDString(),
+        [&](const auto& entry) { publisherCount += entry.publisherCount; });
+    EXPECT_THAT(publisherCount, Eq(0U));
+}
+
+namespace
+{
+uint32_t numberOfUsedChunks(const iox::mepoo::MemoryManager& memoryManager)
+{
+    uint32_t usedChunks{0U};
+    for (uint32_t i = 0U; i < memoryManager.getNumberOfMemPools(); ++i)
+    {
+        usedChunks += memoryManager.getMemPoolInfo(i).m_usedChunks;
+    }
+    return usedChunks;
+}
+} // namespace
+
+TEST_F(PortManager_test, ChunksOfDeletedPortsAreReleasedWithTheNextDiscoveryRun)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f79e75a0-540e-4310-a72d-12b42adcf5ad");
+    const iox::RuntimeName_t runtimeName{"terminator"};
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData({"1", "1", "1"},
+                                                               publisherOptions,
+                                                               runtimeName,
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+
+    auto sentChunk = publisher.tryAllocateChunk(42U, 8U);
+    ASSERT_FALSE(sentChunk.has_error());
+    publisher.sendChunk(sentChunk.value());
+    ASSERT_FALSE(publisher.tryAllocateChunk(42U, 8U).has_error());
+    ASSERT_THAT(numberOfUsedChunks(*m_payloadDataSegmentMemoryManager), Eq(2U));
+
+    m_portManager->deletePortsOfProcess(runtimeName);
+
+    EXPECT_FALSE(publisher.isOffered());
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(1U));
+    EXPECT_THAT(numberOfUsedChunks(*m_payloadDataSegmentMemoryManager), Eq(2U));
+
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(0U));
+    EXPECT_THAT(numberOfUsedChunks(*m_payloadDataSegmentMemoryManager), Eq(0U));
+}
+
+TEST_F(PortManager_test, DiscoveryRunReclaimsOnlyALimitedNumberOfDeletedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9217b200-f46f-4a6b-9b82-01e2e50d8e48");
+    const iox::RuntimeName_t runtimeName{"terminator"};
+    constexpr uint64_t NUMBER_OF_PORTS{PortManager::MAX_PORTS_RECLAIMED_PER_DISCOVERY_RUN + 1U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        ASSERT_FALSE(
+            m_portManager->acquireSubscriberPortData(getUniqueSD(), SubscriberOptions(), runtimeName, PortConfigInfo())
+                .has_error());
+    }
+
+    m_portManager->deletePortsOfProcess(runtimeName);
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(NUMBER_OF_PORTS));
+
+    m_portManager->doDiscovery();
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(1U));
+
+    m_portManager->doDiscovery();
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(0U));
+}
+
+TEST_F(PortManager_test, LargeReclamationBacklogDrainsWithoutFurtherDiscoveryRequestsOfThePorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f377b8c1-273d-4d33-8c1d-648879458ac8");
+    const iox::RuntimeName_t runtimeName{"terminator"};
+    constexpr uint64_t NUMBER_OF_PORTS{3U * PortManager::MAX_PORTS_RECLAIMED_PER_DISCOVERY_RUN + 1U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        ASSERT_FALSE(
+            m_portManager->acquireSubscriberPortData(getUniqueSD(), SubscriberOptions(), runtimeName, PortConfigInfo())
+                .has_error());
+    }
+    // the discovery runs like in RouDi only when it is notified
+    iox::popo::ConditionListener discoveryListener(m_portManager->getDiscoveryConditionVariableData());
+    m_portManager->doDiscovery();
+    IOX_DISCARD_RESULT(discoveryListener.timedWait(iox::units::Duration::zero()));
+
+    m_portManager->deletePortsOfProcess(runtimeName);
+
+    uint64_t numberOfDiscoveryRuns{0U};
+    auto isDiscoveryRequested = [&] { return !discoveryListener.timedWait(iox::units::Duration::zero()).empty(); };
+    while (numberOfDiscoveryRuns < NUMBER_OF_PORTS && isDiscoveryRequested())
+    {
+        m_portManager->doDiscovery();
+        ++numberOfDiscoveryRuns;
+    }
+
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(0U));
+    EXPECT_THAT(numberOfDiscoveryRuns, Eq(4U));
+}
+
+TEST_F(PortManager_test, DeletedPortIsNotConnectedToNewPortsBeforeItIsReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc783be6-4498-4247-ba16-bcc90a3e83c5");
+    const iox::RuntimeName_t runtimeName{"terminator"};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+    ASSERT_FALSE(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, runtimeName, PortConfigInfo())
+            .has_error());
+
+    m_portManager->deletePortsOfProcess(runtimeName);
+    auto publisher = createPublisher(PublisherOptions());
+    publisher.offer();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, PortsOfRestartedRuntimeWhichAreDeletedBeforeReclamationAreReclaimedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f95c97ec-578b-4a92-a44a-1ec71c3c8a7a");
+    const iox::RuntimeName_t runtimeName{"terminator"};
+    const iox::capro::ServiceDescription service{"1", "1", "1"};
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        ASSERT_FALSE(m_portManager
+                         ->acquirePublisherPortData(service,
+                                                    PublisherOptions(),
+                                                    runtimeName,
+                                                    m_payloadDataSegmentMemoryManager,
+                                                    PortConfigInfo())
+                         .has_error());
+        m_portManager->deletePortsOfProcess(runtimeName);
+    }
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(2U));
+
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(m_portManager->numberOfPortsToReclaim(), Eq(0U));
+}
+
 } // namespace iox_test_roudi_portmanager
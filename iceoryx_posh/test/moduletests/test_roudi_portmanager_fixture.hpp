@@ -61,6 +61,7 @@ class PortManagerTester : public PortManager
     FRIEND_TEST(PortManager_test, CreateServerWithOfferOnCreateAddsServerToServiceRegistry);
     FRIEND_TEST(PortManager_test, StopOfferRemovesServerFromServiceRegistry);
     FRIEND_TEST(PortManager_test, OfferAddsServerToServiceRegistry);
+    FRIEND_TEST(PortManager_test, ClaimingManifestPublisherWithoutAccessToItsSegmentDestroysIt);
 };
 
 class PortManager_test : public Test
@@ -77,6 +78,8 @@ class PortManager_test : public Test
     vector<iox::capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const capro::ServiceDescription serviceRegistry{
         SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME};
+    const capro::ServiceDescription serviceRegistryDelta{
+        SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME};
 
     void SetUp() override
     {
@@ -111,9 +114,11 @@ class PortManager_test : public Test
     void addInternalPublisherOfPortManagerToVector()
     {
         internalServices.push_back(serviceRegistry);
+        internalServices.push_back(serviceRegistryDelta);
         internalServices.push_back(IntrospectionPortService);
         internalServices.push_back(IntrospectionPortThroughputService);
         internalServices.push_back(IntrospectionSubscriberPortChangingDataService);
+        internalServices.push_back(IntrospectionPortHistogramService);
     }
 
     iox::capro::ServiceDescription getUniqueSD()
@@ -17,6 +17,9 @@
 
 #include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_dust/cxx/std_string_support.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
@@ -325,6 +328,113 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, AddPublisherPortNotifiesDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6312243b-2be0-489d-a846-af1ee7eb4a7a");
+    popo::ConditionListener discoveryListener(sut.getDiscoveryConditionVariableData());
+
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+
+    ASSERT_FALSE(publisherPort.has_error());
+    EXPECT_TRUE(discoveryListener.wasNotified());
+}
+
+TEST_F(PortPool_test, OfferOfAddedPublisherPortNotifiesDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46d0636b-21a8-4aa9-a3e1-f101b214601b");
+    popo::ConditionListener discoveryListener(sut.getDiscoveryConditionVariableData());
+    m_publisherOptions.offerOnCreate = false;
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+    discoveryListener.wait();
+    ASSERT_FALSE(discoveryListener.wasNotified());
+
+    popo::PublisherPortUser(publisherPort.value()).offer();
+
+    EXPECT_TRUE(discoveryListener.wasNotified());
+}
+
+TEST_F(PortPool_test, GetDirtyPublisherPortDataListContainsAddedPortOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66d8669b-a666-45f7-a482-19c18ab708d5");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    auto dirtyPublisherPorts = sut.getDirtyPublisherPortDataList();
+    ASSERT_THAT(dirtyPublisherPorts.size(), Eq(1U));
+    EXPECT_THAT(dirtyPublisherPorts[0], Eq(publisherPort.value()));
+    EXPECT_THAT(sut.getDirtyPublisherPortDataList().size(), Eq(0U));
+}
+
+TEST_F(PortPool_test, GetDirtyPublisherPortDataListContainsOnlyPortsWithStateChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ea69c9a-2387-4073-b2fb-ff4f40cae2eb");
+    m_publisherOptions.offerOnCreate = false;
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+    sut.getDirtyPublisherPortDataList();
+
+    popo::PublisherPortUser(publisherPort2.value()).offer();
+
+    auto dirtyPublisherPorts = sut.getDirtyPublisherPortDataList();
+    ASSERT_THAT(dirtyPublisherPorts.size(), Eq(1U));
+    EXPECT_THAT(dirtyPublisherPorts[0], Eq(publisherPort2.value()));
+}
+
+TEST_F(PortPool_test, GetDirtyPublisherPortDataListDoesNotContainRemovedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d7e4b8a-5f2c-4f0e-9c55-0a3f6b1e2d94");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    sut.removePublisherPort(publisherPort.value());
+
+    EXPECT_THAT(sut.getDirtyPublisherPortDataList().size(), Eq(0U));
+}
+
+TEST_F(PortPool_test, GetPublisherPortDataListOfServiceContainsOnlyPortsWithThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e49ad9fd-f8f0-4ae3-addc-1c63912d9fd6");
+    const ServiceDescription otherServiceDescription{"service2", "instance1", "event1"};
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(otherServiceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort3 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+    ASSERT_FALSE(publisherPort3.has_error());
+
+    EXPECT_THAT(sut.getPublisherPortDataListOfService(m_serviceDescription),
+                ElementsAre(publisherPort1.value(), publisherPort3.value()));
+    EXPECT_THAT(sut.getPublisherPortDataListOfService(otherServiceDescription), ElementsAre(publisherPort2.value()));
+    EXPECT_THAT(sut.getPublisherPortDataListOfService({"unknown", "instance1", "event1"}), IsEmpty());
+}
+
+TEST_F(PortPool_test, GetPublisherPortDataListOfServiceDoesNotContainRemovedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6e88cd8-49e1-4e46-81bd-4e97f757a21b");
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+
+    sut.removePublisherPort(publisherPort1.value());
+
+    EXPECT_THAT(sut.getPublisherPortDataListOfService(m_serviceDescription), ElementsAre(publisherPort2.value()));
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -451,6 +561,32 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(subscriberPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, UnsubscribeOfAddedSubscriberPortNotifiesDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47e92ced-178c-4f41-921c-29c507f148df");
+    popo::ConditionListener discoveryListener(sut.getDiscoveryConditionVariableData());
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+    discoveryListener.wait();
+    ASSERT_FALSE(discoveryListener.wasNotified());
+
+    popo::SubscriberPortUser(subscriberPort.value()).unsubscribe();
+
+    EXPECT_TRUE(discoveryListener.wasNotified());
+}
+
+TEST_F(PortPool_test, GetSubscriberPortDataListOfServiceContainsOnlyPortsWithThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31f2aef3-a064-446b-8e81-d4558b090623");
+    auto subscriberPort1 = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    auto subscriberPort2 =
+        sut.addSubscriberPort({"service2", "instance1", "event1"}, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort1.has_error());
+    ASSERT_FALSE(subscriberPort2.has_error());
+
+    EXPECT_THAT(sut.getSubscriberPortDataListOfService(m_serviceDescription), ElementsAre(subscriberPort1.value()));
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
@@ -667,6 +803,18 @@ TEST_F(PortPool_test, RemoveServerPortIsSuccessful)
     EXPECT_EQ(serverPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetServerPortDataListOfServiceDoesNotContainRemovedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f6ba9ad-021b-4d2b-b1e9-709c9ea5dd0f");
+    auto serverPort = sut.addServerPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_serverOptions);
+    ASSERT_FALSE(serverPort.has_error());
+    ASSERT_THAT(sut.getServerPortDataListOfService(m_serviceDescription), ElementsAre(serverPort.value()));
+
+    sut.removeServerPort(serverPort.value());
+
+    EXPECT_THAT(sut.getServerPortDataListOfService(m_serviceDescription), IsEmpty());
+}
+
 // END ServerPort tests
 
 // BEGIN InterfacePort tests
@@ -110,13 +110,19 @@ TEST_F(Process_test, sendViaIpcChannelFail)
                 Eq(iox::PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED));
 }
 
-TEST_F(Process_test, TimeStamp)
+TEST_F(Process_test, ProcessWithoutHeartbeatReturnsNullptr)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "5b527de2-699e-4d35-86ee-10ed28498e88");
-    auto timestmp = iox::mepoo::BaseClock_t::now();
+    ::testing::Test::RecordProperty("TEST_ID", "a56ea64e-67a4-4658-9fd2-de7217e36bcc");
     Process roudiproc(processname, pid, user, isMonitored, sessionId);
-    roudiproc.setTimestamp(timestmp);
-    EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(nullptr));
+}
+
+TEST_F(Process_test, ProcessWithHeartbeatReturnsHeartbeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a0e13ab-1380-4e7b-b51f-b38e38febf05");
+    Heartbeat heartbeat;
+    Process roudiproc(processname, pid, user, isMonitored, sessionId, &heartbeat);
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(&heartbeat));
 }
 
 } // namespace
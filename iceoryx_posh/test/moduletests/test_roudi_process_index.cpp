@@ -0,0 +1,166 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/process_index.hpp"
+
+#include "test.hpp"
+
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::RuntimeName_t;
+
+class ProcessIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{64U};
+
+    static RuntimeName_t name(const uint64_t index)
+    {
+        return RuntimeName_t(iox::TruncateToCapacity, ("process" + std::to_string(index)).c_str());
+    }
+
+    ProcessIndex<uint64_t, CAPACITY> sut;
+};
+
+constexpr uint64_t ProcessIndex_test::CAPACITY;
+
+TEST_F(ProcessIndex_test, EmptyIndexDoesNotContainAnyName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93b5d01f-0432-4026-8d60-05128f0a71cd");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_FALSE(sut.find(name(0U)).has_value());
+}
+
+TEST_F(ProcessIndex_test, InsertedNamesAreFoundWithTheirValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7bc7fee8-e78f-4911-a544-9fdd5303bd39");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.insert(name(i), i));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto value = sut.find(name(i));
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value.value(), Eq(i));
+    }
+}
+
+TEST_F(ProcessIndex_test, InsertingAnAlreadyContainedNameFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75ff8d15-458c-42cf-9687-d7bc6c8bd945");
+    EXPECT_TRUE(sut.insert(name(0U), 13U));
+
+    EXPECT_FALSE(sut.insert(name(0U), 42U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+    ASSERT_TRUE(sut.find(name(0U)).has_value());
+    EXPECT_THAT(sut.find(name(0U)).value(), Eq(13U));
+}
+
+TEST_F(ProcessIndex_test, InsertingIntoFullIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dad8341d-6e52-4858-837d-d5859cd6b23b");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(name(i), i));
+    }
+
+    EXPECT_FALSE(sut.insert(name(CAPACITY), CAPACITY));
+    EXPECT_FALSE(sut.find(name(CAPACITY)).has_value());
+}
+
+TEST_F(ProcessIndex_test, RemovedNamesAreNotFoundWhileTheRemainingNamesAreStillFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f374974e-4e58-44cb-a078-08304730c627");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(name(i), i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        EXPECT_TRUE(sut.remove(name(i)));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY / 2U));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto value = sut.find(name(i));
+        if (i % 2U == 0U)
+        {
+            EXPECT_FALSE(value.has_value());
+        }
+        else
+        {
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(value.value(), Eq(i));
+        }
+    }
+}
+
+TEST_F(ProcessIndex_test, RemovingNotContainedNameFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c13baf26-9f7c-4e00-b402-d2bcd3c2f16f");
+    ASSERT_TRUE(sut.insert(name(0U), 0U));
+
+    EXPECT_FALSE(sut.remove(name(1U)));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(ProcessIndex_test, NamesCanBeInsertedAgainAfterTheyWereRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbf194c7-5009-4608-8fda-db3b4032f947");
+    for (uint64_t round = 0U; round < 3U; ++round)
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.insert(name(i), i + round));
+        }
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            auto value = sut.find(name(i));
+            ASSERT_TRUE(value.has_value());
+            EXPECT_THAT(value.value(), Eq(i + round));
+            ASSERT_TRUE(sut.remove(name(i)));
+        }
+        EXPECT_THAT(sut.size(), Eq(0U));
+    }
+}
+
+TEST_F(ProcessIndex_test, ClearRemovesAllNames)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ef1c8e9-a457-4013-bf2a-d1638e996fb3");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(name(i), i));
+    }
+
+    sut.clear();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_FALSE(sut.find(name(i)).has_value());
+    }
+}
+
+} // namespace
@@ -14,9 +14,13 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/signal.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
@@ -27,6 +31,10 @@
 #include "iox/string.hpp"
 #include "test.hpp"
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -107,6 +115,70 @@ TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithoutMonitoringWorks)
     EXPECT_TRUE(result2);
 }
 
+TEST_F(ProcessManager_test, RegisterProcessWithMonitoringSendsHeartbeatWithRegAck)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44733d47-a3f8-4fa9-a65b-07e54649b73e");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    IpcMessage regAck;
+    ASSERT_TRUE(m_processIpcInterface.timedReceive(iox::units::Duration::fromSeconds(1), regAck));
+    ASSERT_THAT(regAck.getNumberOfElements(), Eq(7U));
+    bool isMonitored{false};
+    ASSERT_TRUE(iox::cxx::convert::fromString(regAck.getElementAtIndex(5U).c_str(), isMonitored));
+    EXPECT_TRUE(isMonitored);
+    iox::UntypedRelativePointer::offset_t heartbeatOffset{0U};
+    ASSERT_TRUE(iox::cxx::convert::fromString(regAck.getElementAtIndex(6U).c_str(), heartbeatOffset));
+    auto mgmtSegmentId = m_roudiMemoryManager->mgmtMemoryProvider()->segmentId();
+    ASSERT_TRUE(mgmtSegmentId.has_value());
+    auto heartbeat = iox::RelativePointer<Heartbeat>::getPtr(iox::segment_id_t{mgmtSegmentId.value()}, heartbeatOffset);
+    ASSERT_THAT(heartbeat, Ne(nullptr));
+    EXPECT_THAT(heartbeat->elapsedMillisecondsSinceLastBeat(), Lt(PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds()));
+}
+
+TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringSendsRegAckWithoutHeartbeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99f4b7ba-d850-498d-b5bb-4ad0083bae0f");
+    constexpr bool isNotMonitored{false};
+    m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
+
+    IpcMessage regAck;
+    ASSERT_TRUE(m_processIpcInterface.timedReceive(iox::units::Duration::fromSeconds(1), regAck));
+    ASSERT_THAT(regAck.getNumberOfElements(), Eq(7U));
+    bool isMonitored{true};
+    ASSERT_TRUE(iox::cxx::convert::fromString(regAck.getElementAtIndex(5U).c_str(), isMonitored));
+    EXPECT_FALSE(isMonitored);
+}
+
+#if defined(__linux__)
+TEST_F(ProcessManager_test, TerminatedMonitoredProcessIsRemovedWithoutWaitingForHeartbeatTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99e40cfa-e4f9-4492-a499-45bc9fbd721a");
+    if (!m_sut->isProcessTerminationMonitoringAvailable())
+    {
+        GTEST_SKIP() << "pidfds are not supported on this system";
+    }
+
+    auto childPid = fork();
+    if (childPid == 0)
+    {
+        // the child does nothing until it is killed
+        while (true)
+        {
+            pause();
+        }
+    }
+    ASSERT_THAT(childPid, Gt(0));
+    ASSERT_TRUE(m_sut->registerProcess(
+        m_processname, static_cast<uint32_t>(childPid), m_user, m_isMonitored, 1U, 1U, m_versionInfo));
+
+    kill(childPid, SIGKILL);
+    m_sut->monitorProcessTerminations(iox::units::Duration::fromSeconds(5));
+    waitpid(childPid, nullptr, 0);
+
+    EXPECT_FALSE(m_sut->unregisterProcess(m_processname));
+}
+#endif
+
 TEST_F(ProcessManager_test, UnregisterNonExistentProcessLeadsToError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "293cc3d1-727c-40ee-a298-3532a9e111a1");
@@ -157,4 +229,52 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, ConcurrentRegistrationAndPortCreationOfProcessesWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c4f527b-60da-434d-a23c-565e718efa0a");
+    constexpr uint32_t NUMBER_OF_PROCESSES{4U};
+    constexpr bool isNotMonitored{false};
+
+    std::vector<iox::RuntimeName_t> processNames;
+    std::vector<std::unique_ptr<IpcInterfaceCreator>> processIpcInterfaces;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        processNames.emplace_back(iox::TruncateToCapacity, ("ConcurrentProcess" + std::to_string(i)).c_str());
+        processIpcInterfaces.emplace_back(std::make_unique<IpcInterfaceCreator>(processNames.back()));
+    }
+
+    // the messages of the runtimes are handled concurrently by RouDi, therefore the ProcessManager is used from
+    // multiple threads at once
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        threads.emplace_back([&, i] {
+            EXPECT_TRUE(m_sut->registerProcess(
+                processNames[i], m_pid + i, m_user, isNotMonitored, 1U, i + 1U, m_versionInfo));
+            m_sut->addPublisherForProcess(processNames[i],
+                                          {"Concurrent", iox::capro::IdString_t(iox::TruncateToCapacity,
+                                                                                std::to_string(i).c_str()),
+                                           "Event"},
+                                          PublisherOptions(),
+                                          PortConfigInfo());
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto& processIpcInterface : processIpcInterfaces)
+    {
+        IpcMessage registrationResponse;
+        ASSERT_TRUE(processIpcInterface->timedReceive(iox::units::Duration::fromSeconds(1U), registrationResponse));
+        EXPECT_THAT(registrationResponse.getElementAtIndex(0), Eq(IpcMessageTypeToString(IpcMessageType::REG_ACK)));
+
+        IpcMessage publisherResponse;
+        ASSERT_TRUE(processIpcInterface->timedReceive(iox::units::Duration::fromSeconds(1U), publisherResponse));
+        EXPECT_THAT(publisherResponse.getElementAtIndex(0),
+                    Eq(IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER_ACK)));
+    }
+}
+
 } // namespace
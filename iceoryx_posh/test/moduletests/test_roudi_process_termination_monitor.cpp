@@ -0,0 +1,150 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(__linux__)
+
+#include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::units::duration_literals;
+
+class ProcessTerminationMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!sut.isAvailable())
+        {
+            GTEST_SKIP() << "pidfds are not supported on this system";
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto pid : m_children)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+    }
+
+    uint32_t startChild()
+    {
+        auto pid = fork();
+        if (pid == 0)
+        {
+            // the child does nothing until it is killed
+            while (true)
+            {
+                pause();
+            }
+        }
+        EXPECT_THAT(pid, Gt(0));
+        m_children.push_back(pid);
+        return static_cast<uint32_t>(pid);
+    }
+
+    void terminateChild(const uint32_t pid)
+    {
+        kill(static_cast<pid_t>(pid), SIGKILL);
+    }
+
+    ProcessTerminationMonitor sut;
+    std::vector<pid_t> m_children;
+};
+
+TEST_F(ProcessTerminationMonitor_test, WaitWithoutTerminatedProcessReturnsNothingAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e99899a8-ccd2-48d4-b62f-f99219c28b75");
+    ASSERT_TRUE(sut.add(startChild()));
+
+    EXPECT_TRUE(sut.wait(10_ms).empty());
+}
+
+TEST_F(ProcessTerminationMonitor_test, WaitReturnsPidOfTerminatedProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f5bedf2-b89e-4617-839f-71f4c61298f5");
+    auto pid = startChild();
+    auto otherPid = startChild();
+    ASSERT_TRUE(sut.add(pid));
+    ASSERT_TRUE(sut.add(otherPid));
+
+    terminateChild(pid);
+    auto terminatedProcesses = sut.wait(5_s);
+
+    ASSERT_THAT(terminatedProcesses.size(), Eq(1U));
+    EXPECT_THAT(terminatedProcesses[0], Eq(pid));
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminatedProcessIsReportedUntilItIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56edaa06-666a-4def-aa70-3b8112537423");
+    auto pid = startChild();
+    ASSERT_TRUE(sut.add(pid));
+
+    terminateChild(pid);
+    EXPECT_THAT(sut.wait(5_s).size(), Eq(1U));
+    EXPECT_THAT(sut.wait(5_s).size(), Eq(1U));
+
+    sut.remove(pid);
+    EXPECT_TRUE(sut.wait(10_ms).empty());
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminationOfRemovedProcessIsNotReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15e4ca93-87b3-4509-823f-940206f228b2");
+    auto pid = startChild();
+    ASSERT_TRUE(sut.add(pid));
+
+    sut.remove(pid);
+    terminateChild(pid);
+
+    EXPECT_TRUE(sut.wait(10_ms).empty());
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingAlreadyMonitoredProcessSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab1f2989-8703-40ba-afdc-8c56973cbd2d");
+    auto pid = startChild();
+
+    EXPECT_TRUE(sut.add(pid));
+    EXPECT_TRUE(sut.add(pid));
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingNonExistingProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f74edd9a-4b4e-409a-80d7-4969296f9480");
+    auto pid = startChild();
+    terminateChild(pid);
+    waitpid(static_cast<pid_t>(pid), nullptr, 0);
+    m_children.clear();
+
+    EXPECT_FALSE(sut.add(pid));
+}
+
+} // namespace
+
+#endif
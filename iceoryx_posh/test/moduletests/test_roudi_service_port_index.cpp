@@ -0,0 +1,106 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_port_index.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+struct PortDataStub
+{
+    ServiceDescription m_serviceDescription;
+};
+
+class ServicePortIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{8U};
+
+    ServiceDescription m_service{"Kaffee", "Tasse", "Henkel"};
+    ServiceDescription m_otherService{"Tee", "Kanne", "Deckel"};
+    PortDataStub m_ports[CAPACITY + 1U];
+
+    ServicePortIndex<PortDataStub, CAPACITY> sut;
+};
+
+constexpr uint64_t ServicePortIndex_test::CAPACITY;
+
+TEST_F(ServicePortIndex_test, FindReturnsOnlyPortsOfTheServiceInTheOrderTheyWereAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35d6eb00-99a5-4685-a37c-26b218b6161f");
+    m_ports[0U].m_serviceDescription = m_service;
+    m_ports[1U].m_serviceDescription = m_otherService;
+    m_ports[2U].m_serviceDescription = m_service;
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_TRUE(sut.add(&m_ports[i]));
+    }
+
+    EXPECT_THAT(sut.find(m_service), ElementsAre(&m_ports[0U], &m_ports[2U]));
+    EXPECT_THAT(sut.find(m_otherService), ElementsAre(&m_ports[1U]));
+    EXPECT_THAT(sut.find({"Wasser", "Glas", "Rand"}), IsEmpty());
+}
+
+TEST_F(ServicePortIndex_test, RemovedPortIsNotFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "311528a7-9450-4538-84fb-eaa8b0d91698");
+    m_ports[0U].m_serviceDescription = m_service;
+    m_ports[1U].m_serviceDescription = m_service;
+    ASSERT_TRUE(sut.add(&m_ports[0U]));
+    ASSERT_TRUE(sut.add(&m_ports[1U]));
+
+    sut.remove(&m_ports[0U]);
+    sut.remove(&m_ports[CAPACITY]);
+
+    EXPECT_THAT(sut.find(m_service), ElementsAre(&m_ports[1U]));
+}
+
+TEST_F(ServicePortIndex_test, AddFailsWhenCapacityIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1561e41c-d2e2-438a-874c-87ad8993d1d2");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        m_ports[i].m_serviceDescription = m_service;
+        ASSERT_TRUE(sut.add(&m_ports[i]));
+    }
+
+    m_ports[CAPACITY].m_serviceDescription = m_service;
+    EXPECT_FALSE(sut.add(&m_ports[CAPACITY]));
+    EXPECT_THAT(sut.find(m_service).size(), Eq(CAPACITY));
+}
+
+TEST_F(ServicePortIndex_test, RemovingAPortFreesItsSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ff80e7a-c4bb-4f77-a091-d6345ac4c328");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        m_ports[i].m_serviceDescription = (i % 2U == 0U) ? m_service : m_otherService;
+        ASSERT_TRUE(sut.add(&m_ports[i]));
+    }
+
+    sut.remove(&m_ports[1U]);
+    m_ports[CAPACITY].m_serviceDescription = m_otherService;
+
+    ASSERT_TRUE(sut.add(&m_ports[CAPACITY]));
+    EXPECT_THAT(sut.find(m_otherService), ElementsAre(&m_ports[3U], &m_ports[5U], &m_ports[7U], &m_ports[CAPACITY]));
+}
+
+} // namespace
@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -142,6 +143,16 @@ class ServiceRegistry_test : public Test
         return count;
     }
 
+    ServiceRegistryDelta deltaOf(const ServiceDescription& service)
+    {
+        ServiceRegistry::ServiceDescriptionEntry entry{service};
+        sut->find(service.getServiceIDString(),
+                  service.getInstanceIDString(),
+                  service.getEventIDString(),
+                  [&](const ServiceRegistry::ServiceDescriptionEntry& foundEntry) { entry = foundEntry; });
+        return ServiceRegistryDelta(sut->generation(), entry);
+    }
+
     void
     find(const optional<IdString_t>& service, const optional<IdString_t>& instance, const optional<IdString_t>& event)
     {
@@ -704,4 +715,182 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, FindAfterReusingAFreeSlotReturnsTheEntriesInSlotOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5cb543f2-16a0-430f-8281-359517116119");
+    iox::capro::ServiceDescription service1("a", "b", "b");
+    iox::capro::ServiceDescription service2("a", "c", "c");
+    iox::capro::ServiceDescription service3("a", "d", "d");
+    iox::capro::ServiceDescription service4("a", "e", "e");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+    this->sut.remove(service1);
+    ASSERT_FALSE(this->sut.add(service4).has_error());
+
+    this->find(iox::capro::IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard);
+
+    ASSERT_THAT(this->searchResult.size(), Eq(3U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(service4));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(service2));
+    EXPECT_THAT(this->searchResult[2].serviceDescription, Eq(service3));
+}
+
+TYPED_TEST(ServiceRegistry_test, EveryEntryOfAFullRegistryCanBeFoundWithEachSearchKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69757e59-5a48-435c-98c5-a774b52f3ef3");
+    auto toIdString = [](const std::string& value) { return iox::into<iox::lossy<IdString_t>>(value); };
+
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        auto number = iox::cxx::convert::toString(i);
+        ASSERT_FALSE(
+            this->sut.add({toIdString("s" + number), toIdString("i" + number), toIdString("e" + number)}).has_error());
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        auto number = iox::cxx::convert::toString(i);
+        ServiceDescription expectedService{
+            toIdString("s" + number), toIdString("i" + number), toIdString("e" + number)};
+
+        this->find(expectedService.getServiceIDString(), iox::capro::Wildcard, iox::capro::Wildcard);
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(expectedService));
+
+        this->find(iox::capro::Wildcard, expectedService.getInstanceIDString(), iox::capro::Wildcard);
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(expectedService));
+
+        this->find(iox::capro::Wildcard, iox::capro::Wildcard, expectedService.getEventIDString());
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(expectedService));
+
+        this->find(expectedService.getServiceIDString(),
+                   expectedService.getInstanceIDString(),
+                   expectedService.getEventIDString());
+        ASSERT_THAT(this->searchResult.size(), Eq(1U));
+        EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(expectedService));
+    }
+}
+
+TYPED_TEST(ServiceRegistry_test, CopyOfRegistryFindsTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "24a1db95-8f71-4a98-99b5-fc8408f1b667");
+    iox::capro::ServiceDescription service1("a", "b", "b");
+    iox::capro::ServiceDescription service2("c", "b", "d");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    // the registry is copied into a chunk when it is published to the applications
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(*this->sut.operator->())};
+    SearchResult_t result;
+    copy->find(iox::capro::Wildcard,
+               IdString_t("b"),
+               iox::capro::Wildcard,
+               [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+
+    ASSERT_THAT(result.size(), Eq(2U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(result[1].serviceDescription, Eq(service2));
+}
+
+TYPED_TEST(ServiceRegistry_test, GenerationIsIncrementedWithEveryChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "82228245-75a9-4bcf-bd6b-f1a7a704d234");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "e", "f");
+
+    EXPECT_THAT(this->sut->generation(), Eq(0U));
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.otherAdd(service1).has_error());
+    EXPECT_THAT(this->sut->generation(), Eq(3U));
+
+    this->sut.remove(service1);
+    this->sut->purge(service1);
+    EXPECT_THAT(this->sut->generation(), Eq(5U));
+
+    // no change, the service is not in the registry
+    this->sut.remove(service2);
+    this->sut->purge(service2);
+    EXPECT_THAT(this->sut->generation(), Eq(5U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingAllDeltasResultsInTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f33e7ed0-4c49-48a3-93b0-680b658922fd");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "e", "f");
+    iox::capro::ServiceDescription service3("g", "h", "i");
+
+    std::vector<ServiceRegistryDelta> deltas;
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    deltas.push_back(this->deltaOf(service1));
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    deltas.push_back(this->deltaOf(service2));
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    deltas.push_back(this->deltaOf(service2));
+    ASSERT_FALSE(this->sut.otherAdd(service3).has_error());
+    deltas.push_back(this->deltaOf(service3));
+    this->sut.remove(service1);
+    deltas.push_back(this->deltaOf(service1));
+
+    std::unique_ptr<ServiceRegistry> registry{new ServiceRegistry};
+    for (const auto& delta : deltas)
+    {
+        EXPECT_TRUE(registry->apply(delta));
+    }
+
+    EXPECT_THAT(registry->generation(), Eq(this->sut->generation()));
+    SearchResult_t result;
+    registry->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+    ASSERT_THAT(result.size(), Eq(2U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service2));
+    EXPECT_THAT(this->sut.count(result[0]), Eq(2U));
+    EXPECT_THAT(result[1].serviceDescription, Eq(service3));
+    EXPECT_THAT(result[1].publisherCount + result[1].serverCount, Eq(1U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingDeltaAfterLostDeltaFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26cb7498-e3e0-42b2-8991-3c686524aeaa");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "e", "f");
+
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    std::unique_ptr<ServiceRegistry> registry{new ServiceRegistry};
+    EXPECT_FALSE(registry->apply(this->deltaOf(service2)));
+
+    EXPECT_THAT(registry->generation(), Eq(0U));
+    SearchResult_t result;
+    registry->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+    EXPECT_TRUE(result.empty());
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingDeltaWhichIsContainedInSnapshotIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9eab16d6-3ab1-4a97-b073-10a4d52bea71");
+    iox::capro::ServiceDescription service("a", "b", "c");
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    auto addDelta = this->deltaOf(service);
+    this->sut.remove(service);
+    auto removeDelta = this->deltaOf(service);
+
+    std::unique_ptr<ServiceRegistry> snapshot{new ServiceRegistry(*this->sut.operator->())};
+    EXPECT_TRUE(snapshot->apply(addDelta));
+    EXPECT_TRUE(snapshot->apply(removeDelta));
+
+    EXPECT_THAT(snapshot->generation(), Eq(2U));
+    SearchResult_t result;
+    snapshot->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); });
+    EXPECT_TRUE(result.empty());
+}
+
 } // namespace
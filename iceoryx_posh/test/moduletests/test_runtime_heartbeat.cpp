@@ -0,0 +1,52 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+
+TEST(Heartbeat_test, ElapsedTimeSinceLastBeatIncreasesWithoutBeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f05e537e-312f-46ec-bfac-0eccf3dcc32a");
+    constexpr uint64_t WAITING_TIME_MS{50U};
+    Heartbeat sut;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAITING_TIME_MS));
+
+    EXPECT_THAT(sut.elapsedMillisecondsSinceLastBeat(), Ge(WAITING_TIME_MS));
+}
+
+TEST(Heartbeat_test, BeatResetsElapsedTimeSinceLastBeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a117ac4-a9f1-4795-88b0-006036091639");
+    constexpr uint64_t WAITING_TIME_MS{50U};
+    Heartbeat sut;
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAITING_TIME_MS));
+
+    sut.beat();
+
+    EXPECT_THAT(sut.elapsedMillisecondsSinceLastBeat(), Lt(WAITING_TIME_MS));
+}
+
+} // namespace
@@ -0,0 +1,104 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+using iox::capro::ServiceDescription;
+
+TEST(PortBatch_test, DefaultConstructedBatchIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c34bc049-9e45-41b0-9699-2b8ef1bd3ef4");
+    PortBatch sut;
+
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST(PortBatch_test, AddedPortsAreStoredInOrderWithTheirOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87c1f11e-5d78-4fd4-9485-0afd512a75cd");
+    const ServiceDescription publisherService{"Radar", "FrontLeft", "Object"};
+    const ServiceDescription subscriberService{"Vehicle", "Ego", "Speed"};
+    const ServiceDescription clientService{"Planner", "Ego", "Route"};
+    const ServiceDescription serverService{"Map", "Ego", "Tile"};
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 3U;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 5U;
+    iox::popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 7U;
+    iox::popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 11U;
+
+    PortBatch sut;
+    sut.addPublisher(publisherService, publisherOptions, PortConfigInfo(13U))
+        .addSubscriber(subscriberService, subscriberOptions)
+        .addClient(clientService, clientOptions)
+        .addServer(serverService, serverOptions);
+
+    ASSERT_THAT(sut.size(), Eq(4U));
+    const auto& entries = sut.entries();
+    EXPECT_THAT(entries[0].portType, Eq(PortBatch::PortType::PUBLISHER));
+    EXPECT_THAT(entries[0].service, Eq(publisherService));
+    ASSERT_THAT(entries[0].options.get<iox::popo::PublisherOptions>(), Ne(nullptr));
+    EXPECT_THAT(entries[0].options.get<iox::popo::PublisherOptions>()->historyCapacity, Eq(3U));
+    EXPECT_THAT(entries[0].portConfigInfo.portType, Eq(13U));
+    EXPECT_THAT(entries[1].portType, Eq(PortBatch::PortType::SUBSCRIBER));
+    EXPECT_THAT(entries[1].service, Eq(subscriberService));
+    ASSERT_THAT(entries[1].options.get<iox::popo::SubscriberOptions>(), Ne(nullptr));
+    EXPECT_THAT(entries[1].options.get<iox::popo::SubscriberOptions>()->queueCapacity, Eq(5U));
+    EXPECT_THAT(entries[2].portType, Eq(PortBatch::PortType::CLIENT));
+    EXPECT_THAT(entries[2].service, Eq(clientService));
+    ASSERT_THAT(entries[2].options.get<iox::popo::ClientOptions>(), Ne(nullptr));
+    EXPECT_THAT(entries[2].options.get<iox::popo::ClientOptions>()->responseQueueCapacity, Eq(7U));
+    EXPECT_THAT(entries[3].portType, Eq(PortBatch::PortType::SERVER));
+    EXPECT_THAT(entries[3].service, Eq(serverService));
+    ASSERT_THAT(entries[3].options.get<iox::popo::ServerOptions>(), Ne(nullptr));
+    EXPECT_THAT(entries[3].options.get<iox::popo::ServerOptions>()->requestQueueCapacity, Eq(11U));
+}
+
+TEST(PortBatch_test, AddingConditionVariablesAddsOneEntryPerConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "df4b1f5b-8cb8-4819-b4db-81805fbc10ee");
+    PortBatch sut;
+    sut.addConditionVariables(3U);
+
+    ASSERT_THAT(sut.size(), Eq(3U));
+    for (const auto& entry : sut.entries())
+    {
+        EXPECT_THAT(entry.portType, Eq(PortBatch::PortType::CONDITION_VARIABLE));
+    }
+}
+
+TEST(PortBatch_test, AddingPortsToFullBatchIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8dde77f1-87fa-4eab-837a-5add0737bd0f");
+    PortBatch sut;
+    sut.addConditionVariables(iox::MAX_PORTS_PER_BATCH);
+
+    sut.addPublisher({"Radar", "FrontLeft", "Object"});
+
+    ASSERT_THAT(sut.size(), Eq(iox::MAX_PORTS_PER_BATCH));
+    EXPECT_THAT(sut.entries().back().portType, Eq(PortBatch::PortType::CONDITION_VARIABLE));
+}
+
+} // namespace
@@ -0,0 +1,183 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/service_registry_mirror.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+using iox::runtime::ServiceRegistryMirror;
+
+class ServiceRegistryMirror_test : public Test
+{
+  public:
+    // every change of the source registry is recorded as delta like RouDi publishes it
+    ServiceRegistryDelta addPublisher(const ServiceDescription& service)
+    {
+        EXPECT_FALSE(source->addPublisher(service).has_error());
+        ServiceRegistry::ServiceDescriptionEntry entry{service};
+        source->find(service.getServiceIDString(),
+                     service.getInstanceIDString(),
+                     service.getEventIDString(),
+                     [&](const ServiceRegistry::ServiceDescriptionEntry& foundEntry) { entry = foundEntry; });
+        return ServiceRegistryDelta(source->generation(), entry);
+    }
+
+    std::unique_ptr<ServiceRegistry> snapshotOfSource()
+    {
+        return std::unique_ptr<ServiceRegistry>(new ServiceRegistry(*source));
+    }
+
+    void update(const ServiceRegistry* const snapshot, const std::vector<ServiceRegistryDelta>& receivedDeltas)
+    {
+        uint64_t nextDelta{0U};
+        sut.update(snapshot, [&](const ServiceRegistryMirror::DeltaCallback_t& applyDelta) {
+            if (nextDelta == receivedDeltas.size())
+            {
+                return false;
+            }
+            applyDelta(receivedDeltas[nextDelta]);
+            ++nextDelta;
+            return true;
+        });
+    }
+
+    bool contains(const ServiceDescription& service)
+    {
+        bool isFound{false};
+        sut.registry().find(service.getServiceIDString(),
+                            service.getInstanceIDString(),
+                            service.getEventIDString(),
+                            [&](const ServiceRegistry::ServiceDescriptionEntry&) { isFound = true; });
+        return isFound;
+    }
+
+    std::unique_ptr<ServiceRegistry> source{new ServiceRegistry};
+    ServiceRegistryMirror sut;
+
+    const ServiceDescription service1{"Radar", "FrontLeft", "Object"};
+    const ServiceDescription service2{"Radar", "FrontRight", "Object"};
+    const ServiceDescription service3{"Lidar", "Roof", "Cloud"};
+    const ServiceDescription service4{"Camera", "Front", "Image"};
+    const ServiceDescription service5{"Camera", "Rear", "Image"};
+};
+
+TEST_F(ServiceRegistryMirror_test, DeltasWithoutSnapshotAreDiscarded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c61d057-bbc4-4c34-a0b1-d4deddc55d8d");
+    const auto delta1 = addPublisher(service1);
+    const auto delta2 = addPublisher(service2);
+
+    update(nullptr, {delta1, delta2});
+
+    EXPECT_FALSE(sut.isSynchronized());
+    EXPECT_FALSE(contains(service1));
+    EXPECT_FALSE(contains(service2));
+}
+
+TEST_F(ServiceRegistryMirror_test, JoiningMidStreamSynchronizesWithSnapshotAndAppliesTheFollowingDeltas)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4960ca22-906d-4f4b-8e53-4209d5aa12a5");
+    IOX_DISCARD_RESULT(addPublisher(service1));
+    const auto delta2 = addPublisher(service2);
+    const auto snapshot = snapshotOfSource();
+    const auto delta3 = addPublisher(service3);
+
+    // the history of the deltas also contains a delta which is already contained in the snapshot
+    update(snapshot.get(), {delta2, delta3});
+
+    EXPECT_TRUE(sut.isSynchronized());
+    EXPECT_THAT(sut.registry().generation(), Eq(source->generation()));
+    EXPECT_TRUE(contains(service1));
+    EXPECT_TRUE(contains(service2));
+    EXPECT_TRUE(contains(service3));
+}
+
+TEST_F(ServiceRegistryMirror_test, DroppedDeltaWaitsForSnapshotWhichContainsIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62d70401-e482-45fb-b12e-312e30b09874");
+    const auto delta1 = addPublisher(service1);
+    const auto oldSnapshot = snapshotOfSource();
+    update(oldSnapshot.get(), {delta1});
+    ASSERT_TRUE(sut.isSynchronized());
+
+    const auto delta2 = addPublisher(service2);
+    IOX_DISCARD_RESULT(addPublisher(service3));
+    const auto delta4 = addPublisher(service4);
+
+    // the delta of service3 was dropped and the latest snapshot is older than the mirror
+    update(oldSnapshot.get(), {delta2, delta4});
+
+    EXPECT_FALSE(sut.isSynchronized());
+    EXPECT_TRUE(contains(service2));
+    EXPECT_FALSE(contains(service3));
+    EXPECT_FALSE(contains(service4));
+
+    update(nullptr, {});
+    EXPECT_FALSE(sut.isSynchronized());
+
+    const auto newSnapshot = snapshotOfSource();
+    const auto delta5 = addPublisher(service5);
+    update(newSnapshot.get(), {delta5});
+
+    EXPECT_TRUE(sut.isSynchronized());
+    EXPECT_THAT(sut.registry().generation(), Eq(source->generation()));
+    EXPECT_TRUE(contains(service3));
+    EXPECT_TRUE(contains(service4));
+    EXPECT_TRUE(contains(service5));
+}
+
+TEST_F(ServiceRegistryMirror_test, DroppedDeltaIsRecoveredWithSnapshotOfTheSameUpdate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2ed3a8be-c6f8-458b-991f-26e2d6c5506c");
+    const auto delta1 = addPublisher(service1);
+    const auto snapshot1 = snapshotOfSource();
+    update(snapshot1.get(), {delta1});
+    ASSERT_TRUE(sut.isSynchronized());
+
+    IOX_DISCARD_RESULT(addPublisher(service2));
+    const auto delta3 = addPublisher(service3);
+    const auto snapshot3 = snapshotOfSource();
+
+    update(snapshot3.get(), {delta3});
+
+    EXPECT_TRUE(sut.isSynchronized());
+    EXPECT_TRUE(contains(service2));
+    EXPECT_TRUE(contains(service3));
+}
+
+TEST_F(ServiceRegistryMirror_test, SynchronizedMirrorDoesNotCopyAnOlderSnapshot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a144a407-ce2f-4e2a-a150-80e72aa6a24c");
+    const auto delta1 = addPublisher(service1);
+    const auto snapshot1 = snapshotOfSource();
+    update(snapshot1.get(), {delta1});
+    const auto delta2 = addPublisher(service2);
+    update(nullptr, {delta2});
+
+    update(snapshot1.get(), {});
+
+    EXPECT_TRUE(sut.isSynchronized());
+    EXPECT_TRUE(contains(service2));
+}
+} // namespace
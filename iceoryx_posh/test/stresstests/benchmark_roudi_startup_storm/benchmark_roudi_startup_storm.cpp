@@ -0,0 +1,219 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_platform/getopt.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+#include "iox/optional.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct StormSettings
+{
+    uint32_t numberOfProcesses{32U};
+    uint32_t numberOfPortsPerProcess{4U};
+    uint32_t maxNumberOfRuntimeMessagesThreads{4U};
+};
+
+/// @brief registers at RouDi and creates the publishers like an application at startup would do
+void runApplication(const uint32_t index, const StormSettings& settings)
+{
+    const std::string name = "storm" + std::to_string(index);
+    auto& runtime = iox::runtime::PoshRuntime::initRuntime(iox::RuntimeName_t(iox::TruncateToCapacity, name.c_str()));
+
+    for (uint32_t port = 0U; port < settings.numberOfPortsPerProcess; ++port)
+    {
+        const std::string instance = std::to_string(port);
+        if (runtime.getMiddlewarePublisher({iox::capro::IdString_t(iox::TruncateToCapacity, name.c_str()),
+                                            iox::capro::IdString_t(iox::TruncateToCapacity, instance.c_str()),
+                                            "Event"})
+            == nullptr)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/// @brief starts all applications at once against a RouDi with the given number of runtime messages threads
+/// @return the time until all applications are registered and have created their ports
+iox::optional<std::chrono::microseconds> performStorm(const StormSettings& settings,
+                                                      const uint32_t numberOfRuntimeMessagesThreads)
+{
+    // the applications are forked before RouDi starts its threads and wait on the pipe until all are ready to start
+    int startSignal[2];
+    if (pipe(startSignal) != 0)
+    {
+        std::cerr << "Could not create the start signal pipe!" << std::endl;
+        return iox::nullopt;
+    }
+
+    std::vector<pid_t> applications;
+    for (uint32_t i = 0U; i < settings.numberOfProcesses; ++i)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            close(startSignal[1]);
+            // blocks until the write end is closed, i.e. the read returns the end of file
+            char start{0};
+            if (read(startSignal[0], &start, 1) < 0)
+            {
+                std::exit(EXIT_FAILURE);
+            }
+            runApplication(i, settings);
+            std::exit(EXIT_SUCCESS);
+        }
+        if (pid < 0)
+        {
+            std::cerr << "Could not fork application " << i << "!" << std::endl;
+            break;
+        }
+        applications.push_back(pid);
+    }
+    close(startSignal[0]);
+
+    bool success{applications.size() == settings.numberOfProcesses};
+    std::chrono::microseconds duration{0};
+    {
+        iox::RouDiConfig_t config = iox::RouDiConfig_t().setDefaults();
+        iox::roudi::IceOryxRouDiComponents roudiComponents(config);
+        using RouDi = iox::roudi::RouDi;
+        RouDi roudi(roudiComponents.rouDiMemoryManager,
+                    roudiComponents.portManager,
+                    RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF,
+                                                  false,
+                                                  RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                  iox::version::CompatibilityCheckLevel::PATCH,
+                                                  iox::roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                  numberOfRuntimeMessagesThreads});
+
+        auto start = std::chrono::steady_clock::now();
+        // closing the write end of the pipe releases all applications at once
+        close(startSignal[1]);
+        for (auto pid : applications)
+        {
+            int status{0};
+            if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+            {
+                success = false;
+            }
+        }
+        duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    if (!success)
+    {
+        return iox::nullopt;
+    }
+    return duration;
+}
+
+int main(int argc, char* argv[])
+{
+    StormSettings settings;
+
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"processes", required_argument, nullptr, 'p'},
+                                      {"ports", required_argument, nullptr, 'n'},
+                                      {"threads", required_argument, nullptr, 't'},
+                                      {nullptr, 0, nullptr, 0}};
+
+    // colon after shortOption means it requires an argument, two colons mean optional argument
+    constexpr const char* shortOptions = "hp:n:t:";
+    int32_t index{0};
+    int32_t opt{-1};
+    while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
+    {
+        switch (opt)
+        {
+        case 'h':
+            std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
+            std::cout << "Options:" << std::endl;
+            std::cout << "-h, --help                        Display help" << std::endl;
+            std::cout << "-p, --processes <N>               Number of applications starting at the same time"
+                      << std::endl;
+            std::cout << "                                  default = '32'" << std::endl;
+            std::cout << "-n, --ports <N>                   Number of publishers created by each application"
+                      << std::endl;
+            std::cout << "                                  default = '4'" << std::endl;
+            std::cout << "-t, --threads <N>                 Maximum number of runtime messages threads of RouDi"
+                      << std::endl;
+            std::cout << "                                  default = '4'" << std::endl;
+            return EXIT_SUCCESS;
+        case 'p':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfProcesses) || settings.numberOfProcesses == 0U
+                || settings.numberOfProcesses >= iox::MAX_PROCESS_NUMBER)
+            {
+                std::cerr << "The number of processes must be in the range of [1, " << iox::MAX_PROCESS_NUMBER - 1U
+                          << "]!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'n':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfPortsPerProcess))
+            {
+                std::cerr << "Could not parse 'ports' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 't':
+            if (!iox::cxx::convert::fromString(optarg, settings.maxNumberOfRuntimeMessagesThreads)
+                || settings.maxNumberOfRuntimeMessagesThreads == 0U
+                || settings.maxNumberOfRuntimeMessagesThreads > iox::roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS)
+            {
+                std::cerr << "The number of threads must be in the range of [1, "
+                          << iox::roudi::MAX_NUMBER_OF_RUNTIME_MESSAGES_THREADS << "]!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        default:
+            return EXIT_FAILURE;
+        };
+    }
+
+    iox::log::Logger::init(iox::log::LogLevel::ERROR);
+
+    std::cout << settings.numberOfProcesses << " applications with " << settings.numberOfPortsPerProcess
+              << " publishers each" << std::endl;
+    for (uint32_t threads = 1U; threads <= settings.maxNumberOfRuntimeMessagesThreads; threads *= 2U)
+    {
+        auto duration = performStorm(settings, threads);
+        if (!duration.has_value())
+        {
+            std::cerr << "The startup storm with " << threads << " threads failed!" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // Not using iceoryx logger due to width requirements
+        std::cout << std::setw(3) << threads << " threads : " << std::setw(10) << duration->count() << " us"
+                  << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
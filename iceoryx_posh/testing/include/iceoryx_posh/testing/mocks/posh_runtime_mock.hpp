@@ -78,6 +78,8 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                 (noexcept, override));
     MOCK_METHOD(iox::popo::ConditionVariableData*, getMiddlewareConditionVariable, (), (noexcept, override));
     MOCK_METHOD(iox::runtime::NodeData*, createNode, (const iox::runtime::NodeProperty&), (noexcept, override));
+    MOCK_METHOD(uint64_t, claimManifestPorts, (), (noexcept, override));
+    MOCK_METHOD(uint64_t, createPorts, (const iox::runtime::PortBatch&), (noexcept, override));
     MOCK_METHOD(bool,
                 sendRequestToRouDi,
                 (const iox::runtime::IpcMessage&, iox::runtime::IpcMessage&),